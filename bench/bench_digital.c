@@ -0,0 +1,165 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Martin Nicolas Soria <soria.m.nicolas@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, disponiblestribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file bench_digital.c
+ ** @brief Comparacion en el host de las salidas y entradas digitales en tiempo de ejecucion contra los pines fijos.
+ **
+ ** Cada operacion se envuelve en una funcion que no se expande en linea, para medir su costo por llamada y para que
+ ** `make -C bench insns` cuente sus instrucciones en el desensamblado. Los registros GPIO son los simulados de
+ ** test/support, por lo que las funciones de LPCOpen tambien cuentan como llamadas en la interfaz en tiempo de
+ ** ejecucion, igual que en la placa cuando no se expanden en linea.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "digital.h"
+#include "digital_pin.h"
+#include "chip.h"
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define ITERATIONS 20000000UL // Cantidad de operaciones por medicion
+#define PIN_PORT   2          // Puerto de las salidas de prueba
+#define PIN_BIT    11         // Pin de la salida de prueba
+#define PIN_LOW    12         // Pin de la salida invertida de prueba
+#define INPUT_PORT 1          // Puerto de la entrada de prueba
+#define INPUT_BIT  4          // Pin de la entrada de prueba
+
+#define BENCH_NOINLINE __attribute__((noinline))
+
+/* === Private data type declarations ============================================================================== */
+
+DIGITAL_PIN_OUTPUT(FixedOutput, PIN_PORT, PIN_BIT, false)
+DIGITAL_PIN_OUTPUT(FixedOutputLow, PIN_PORT, PIN_LOW, true)
+DIGITAL_PIN_INPUT(FixedInputLow, INPUT_PORT, INPUT_BIT, true)
+
+/* === Private function declarations =============================================================================== */
+
+static BENCH_NOINLINE void BenchRuntimeWrite(bool active);
+static BENCH_NOINLINE void BenchFixedWrite(bool active);
+static BENCH_NOINLINE void BenchRuntimeWriteLow(bool active);
+static BENCH_NOINLINE void BenchFixedWriteLow(bool active);
+static BENCH_NOINLINE void BenchRuntimeToggle(bool active);
+static BENCH_NOINLINE void BenchFixedToggle(bool active);
+static BENCH_NOINLINE void BenchRuntimeReadLow(bool active);
+static BENCH_NOINLINE void BenchFixedReadLow(bool active);
+
+/**
+ * @brief Mide el costo promedio de una operacion, alternando el estado pedido en cada llamada
+ *
+ * @param name Nombre de la medicion
+ * @param operation Operacion a medir
+ */
+static void BenchOperation(const char * name, void (*operation)(bool));
+
+/* === Private variable definitions ================================================================================ */
+
+static digital_output_t runtime_output;
+static digital_output_t runtime_output_low;
+static digital_input_t runtime_input_low;
+
+//! Destino de las lecturas, para que el compilador no las elimine
+static volatile bool sink;
+
+/* === Public function definitions ================================================================================= */
+
+int main(void) {
+    runtime_output = DigitalOutputCreate(PIN_PORT, PIN_BIT, false);
+    runtime_output_low = DigitalOutputCreate(PIN_PORT, PIN_LOW, true);
+    runtime_input_low = DigitalInputCreate(INPUT_PORT, INPUT_BIT, true);
+    FixedOutputInit();
+    FixedOutputLowInit();
+
+    BenchOperation("output_write_runtime", BenchRuntimeWrite);
+    BenchOperation("output_write_fixed", BenchFixedWrite);
+    BenchOperation("output_write_low_runtime", BenchRuntimeWriteLow);
+    BenchOperation("output_write_low_fixed", BenchFixedWriteLow);
+    BenchOperation("output_toggle_runtime", BenchRuntimeToggle);
+    BenchOperation("output_toggle_fixed", BenchFixedToggle);
+    BenchOperation("input_read_low_runtime", BenchRuntimeReadLow);
+    BenchOperation("input_read_low_fixed", BenchFixedReadLow);
+
+    return 0;
+}
+
+static BENCH_NOINLINE void BenchRuntimeWrite(bool active) {
+    if (active) {
+        DigitalOutputActivate(runtime_output);
+    } else {
+        DigitalOutputDeactivate(runtime_output);
+    }
+}
+
+static BENCH_NOINLINE void BenchFixedWrite(bool active) {
+    FixedOutputWrite(active);
+}
+
+static BENCH_NOINLINE void BenchRuntimeWriteLow(bool active) {
+    if (active) {
+        DigitalOutputActivate(runtime_output_low);
+    } else {
+        DigitalOutputDeactivate(runtime_output_low);
+    }
+}
+
+static BENCH_NOINLINE void BenchFixedWriteLow(bool active) {
+    FixedOutputLowWrite(active);
+}
+
+static BENCH_NOINLINE void BenchRuntimeToggle(bool active) {
+    (void)active;
+    DigitalOutputToggle(runtime_output);
+}
+
+static BENCH_NOINLINE void BenchFixedToggle(bool active) {
+    (void)active;
+    FixedOutputToggle();
+}
+
+static BENCH_NOINLINE void BenchRuntimeReadLow(bool active) {
+    (void)active;
+    sink = DigitalInputGetIsActive(runtime_input_low);
+}
+
+static BENCH_NOINLINE void BenchFixedReadLow(bool active) {
+    (void)active;
+    sink = FixedInputLowGetIsActive();
+}
+
+/* === Private function definitions ================================================================================ */
+
+static void BenchOperation(const char * name, void (*operation)(bool)) {
+    struct timespec start, end;
+    double elapsed;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (unsigned long i = 0; i < ITERATIONS; i++) {
+        operation((i & 1u) != 0);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    elapsed = (end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec);
+    printf("%-28s %8.2f ns/op\n", name, elapsed / ITERATIONS);
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,141 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Martin Nicolas Soria <soria.m.nicolas@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, disponiblestribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file bench_probe.c
+ ** @brief Tabla de las sondas de los caminos criticos medida en el host.
+ **
+ ** Se compila con PROBE_ENABLED en 1 junto con los modulos reales, asi las sondas de ClockNewTick, ScreenRefreshTimed
+ ** y DigitalWasChanged son las mismas que en la placa. El refresco usa el camino de la interrupcion de TIMER0, el de
+ ** la configuracion por defecto. ui_render es privada de app.c y se reemplaza por la escritura y
+ ** publicacion de la hora que hace en el modo normal. En el host el contador son nanosegundos de clock_gettime, y
+ ** cada medicion incluye una lectura del contador; la sonda vacia del final mide ese piso.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdio.h>
+#include <stdint.h>
+
+/* El tipo del reloj de la aplicacion choca con el clock_t de time.h, se lo renombra solo en este archivo */
+#define clock_t app_clock_t
+#include "clock.h"
+#include "digital.h"
+#include "probe.h"
+#include "screen.h"
+
+/* === Macros definitions ========================================================================================== */
+
+#define ITERATIONS     1000000UL // Mediciones por sonda
+#define REFRESH_PERIOD 1000      // Periodo de refresco de cada digito, en cuentas del temporizador
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+static void NullDigitsTurnOff(void);
+static void NullSegmentsUpdate(uint8_t segments);
+static void NullDigitTurnOn(uint8_t digit);
+
+/**
+ * @brief Imprime el resumen de todas las sondas con mediciones
+ *
+ * @param title Titulo de la tabla
+ */
+static void Report(const char * title);
+
+/* === Private variable definitions ================================================================================ */
+
+static const struct screen_driver_s null_driver = {
+    .DigitsTurnOff = NullDigitsTurnOff,
+    .SegmentsUpdate = NullSegmentsUpdate,
+    .DigitTurnOn = NullDigitTurnOn,
+};
+
+//! Destino de las escrituras del driver, para que el compilador no las elimine
+static volatile uint32_t sink;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Public function definitions ================================================================================= */
+
+int main(void) {
+    clock_time_t start = {.time = {.seconds = {0, 0}, .minutes = {0, 0}, .hours = {2, 1}}};
+    clock_t clock = ClockCreate(1000, 5);
+    screen_t screen = ScreenCreate(4, &null_driver);
+    digital_input_t key = DigitalInputCreate(5, 8, false);
+    uint32_t timestamp = 0;
+
+    ProbeCounterStart();
+    ScreenSetRefreshPeriod(screen, REFRESH_PERIOD);
+    ClockSetTime(clock, &start);
+    for (uint32_t index = 0; index < ITERATIONS; index++) {
+        clock_time_t now;
+
+        ClockNewTick(clock);
+        timestamp += ScreenRefreshTimed(screen, timestamp);
+        sink = DigitalWasChanged(key);
+        if ((index % 5) == 0) {
+            ClockGetTime(clock, &now);
+            PROBE_BEGIN(PROBE_UI_RENDER);
+            ScreenWriteTime(screen, now.time.hours, now.time.minutes);
+            ScreenPublish(screen);
+            PROBE_END(PROBE_UI_RENDER);
+        }
+    }
+    Report("hot paths (ns)");
+
+    ProbeReset();
+    for (uint32_t index = 0; index < ITERATIONS; index++) {
+        PROBE_BEGIN(PROBE_CLOCK_TICK);
+        PROBE_END(PROBE_CLOCK_TICK);
+    }
+    Report("empty probe (ns)");
+    return 0;
+}
+
+/* === Private function definitions ================================================================================ */
+
+static void NullDigitsTurnOff(void) {
+    sink = 0;
+}
+
+static void NullSegmentsUpdate(uint8_t segments) {
+    sink = segments;
+}
+
+static void NullDigitTurnOn(uint8_t digit) {
+    sink = digit;
+}
+
+static void Report(const char * title) {
+    probe_stats_t stats;
+
+    printf("%s\n", title);
+    for (probe_id_t probe = 0; probe < PROBE_COUNT; probe++) {
+        if (ProbeGetStats(probe, &stats)) {
+            printf("  %-16s n %8lu  min %5lu  mean %5lu  p50 %5lu  p90 %5lu  p99 %5lu  max %7lu\n", ProbeName(probe),
+                   (unsigned long)stats.count, (unsigned long)stats.min, (unsigned long)stats.mean,
+                   (unsigned long)stats.p50, (unsigned long)stats.p90, (unsigned long)stats.p99,
+                   (unsigned long)stats.max);
+        }
+    }
+}
+
+/* === End of documentation ======================================================================================== */
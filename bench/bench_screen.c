@@ -0,0 +1,286 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Martin Nicolas Soria <soria.m.nicolas@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, disponiblestribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file bench_screen.c
+ ** @brief Mediciones de costo del refresco de la pantalla de 7 segmentos en el host.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "screen.h"
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <time.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define ITERATIONS 20000000UL // Cantidad de refrescos por medicion
+#define RENDERS_PER_MINUTE 12000 // Llamadas a ui_render por minuto, una cada 5 ms
+#define RENDERS_PER_SECOND 200   // Llamadas a ui_render por segundo, entre cambios del punto de los segundos
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+static void NullDigitsTurnOff(void);
+static void NullSegmentsUpdate(uint8_t segments);
+static void NullDigitTurnOn(uint8_t digit);
+
+/**
+ * @brief Mide el costo promedio de ScreenRefresh sobre una pantalla ya configurada
+ *
+ * @param name Nombre de la medicion
+ * @param screen Pantalla a refrescar
+ */
+static void BenchRefresh(const char * name, screen_t screen);
+
+/**
+ * @brief Escribe la hora con la cadena anterior de ui_render: BCD a binario, division y ScreenWriteBCD
+ *
+ * @param screen Pantalla a modificar
+ * @param hours Digitos BCD de las horas, unidades primero
+ * @param minutes Digitos BCD de los minutos, unidades primero
+ */
+static void WriteTimeByDigits(screen_t screen, const uint8_t hours[2], const uint8_t minutes[2]);
+
+/**
+ * @brief Mide el costo promedio de escribir la hora, avanzando un minuto cada `period` escrituras
+ *
+ * @param name Nombre de la medicion
+ * @param write Funcion que escribe la hora en la pantalla
+ * @param period Cantidad de escrituras con la misma hora
+ */
+static void BenchWriteTime(const char * name, void (*write)(screen_t, const uint8_t[2], const uint8_t[2]),
+                           uint32_t period);
+
+/**
+ * @brief Escribe la hora con ScreenWriteTime, con la firma usada por BenchWriteTime
+ *
+ * @param screen Pantalla a modificar
+ * @param hours Digitos BCD de las horas, unidades primero
+ * @param minutes Digitos BCD de los minutos, unidades primero
+ */
+static void WriteTimeFused(screen_t screen, const uint8_t hours[2], const uint8_t minutes[2]);
+
+/**
+ * @brief Repite la cadena de ui_render en el modo normal: brillo, hora, puntos, parpadeos y publicacion
+ *
+ * @param screen Pantalla a modificar
+ * @param hours Digitos BCD de las horas, unidades primero
+ * @param minutes Digitos BCD de los minutos, unidades primero
+ * @param blink Estado del punto de los segundos
+ */
+static void RenderNormal(screen_t screen, const uint8_t hours[2], const uint8_t minutes[2], bool blink);
+
+/**
+ * @brief Mide el costo promedio de una llamada a ui_render cada 5 ms en el modo normal, con la alarma habilitada
+ *
+ * Con `keyed` la cadena solo se ejecuta si cambio la clave de render, como hace app.c; sin ella se ejecuta siempre,
+ * como antes de la clave.
+ *
+ * @param name Nombre de la medicion
+ * @param keyed Indica si se saltea la cadena cuando la clave no cambio
+ */
+static void BenchRender(const char * name, bool keyed);
+
+/* === Private variable definitions ================================================================================ */
+
+static const struct screen_driver_s null_driver = {
+    .DigitsTurnOff = NullDigitsTurnOff,
+    .SegmentsUpdate = NullSegmentsUpdate,
+    .DigitTurnOn = NullDigitTurnOn,
+};
+
+//! Destino de las escrituras del driver, para que el compilador no las elimine
+static volatile uint32_t sink;
+
+/* === Public function definitions ================================================================================= */
+
+int main(void) {
+    uint8_t value[4] = {1, 2, 3, 4};
+    screen_t screen;
+
+    screen = ScreenCreate(4, &null_driver);
+    ScreenWriteBCD(screen, value, 4);
+    ScreenPublish(screen);
+    BenchRefresh("refresh_static", screen);
+
+    screen = ScreenCreate(4, &null_driver);
+    ScreenWriteBCD(screen, value, 4);
+    DisplayFlashDigit(screen, 2, 3, 20);
+    ScreenPublish(screen);
+    BenchRefresh("refresh_flash_digits", screen);
+
+    screen = ScreenCreate(4, &null_driver);
+    ScreenWriteBCD(screen, value, 4);
+    ScreenEnablePoint(screen, 1);
+    DisplayFlashDigit(screen, 0, 3, 20);
+    DisplayFlashPoints(screen, 0, 3, 20);
+    ScreenPublish(screen);
+    BenchRefresh("refresh_flash_digits_points", screen);
+
+#ifdef SCREEN_ATTR_BLINK
+    screen = ScreenCreate(4, &null_driver);
+    ScreenWriteBCD(screen, value, 4);
+    ScreenSetAttributes(screen, 0, 0, SCREEN_ATTR_BLINK | SCREEN_ATTR_POINT);
+    ScreenSetAttributes(screen, 2, 3, SCREEN_ATTR_BLINK);
+    ScreenSetAttributes(screen, 1, 1, SCREEN_ATTR_POINT | SCREEN_ATTR_POINT_BLINK);
+    DisplayFlashPoints(screen, 1, 1, 20);
+    ScreenPublish(screen);
+    BenchRefresh("refresh_several_regions", screen);
+#endif
+
+    BenchWriteTime("write_time_bcd_minutely", WriteTimeByDigits, RENDERS_PER_MINUTE);
+    BenchWriteTime("write_time_fused_minutely", WriteTimeFused, RENDERS_PER_MINUTE);
+    BenchWriteTime("write_time_bcd_always", WriteTimeByDigits, 1);
+    BenchWriteTime("write_time_fused_always", WriteTimeFused, 1);
+
+    BenchRender("ui_render_always", false);
+    BenchRender("ui_render_keyed", true);
+
+    return 0;
+}
+
+/* === Private function definitions ================================================================================ */
+
+static void NullDigitsTurnOff(void) {
+    sink = 0;
+}
+
+static void NullSegmentsUpdate(uint8_t segments) {
+    sink = segments;
+}
+
+static void NullDigitTurnOn(uint8_t digit) {
+    sink = digit;
+}
+
+static void BenchRefresh(const char * name, screen_t screen) {
+    struct timespec start, end;
+    double elapsed;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (unsigned long i = 0; i < ITERATIONS; i++) {
+        ScreenRefresh(screen);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    elapsed = (end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec);
+    printf("%-28s %8.2f ns/op\n", name, elapsed / ITERATIONS);
+}
+
+static void WriteTimeByDigits(screen_t screen, const uint8_t hours[2], const uint8_t minutes[2]) {
+    uint8_t digits[4];
+    uint8_t hh = (uint8_t)(hours[1] * 10u + hours[0]);
+    uint8_t mm = (uint8_t)(minutes[1] * 10u + minutes[0]);
+
+    digits[0] = (uint8_t)((hh / 10u) % 10u);
+    digits[1] = (uint8_t)(hh % 10u);
+    digits[2] = (uint8_t)((mm / 10u) % 10u);
+    digits[3] = (uint8_t)(mm % 10u);
+    ScreenWriteBCD(screen, digits, 4);
+}
+
+static void WriteTimeFused(screen_t screen, const uint8_t hours[2], const uint8_t minutes[2]) {
+    ScreenWriteTime(screen, hours, minutes);
+}
+
+static void BenchWriteTime(const char * name, void (*write)(screen_t, const uint8_t[2], const uint8_t[2]),
+                           uint32_t period) {
+    screen_t screen = ScreenCreate(4, &null_driver);
+    uint8_t hours[2] = {0, 0};
+    uint8_t minutes[2] = {0, 0};
+    uint32_t count = 0;
+    struct timespec start, end;
+    double elapsed;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (unsigned long i = 0; i < ITERATIONS; i++) {
+        write(screen, hours, minutes);
+        if (++count == period) {
+            count = 0;
+            if (++minutes[0] == 10) {
+                minutes[0] = 0;
+                if (++minutes[1] == 6) {
+                    minutes[1] = 0;
+                    hours[0] = (uint8_t)((hours[0] + 1) % 10);
+                }
+            }
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    elapsed = (end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec);
+    printf("%-28s %8.2f ns/op\n", name, elapsed / ITERATIONS);
+}
+
+static void RenderNormal(screen_t screen, const uint8_t hours[2], const uint8_t minutes[2], bool blink) {
+    ScreenSetBrightness(screen, 15);
+    ScreenWriteTime(screen, hours, minutes);
+    for (uint8_t i = 0; i < 4; i++) {
+        ScreenDisablePoint(screen, i);
+    }
+    DisplayFlashPoints(screen, 0, 3, 0);
+    if (blink) {
+        ScreenEnablePoint(screen, 1);
+    }
+    ScreenEnablePoint(screen, 0);
+    DisplayFlashDigit(screen, 0, 3, 0);
+    ScreenPublish(screen);
+}
+
+static void BenchRender(const char * name, bool keyed) {
+    screen_t screen = ScreenCreate(4, &null_driver);
+    uint8_t hours[2] = {0, 0};
+    uint8_t minutes[2] = {0, 0};
+    uint32_t last_key = 0xFFFFFFFFu;
+    bool blink = false;
+    struct timespec start, end;
+    double elapsed;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (unsigned long i = 0; i < ITERATIONS; i++) {
+        uint32_t key = ((uint32_t)hours[1] << 16) | ((uint32_t)hours[0] << 12) | ((uint32_t)minutes[1] << 8) |
+                       ((uint32_t)minutes[0] << 4) | blink;
+
+        if (!keyed || key != last_key) {
+            last_key = key;
+            RenderNormal(screen, hours, minutes, blink);
+        }
+        if ((i % RENDERS_PER_SECOND) == RENDERS_PER_SECOND - 1) {
+            blink = !blink;
+        }
+        if ((i % RENDERS_PER_MINUTE) == RENDERS_PER_MINUTE - 1) {
+            if (++minutes[0] == 10) {
+                minutes[0] = 0;
+                if (++minutes[1] == 6) {
+                    minutes[1] = 0;
+                    hours[0] = (uint8_t)((hours[0] + 1) % 10);
+                }
+            }
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    elapsed = (end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec);
+    printf("%-28s %8.2f ns/op\n", name, elapsed / ITERATIONS);
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,382 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Martin Nicolas Soria <soria.m.nicolas@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, disponiblestribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file bench_suite.c
+ ** @brief Suite de microbenchmarks de los caminos criticos del reloj, la pantalla y las entradas, con salida JSON.
+ **
+ ** Compila clock.c, screen.c y digital.c para el host contra el chip.h simulado de test/support. Cada benchmark se
+ ** corre RUNS veces de ITERATIONS operaciones y se informa la corrida mas rapida en nanosegundos por operacion: el
+ ** ruido del host (otros procesos, cambios de frecuencia) solo puede alargar una corrida, asi la minima es la que mas
+ ** se repite entre ejecuciones. Las operaciones se llaman por un puntero a funcion; call_overhead mide ese piso para
+ ** poder descontarlo. ClockSnooze solo tiene efecto con la alarma sonando, asi que se mide dentro de un ciclo completo
+ ** de alarma y posposicion.
+ **
+ ** Con --compare se lee una linea base escrita por la misma suite y se marca como regresion todo benchmark mas lento
+ ** que la tolerancia, con codigo de salida 1. Las lineas base solo son comparables en la misma maquina y con el mismo
+ ** compilador; en una maquina compartida conviene la tolerancia por omision, en una dedicada alcanza con un 5%.
+ **
+ **   bench_suite                                    JSON en la salida estandar
+ **   bench_suite --compare baseline.json [--tolerance 25]
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* El tipo del reloj de la aplicacion choca con el clock_t de time.h, se lo renombra solo en este archivo */
+#define clock_t app_clock_t
+#include "clock.h"
+#include "digital.h"
+#include "screen.h"
+#include "chip.h"
+
+/* === Macros definitions ========================================================================================== */
+
+#define ITERATIONS 500000UL // Operaciones de cada corrida
+#define RUNS       15       // Corridas de cada benchmark, despues de una de calentamiento; se informa la minima
+#define TOLERANCE  25.0     // Porcentaje de mas sobre la linea base que se acepta sin marcar regresion
+#define NAME_SIZE  48       // Largo maximo de los nombres, con el terminador
+#define INPUT_PORT 1        // Entrada de las teclas simuladas
+#define INPUT_BIT  4
+
+#define BENCH_NOINLINE __attribute__((noinline))
+
+/* === Private data type declarations ============================================================================== */
+
+//! Benchmark de la suite
+typedef struct bench_s {
+    const char * name;                 //!< Nombre en el JSON, que identifica al benchmark en la linea base
+    void (*setup)(void);               //!< Prepara el estado, NULL si no hace falta
+    void (*operation)(uint32_t index); //!< Operacion medida; recibe el numero de operacion
+} bench_t;
+
+//! Resultado de la linea base
+typedef struct baseline_s {
+    char name[NAME_SIZE]; //!< Nombre del benchmark
+    double ns_per_op;     //!< Tiempo por operacion
+} baseline_t;
+
+/* === Private function declarations =============================================================================== */
+
+static void NullDigitsTurnOff(void);
+static void NullSegmentsUpdate(uint8_t segments);
+static void NullDigitTurnOn(uint8_t digit);
+
+static void SetupClock(void);
+static void SetupScreenStatic(void);
+static void SetupScreenFlashDigits(void);
+static void SetupScreenFlashPoints(void);
+static void SetupScreenAttributes(void);
+
+static BENCH_NOINLINE void OpEmpty(uint32_t index);
+static BENCH_NOINLINE void OpClockNewTick(uint32_t index);
+static BENCH_NOINLINE void OpClockSetTime(uint32_t index);
+static BENCH_NOINLINE void OpClockSnoozeCycle(uint32_t index);
+static BENCH_NOINLINE void OpScreenRefresh(uint32_t index);
+static BENCH_NOINLINE void OpScreenWriteBCD(uint32_t index);
+static BENCH_NOINLINE void OpDigitalChanging(uint32_t index);
+static BENCH_NOINLINE void OpDigitalSteady(uint32_t index);
+
+/**
+ * @brief Corre un benchmark y devuelve su corrida mas rapida, en nanosegundos por operacion
+ */
+static double BenchRun(const bench_t * bench);
+
+/**
+ * @brief Lee una linea base escrita por esta suite
+ *
+ * @param path Archivo de la linea base
+ * @param count Cantidad de resultados leidos
+ * @return baseline_t* Resultados leidos, NULL si no se pudo abrir el archivo
+ */
+static baseline_t * BaselineLoad(const char * path, size_t * count);
+
+/**
+ * @brief Busca un benchmark en la linea base
+ *
+ * @return const baseline_t* Resultado de la linea base, NULL si no esta
+ */
+static const baseline_t * BaselineFind(const baseline_t * baseline, size_t count, const char * name);
+
+/* === Private variable definitions ================================================================================ */
+
+static const struct screen_driver_s null_driver = {
+    .DigitsTurnOff = NullDigitsTurnOff,
+    .SegmentsUpdate = NullSegmentsUpdate,
+    .DigitTurnOn = NullDigitTurnOn,
+};
+
+static const bench_t BENCHES[] = {
+    {"call_overhead", NULL, OpEmpty},
+    {"clock_new_tick", SetupClock, OpClockNewTick},
+    {"clock_set_time", SetupClock, OpClockSetTime},
+    {"clock_snooze_cycle", SetupClock, OpClockSnoozeCycle},
+    {"screen_refresh_static", SetupScreenStatic, OpScreenRefresh},
+    {"screen_refresh_flash_digits", SetupScreenFlashDigits, OpScreenRefresh},
+    {"screen_refresh_flash_digits_points", SetupScreenFlashPoints, OpScreenRefresh},
+    {"screen_refresh_attributes", SetupScreenAttributes, OpScreenRefresh},
+    {"screen_write_bcd", SetupScreenStatic, OpScreenWriteBCD},
+    {"digital_was_changed_toggling", NULL, OpDigitalChanging},
+    {"digital_was_changed_steady", NULL, OpDigitalSteady},
+};
+
+//! Horas que alterna clock_set_time y segundos previos a la alarma y a la alarma pospuesta de clock_snooze_cycle
+static const clock_time_t TIMES[] = {
+    {.time = {.seconds = {0, 0}, .minutes = {0, 3}, .hours = {2, 1}}},
+    {.time = {.seconds = {9, 5}, .minutes = {9, 5}, .hours = {3, 2}}},
+    {.time = {.seconds = {9, 5}, .minutes = {9, 5}, .hours = {7, 0}}},
+    {.time = {.seconds = {9, 5}, .minutes = {4, 0}, .hours = {8, 0}}},
+};
+static const clock_time_t ALARM = {.time = {.seconds = {0, 0}, .minutes = {0, 0}, .hours = {8, 0}}};
+
+static clock_t clock_fast;
+static clock_t clock_second;
+static screen_t screen;
+static digital_input_t input;
+
+//! Destino de las escrituras y lecturas, para que el compilador no las elimine
+static volatile uint32_t sink;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Public function definitions ================================================================================= */
+
+int main(int argc, char * argv[]) {
+    const char * baseline_path = NULL;
+    double tolerance = TOLERANCE;
+    baseline_t * baseline = NULL;
+    size_t baseline_count = 0;
+    int regressions = 0;
+
+    for (int arg = 1; arg < argc; arg++) {
+        if (strcmp(argv[arg], "--compare") == 0 && arg + 1 < argc) {
+            baseline_path = argv[++arg];
+        } else if (strcmp(argv[arg], "--tolerance") == 0 && arg + 1 < argc) {
+            tolerance = atof(argv[++arg]);
+        } else {
+            fprintf(stderr, "usage: %s [--compare baseline.json] [--tolerance percent]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (baseline_path) {
+        baseline = BaselineLoad(baseline_path, &baseline_count);
+        if (!baseline) {
+            fprintf(stderr, "cannot read %s\n", baseline_path);
+            return 2;
+        }
+    }
+
+    /* Con un tick por segundo cada tick cambia de segundo, asi la alarma se dispara en un solo tick */
+    clock_fast = ClockCreate(1000, 5);
+    clock_second = ClockCreate(1, 5);
+    screen = ScreenCreate(4, &null_driver);
+    input = DigitalInputCreate(INPUT_PORT, INPUT_BIT, false);
+
+    printf("{\n  \"unit\": \"ns/op\",\n  \"iterations\": %lu,\n  \"runs\": %d,\n  \"benchmarks\": [\n",
+           (unsigned long)ITERATIONS, RUNS);
+    for (size_t index = 0; index < sizeof(BENCHES) / sizeof(BENCHES[0]); index++) {
+        const bench_t * bench = &BENCHES[index];
+        double result = BenchRun(bench);
+        const char * separator = (index + 1 < sizeof(BENCHES) / sizeof(BENCHES[0])) ? "," : "";
+
+        if (!baseline) {
+            printf("    {\"name\": \"%s\", \"ns_per_op\": %.3f}%s\n", bench->name, result, separator);
+        } else {
+            const baseline_t * reference = BaselineFind(baseline, baseline_count, bench->name);
+
+            if (!reference || reference->ns_per_op <= 0) {
+                printf("    {\"name\": \"%s\", \"ns_per_op\": %.3f, \"baseline\": null, \"regression\": false}%s\n",
+                       bench->name, result, separator);
+            } else {
+                double ratio = result / reference->ns_per_op;
+                bool regression = ratio > 1.0 + tolerance / 100.0;
+
+                regressions += regression;
+                printf("    {\"name\": \"%s\", \"ns_per_op\": %.3f, \"baseline\": %.3f, \"ratio\": %.3f, "
+                       "\"regression\": %s}%s\n",
+                       bench->name, result, reference->ns_per_op, ratio, regression ? "true" : "false", separator);
+                if (regression) {
+                    fprintf(stderr, "REGRESSION %s: %.3f ns/op vs %.3f baseline (+%.1f%%)\n", bench->name, result,
+                            reference->ns_per_op, 100.0 * (ratio - 1.0));
+                }
+            }
+        }
+    }
+    printf("  ]\n}\n");
+
+    free(baseline);
+    return regressions ? 1 : 0;
+}
+
+/* === Private function definitions ================================================================================ */
+
+static void NullDigitsTurnOff(void) {
+    sink = 0;
+}
+
+static void NullSegmentsUpdate(uint8_t segments) {
+    sink = segments;
+}
+
+static void NullDigitTurnOn(uint8_t digit) {
+    sink = digit;
+}
+
+static void SetupClock(void) {
+    ClockSetTime(clock_fast, &TIMES[0]);
+    ClockSetAlarm(clock_second, &ALARM);
+}
+
+static void SetupScreenStatic(void) {
+    uint8_t value[4] = {1, 2, 3, 4};
+
+    screen = ScreenCreate(4, &null_driver);
+    ScreenWriteBCD(screen, value, 4);
+    ScreenPublish(screen);
+}
+
+static void SetupScreenFlashDigits(void) {
+    SetupScreenStatic();
+    DisplayFlashDigit(screen, 2, 3, 20);
+    ScreenPublish(screen);
+}
+
+static void SetupScreenFlashPoints(void) {
+    SetupScreenStatic();
+    ScreenEnablePoint(screen, 1);
+    DisplayFlashDigit(screen, 0, 3, 20);
+    DisplayFlashPoints(screen, 0, 3, 20);
+    ScreenPublish(screen);
+}
+
+static void SetupScreenAttributes(void) {
+    SetupScreenStatic();
+    ScreenSetAttributes(screen, 0, 0, SCREEN_ATTR_BLINK | SCREEN_ATTR_POINT);
+    ScreenSetAttributes(screen, 2, 3, SCREEN_ATTR_BLINK);
+    ScreenSetAttributes(screen, 1, 1, SCREEN_ATTR_POINT | SCREEN_ATTR_POINT_BLINK);
+    DisplayFlashPoints(screen, 1, 1, 20);
+    ScreenPublish(screen);
+}
+
+static BENCH_NOINLINE void OpEmpty(uint32_t index) {
+    sink = index;
+}
+
+static BENCH_NOINLINE void OpClockNewTick(uint32_t index) {
+    (void)index;
+    ClockNewTick(clock_fast);
+}
+
+static BENCH_NOINLINE void OpClockSetTime(uint32_t index) {
+    sink = ClockSetTime(clock_fast, &TIMES[index & 1]);
+}
+
+static BENCH_NOINLINE void OpClockSnoozeCycle(uint32_t index) {
+    (void)index;
+    /* ClockSnooze solo actua con la alarma sonando y deja pendiente la posposicion, por lo que cada vuelta dispara la
+     * alarma, la pospone y deja pasar la posposicion: dos ClockSetTime, dos ClockNewTick y un ClockSnooze */
+    ClockSetTime(clock_second, &TIMES[2]);
+    ClockNewTick(clock_second);
+    ClockSnooze(clock_second);
+    ClockSetTime(clock_second, &TIMES[3]);
+    ClockNewTick(clock_second);
+}
+
+static BENCH_NOINLINE void OpScreenRefresh(uint32_t index) {
+    (void)index;
+    ScreenRefresh(screen);
+}
+
+static BENCH_NOINLINE void OpScreenWriteBCD(uint32_t index) {
+    uint8_t value[4] = {(uint8_t)(index % 10), (uint8_t)(index / 10 % 10), (uint8_t)(index / 100 % 10), 0};
+
+    ScreenWriteBCD(screen, value, 4);
+}
+
+static BENCH_NOINLINE void OpDigitalChanging(uint32_t index) {
+    ChipFakeSetPin(INPUT_PORT, INPUT_BIT, (index & 1) != 0);
+    sink = DigitalWasChanged(input);
+}
+
+static BENCH_NOINLINE void OpDigitalSteady(uint32_t index) {
+    (void)index;
+    sink = DigitalWasChanged(input);
+}
+
+static double BenchRun(const bench_t * bench) {
+    double best = 0;
+
+    for (int run = -1; run < RUNS; run++) {
+        double result;
+        struct timespec start, end;
+
+        if (bench->setup) {
+            bench->setup();
+        }
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (uint32_t index = 0; index < ITERATIONS; index++) {
+            bench->operation(index);
+        }
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        result = ((end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec)) / ITERATIONS;
+        /* La corrida -1 es de calentamiento y no cuenta */
+        if (run == 0 || (run > 0 && result < best)) {
+            best = result;
+        }
+    }
+    return best;
+}
+
+static baseline_t * BaselineLoad(const char * path, size_t * count) {
+    FILE * file = fopen(path, "r");
+    baseline_t * baseline;
+    char line[256];
+
+    *count = 0;
+    if (!file) {
+        return NULL;
+    }
+    baseline = calloc(sizeof(BENCHES) / sizeof(BENCHES[0]) * 2, sizeof(baseline_t));
+    /* Cada benchmark ocupa una linea del JSON que escribe la suite, asi alcanza con leer linea por linea */
+    while (baseline && *count < sizeof(BENCHES) / sizeof(BENCHES[0]) * 2 && fgets(line, sizeof(line), file)) {
+        baseline_t * entry = &baseline[*count];
+
+        if (sscanf(line, " {\"name\": \"%47[^\"]\", \"ns_per_op\": %lf", entry->name, &entry->ns_per_op) == 2) {
+            (*count)++;
+        }
+    }
+    fclose(file);
+    return baseline;
+}
+
+static const baseline_t * BaselineFind(const baseline_t * baseline, size_t count, const char * name) {
+    for (size_t index = 0; index < count; index++) {
+        if (strcmp(baseline[index].name, name) == 0) {
+            return &baseline[index];
+        }
+    }
+    return NULL;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,307 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Martin Nicolas Soria <soria.m.nicolas@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, disponiblestribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file sim_cyclic.c
+ ** @brief Comparacion en el host del ejecutivo ciclico contra las tres tareas de FreeRTOS.
+ **
+ ** Los trabajos de app.c necesitan FreeRTOS y la placa, asi que aca corren sustitutos que llaman a los mismos
+ ** modulos que JobClock, JobButtons y JobUI: el reloj, seis teclas sobre los registros simulados y la escritura y
+ ** publicacion de la hora. Los periodos, las pilas y la tabla de marcos son los de app_schedule.h, que usa main.c, y
+ ** el ejecutivo ciclico corre con cyclic.c. Las tareas se emulan con un contexto ucontext por tarea y un planificador
+ ** de prioridades fijas, asi cada activacion paga dos cambios de contexto reales del host. Ninguno de los dos modos
+ ** incluye la interrupcion que marca el tiempo, que existe en ambos. La latencia es el tiempo desde el comienzo del
+ ** milisegundo hasta que termina cada trabajo.
+ **
+ ** La RAM de cada modo es la de las pilas: con tareas, la de cada tarea de main.c mas la ociosa y los bloques de
+ ** control; con el ejecutivo ciclico, la pila de main, que debe alojar al trabajo mas profundo y se estima con la
+ ** pila de su tarea. Ademas se mide en el host la profundidad que alcanza cada sustituto en su contexto.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#define _XOPEN_SOURCE 700
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <ucontext.h>
+
+/* El tipo del reloj de la aplicacion choca con el clock_t de time.h, se lo renombra solo en este archivo */
+#define clock_t app_clock_t
+#include "app_schedule.h"
+#include "clock.h"
+#include "cyclic.h"
+#include "digital.h"
+#include "screen.h"
+#include "chip.h"
+
+/* === Macros definitions ========================================================================================== */
+
+#define SIM_TICKS 1000000 // Milisegundos simulados en cada modo
+
+#define TASKS            3     // Tareas de la aplicacion
+#define TASK_STACK_BYTES 16384 // Pila de cada contexto del host
+#define STACK_PAINT      0xA5  // Relleno de las pilas del host para medir su profundidad
+#define IDLE_STACK_WORDS 128   // configMINIMAL_STACK_SIZE, pila de la tarea ociosa
+#define RTOS_TCBS        4     // Bloques de control de las tareas, incluida la ociosa
+#define TCB_BYTES        92    // Tamaño aproximado de StaticTask_t en el Cortex-M4
+
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
+
+//! Pilas de main.c mas la tarea ociosa, en palabras
+#define RTOS_STACK_WORDS (APP_CLOCK_STACK + APP_BUTTONS_STACK + APP_UI_STACK + IDLE_STACK_WORDS)
+
+//! Pila de main con el ejecutivo ciclico: la de la tarea mas profunda, porque los trabajos corren uno tras otro
+#define CYCLIC_STACK_WORDS MAX(APP_CLOCK_STACK, MAX(APP_BUTTONS_STACK, APP_UI_STACK))
+
+/* === Private data type declarations ============================================================================== */
+
+//! Resultados de un trabajo
+typedef struct job_stats_s {
+    const char * name; //!< Nombre del trabajo
+    double worst_ns;   //!< Latencia maxima
+    double total_ns;   //!< Suma de las latencias, para el promedio
+    uint32_t runs;     //!< Cantidad de ejecuciones
+} job_stats_t;
+
+/* === Private function declarations =============================================================================== */
+
+static void JobClock(void);
+static void JobButtons(void);
+static void JobUI(void);
+
+/**
+ * @brief Devuelve el tiempo monotono del host en nanosegundos
+ */
+static double Now(void);
+
+/**
+ * @brief Registra la latencia de un trabajo que acaba de terminar
+ *
+ * @param job Indice del trabajo
+ */
+static void JobDone(uint8_t job);
+
+/**
+ * @brief Cuerpo de una tarea emulada: corre su trabajo y vuelve al planificador, indefinidamente
+ *
+ * @param job Indice del trabajo
+ */
+static void TaskBody(int job);
+
+/**
+ * @brief Simula SIM_TICKS milisegundos con el ejecutivo ciclico
+ *
+ * @return double Tiempo ocupado del host, en nanosegundos
+ */
+static double SimulateCyclic(void);
+
+/**
+ * @brief Simula SIM_TICKS milisegundos con tareas de prioridad fija
+ *
+ * @return double Tiempo ocupado del host, en nanosegundos
+ */
+static double SimulateTasks(void);
+
+/**
+ * @brief Imprime los resultados de un modo y reinicia las estadisticas
+ *
+ * @param mode Nombre del modo
+ * @param busy_ns Tiempo ocupado
+ * @param ram_bytes RAM propia del modo
+ */
+static void Report(const char * mode, double busy_ns, uint32_t ram_bytes);
+
+/**
+ * @brief Devuelve los bytes de la pila del host de una tarea emulada que llego a usar su trabajo
+ *
+ * @param job Indice del trabajo
+ */
+static uint32_t StackDepth(int job);
+
+/* === Private variable definitions ================================================================================ */
+
+static const cyclic_job_t JOBS[] = {JobClock, JobButtons, JobUI};
+
+static const uint32_t FRAMES[APP_FRAME_COUNT] = APP_FRAMES;
+
+static const cyclic_schedule_t SCHEDULE = {
+    .jobs = JOBS,
+    .job_count = sizeof(JOBS) / sizeof(JOBS[0]),
+    .frames = FRAMES,
+    .frame_count = sizeof(FRAMES) / sizeof(FRAMES[0]),
+};
+
+static const struct screen_driver_s null_driver = {0};
+
+static clock_t sim_clock;
+static screen_t sim_screen;
+static digital_input_t keys[6];
+
+//! Comienzo del milisegundo en curso
+static double tick_start;
+
+static job_stats_t stats[TASKS] = {{"clock", 0, 0, 0}, {"buttons", 0, 0, 0}, {"ui", 0, 0, 0}};
+
+static ucontext_t scheduler_context;
+static ucontext_t task_context[TASKS];
+static char task_stack[TASKS][TASK_STACK_BYTES];
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Public function definitions ================================================================================= */
+
+int main(void) {
+    clock_time_t start = {.time = {.seconds = {0, 0}, .minutes = {0, 0}, .hours = {2, 1}}};
+
+    sim_clock = ClockCreate(1000, 5);
+    ClockSetTime(sim_clock, &start);
+    sim_screen = ScreenCreate(4, &null_driver);
+    for (uint8_t i = 0; i < 6; i++) {
+        keys[i] = DigitalInputCreate(5, (uint8_t)(8 + i), false);
+    }
+
+    uint32_t deepest = 0;
+
+    Report("cyclic", SimulateCyclic(), CYCLIC_STACK_WORDS * 4);
+    Report("freertos", SimulateTasks(), RTOS_STACK_WORDS * 4 + RTOS_TCBS * TCB_BYTES);
+    printf("host stack depth");
+    for (int job = 0; job < TASKS; job++) {
+        printf("  %s %lu", stats[job].name, (unsigned long)StackDepth(job));
+        deepest = MAX(deepest, StackDepth(job));
+    }
+    printf("  bytes, cyclic main stack %lu bytes\n", (unsigned long)deepest);
+    return 0;
+}
+
+/* === Private function definitions ================================================================================ */
+
+static void JobClock(void) {
+    ClockNewTick(sim_clock);
+    JobDone(0);
+}
+
+static void JobButtons(void) {
+    volatile bool any = DigitalInputGetIsActive(keys[0]) || DigitalInputGetIsActive(keys[1]);
+
+    for (uint8_t i = 2; i < 6; i++) {
+        any = DigitalWasActive(keys[i]) || any;
+    }
+    JobDone(1);
+}
+
+static void JobUI(void) {
+    clock_time_t now;
+
+    ClockGetTime(sim_clock, &now);
+    ScreenWriteTime(sim_screen, now.time.hours, now.time.minutes);
+    ScreenPublish(sim_screen);
+    JobDone(2);
+}
+
+static double Now(void) {
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1e9 + now.tv_nsec;
+}
+
+static void JobDone(uint8_t job) {
+    double latency = Now() - tick_start;
+
+    if (latency > stats[job].worst_ns) {
+        stats[job].worst_ns = latency;
+    }
+    stats[job].total_ns += latency;
+    stats[job].runs++;
+}
+
+static void TaskBody(int job) {
+    for (;;) {
+        JOBS[job]();
+        /* vTaskDelay: la tarea se bloquea y vuelve el planificador */
+        swapcontext(&task_context[job], &scheduler_context);
+    }
+}
+
+static double SimulateCyclic(void) {
+    cyclic_t executive = CyclicCreate(&SCHEDULE);
+    double busy = 0;
+
+    for (uint32_t tick = 0; tick < SIM_TICKS; tick++) {
+        tick_start = Now();
+        CyclicTick(executive);
+        CyclicRunPending(executive);
+        busy += Now() - tick_start;
+    }
+    return busy;
+}
+
+static double SimulateTasks(void) {
+    static const uint8_t PERIODS[TASKS] = {APP_CLOCK_PERIOD_MS, APP_BUTTONS_PERIOD_MS, APP_UI_PERIOD_MS};
+    volatile double busy = 0; // Volatil porque swapcontext vuelve como setjmp
+
+    for (int job = 0; job < TASKS; job++) {
+        memset(task_stack[job], STACK_PAINT, sizeof(task_stack[job]));
+        getcontext(&task_context[job]);
+        task_context[job].uc_stack.ss_sp = task_stack[job];
+        task_context[job].uc_stack.ss_size = sizeof(task_stack[job]);
+        task_context[job].uc_link = &scheduler_context;
+        makecontext(&task_context[job], (void (*)(void))TaskBody, 1, job);
+    }
+
+    for (uint32_t tick = 0; tick < SIM_TICKS; tick++) {
+        tick_start = Now();
+        /* Las tareas listas corren en orden de prioridad: reloj, botones e interfaz; las tres son mas cortas que
+         * un tick, por lo que ninguna es desalojada a mitad de su trabajo */
+        for (int job = 0; job < TASKS; job++) {
+            if ((tick % PERIODS[job]) == 0) {
+                swapcontext(&scheduler_context, &task_context[job]);
+            }
+        }
+        busy += Now() - tick_start;
+    }
+    return busy;
+}
+
+static void Report(const char * mode, double busy_ns, uint32_t ram_bytes) {
+    printf("%-10s load %6.3f%%  stack RAM %5lu bytes\n", mode, 100.0 * busy_ns / (SIM_TICKS * 1e6),
+           (unsigned long)ram_bytes);
+    for (int job = 0; job < TASKS; job++) {
+        printf("  %-8s latency mean %8.1f ns  worst %10.1f ns\n", stats[job].name,
+               stats[job].total_ns / stats[job].runs, stats[job].worst_ns);
+        stats[job].worst_ns = 0;
+        stats[job].total_ns = 0;
+        stats[job].runs = 0;
+    }
+}
+
+static uint32_t StackDepth(int job) {
+    uint32_t unused = 0;
+
+    /* La pila crece hacia las direcciones bajas, el relleno que queda al principio nunca se uso */
+    while (unused < TASK_STACK_BYTES && (uint8_t)task_stack[job][unused] == STACK_PAINT) {
+        unused++;
+    }
+    return TASK_STACK_BYTES - unused;
+}
+
+/* === End of documentation ======================================================================================== */
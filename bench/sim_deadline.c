@@ -0,0 +1,236 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Martin Nicolas Soria <soria.m.nicolas@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, disponiblestribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+
+/** @file sim_deadline.c
+ ** @brief Simulacion en el host del monitor de plazos y del perro guardian con las tareas de app.c.
+ **
+ ** Un planificador virtual de prioridades fijas con desalojo avanza de a un microsegundo, en las mismas unidades que
+ ** BSP_COUNTER_HZ, y libera cada tarea en multiplos exactos de su periodo como vTaskDelayUntil. Las duraciones de
+ ** los trabajos son estimaciones para la placa y no mediciones del host. Cada tarea informa sus vueltas a deadline.c
+ ** igual que las tareas de app.c y la tarea de botones alimenta el perro guardian solo si DeadlineAllMet lo permite.
+ ** Cada escenario agrega una perturbacion: un dibujo largo de la interfaz, una interrupcion de mas prioridad que todas
+ ** las tareas o una interfaz que se cuelga. Si una tarea se cuelga, la simulacion falla si no es esa la primera tarea
+ ** que el monitor informa con un plazo vencido.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdio.h>
+#include <stdint.h>
+#include "deadline.h"
+
+/* === Macros definitions ========================================================================================== */
+
+#define SIM_US      60000000 // Microsegundos simulados en cada escenario
+#define WATCHDOG_US 2000000  // Tiempo sin alimentar hasta el reinicio, igual a APP_WATCHDOG_MS
+
+#define TASKS        3 // Tareas monitoreadas, en orden de prioridad decreciente como en main.c
+#define TASK_BUTTONS 1 // Tarea que alimenta el perro guardian
+#define HUNG         UINT32_MAX
+#define NO_TASK      UINT8_MAX
+
+/* === Private data type declarations ============================================================================== */
+
+//! Carga periodica de un trabajo
+typedef struct load_s {
+    uint32_t period; //!< Periodo en microsegundos
+    uint32_t cost;   //!< Duracion normal de cada vuelta
+    uint32_t every;  //!< Cada cuanto una vuelta dura extra, 0 si nunca
+    uint32_t extra;  //!< Duracion de esas vueltas, HUNG si la tarea no termina mas
+} load_t;
+
+//! Escenario simulado
+typedef struct scenario_s {
+    const char * name; //!< Nombre del escenario
+    load_t tasks[TASKS];
+    load_t interference; //!< Carga de mas prioridad que las tareas y sin monitoreo, periodo 0 si no hay
+} scenario_t;
+
+//! Estado de una tarea en el planificador virtual
+typedef struct sim_task_s {
+    uint32_t wake;      //!< Proxima liberacion, como la que calcula vTaskDelayUntil
+    uint32_t remaining; //!< Trabajo pendiente de la vuelta en curso
+    bool ready;         //!< La vuelta fue liberada y no termino
+    bool started;       //!< La vuelta ya informo su liberacion
+} sim_task_t;
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Devuelve la duracion de la vuelta de una carga que se libera en un instante
+ */
+static uint32_t Cost(const load_t * load, uint32_t release);
+
+/**
+ * @brief Registra la primera tarea que el monitor informa con un plazo vencido
+ */
+static void Missed(uint8_t task, uint32_t lateness);
+
+/**
+ * @brief Simula un escenario e imprime sus resultados
+ *
+ * @return false si el escenario tiene una tarea colgada y el monitor no la informa primero con un plazo vencido
+ */
+static bool Simulate(const scenario_t * scenario);
+
+/* === Private variable definitions ================================================================================ */
+
+static const char * const NAMES[TASKS] = {"clock", "buttons", "ui"};
+
+//! Reloj de 1 ms, botones de 20 ms e interfaz de 5 ms de app.h
+static const scenario_t SCENARIOS[] = {
+    {"nominal", {{1000, 15, 0, 0}, {20000, 40, 0, 0}, {5000, 180, 0, 0}}, {0, 0, 0, 0}},
+    {"long ui render", {{1000, 15, 0, 0}, {20000, 40, 0, 0}, {5000, 180, 500000, 7000}}, {0, 0, 0, 0}},
+    {"isr interference", {{1000, 15, 0, 0}, {20000, 40, 0, 0}, {5000, 180, 0, 0}}, {250000, 1500, 0, 0}},
+    {"hung ui", {{1000, 15, 0, 0}, {20000, 40, 0, 0}, {5000, 180, 10000000, HUNG}}, {0, 0, 0, 0}},
+};
+
+//! Primera tarea informada con un plazo vencido en el escenario en curso
+static uint8_t first_missed;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Public function definitions ================================================================================= */
+
+int main(void) {
+    int result = 0;
+
+    for (uint32_t index = 0; index < sizeof(SCENARIOS) / sizeof(SCENARIOS[0]); index++) {
+        if (!Simulate(&SCENARIOS[index])) {
+            result = 1;
+        }
+    }
+    return result;
+}
+
+/* === Private function definitions ================================================================================ */
+
+static uint32_t Cost(const load_t * load, uint32_t release) {
+    if (load->every && release > 0 && (release % load->every) == 0) {
+        return load->extra;
+    }
+    return load->cost;
+}
+
+static void Missed(uint8_t task, uint32_t lateness) {
+    (void)lateness;
+    if (first_missed == NO_TASK) {
+        first_missed = task;
+    }
+}
+
+static bool Simulate(const scenario_t * scenario) {
+    deadline_t monitor;
+    sim_task_t tasks[TASKS] = {0};
+    uint8_t hung = NO_TASK;
+    uint32_t interference = 0;
+    uint32_t feeds = 0;
+    uint32_t withheld = 0;
+    uint32_t last_feed = 0;
+    uint32_t worst_gap = 0;
+    uint32_t reset_at = 0;
+
+    first_missed = NO_TASK;
+    monitor = DeadlineCreate(Missed);
+    for (uint8_t task = 0; task < TASKS; task++) {
+        if (scenario->tasks[task].extra == HUNG) {
+            hung = task;
+        }
+        DeadlineDeclare(monitor, task, scenario->tasks[task].period, scenario->tasks[task].period);
+    }
+
+    for (uint32_t now = 0; now < SIM_US && reset_at == 0; now++) {
+        const load_t * load = &scenario->interference;
+
+        if (load->period && (now % load->period) == 0 && now > 0) {
+            interference += load->cost;
+        }
+        for (uint8_t task = 0; task < TASKS; task++) {
+            if (!tasks[task].ready && now >= tasks[task].wake) {
+                tasks[task].ready = true;
+                tasks[task].started = false;
+                tasks[task].remaining = Cost(&scenario->tasks[task], tasks[task].wake);
+            }
+        }
+        if (now - last_feed > WATCHDOG_US) {
+            reset_at = now;
+        }
+
+        /* La interrupcion desaloja a todas las tareas; si no, corre la tarea lista de mas prioridad */
+        if (interference > 0) {
+            interference--;
+            continue;
+        }
+        for (uint8_t task = 0; task < TASKS; task++) {
+            sim_task_t * state = &tasks[task];
+
+            if (!state->ready) {
+                continue;
+            }
+            if (!state->started) {
+                DeadlineRelease(monitor, task, now);
+                state->started = true;
+            }
+            if (state->remaining != HUNG && --state->remaining == 0) {
+                DeadlineComplete(monitor, task, now + 1);
+                state->ready = false;
+                state->wake += scenario->tasks[task].period;
+                if (task == TASK_BUTTONS) {
+                    if (DeadlineAllMet(monitor, now + 1)) {
+                        if (now + 1 - last_feed > worst_gap) {
+                            worst_gap = now + 1 - last_feed;
+                        }
+                        last_feed = now + 1;
+                        feeds++;
+                    } else {
+                        withheld++;
+                    }
+                }
+            }
+            break;
+        }
+    }
+
+    printf("%s\n", scenario->name);
+    for (uint8_t task = 0; task < TASKS; task++) {
+        printf("  %-8s misses %6lu  jitter us", NAMES[task], (unsigned long)DeadlineGetMisses(monitor, task));
+        for (uint8_t bin = 0; bin < DEADLINE_BINS; bin++) {
+            printf(" %s%u:%lu", bin == DEADLINE_BINS - 1 ? ">=" : "<", DEADLINE_JITTER_BASE << (bin < DEADLINE_BINS - 1
+                   ? bin : bin - 1), (unsigned long)DeadlineGetJitter(monitor, task, bin));
+        }
+        printf("\n");
+    }
+    printf("  watchdog feeds %lu  withheld %lu  worst gap %.1f ms  ", (unsigned long)feeds, (unsigned long)withheld,
+           worst_gap / 1000.0);
+    if (reset_at) {
+        printf("reset at %.3f s\n", reset_at / 1e6);
+    } else {
+        printf("no reset\n");
+    }
+    if (hung != NO_TASK && (first_missed != hung || DeadlineGetMisses(monitor, hung) == 0)) {
+        printf("  FAIL: %s hung but the first task reported missing its deadline was %s\n", NAMES[hung],
+               first_missed == NO_TASK ? "none" : NAMES[first_missed]);
+        return false;
+    }
+    return true;
+}
+
+/* === End of documentation ======================================================================================== */
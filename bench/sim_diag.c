@@ -0,0 +1,243 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Martin Nicolas Soria <soria.m.nicolas@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, disponiblestribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file sim_diag.c
+ ** @brief Volcado en JSON de las estadisticas de ejecucion de las tareas simuladas en el host.
+ **
+ ** Emula las tres tareas con un contexto ucontext cada una, como sim_cyclic.c, con los mismos trabajos sobre los
+ ** modulos reales. Cada tick simulado dura 1 ms de tiempo virtual; el tiempo de ejecucion de cada tarea es el que
+ ** mide el reloj del host mas una carga fija por vuelta, LOAD_NS, y el resto del tick se cuenta como de la tarea
+ ** ociosa. Sin la carga los trabajos del host duran decenas de nanosegundos y todas las tareas redondean a 0% de
+ ** CPU; con ella cada una ocupa una parte conocida del tick, y la simulacion termina con error si alguna no aparece
+ ** en las estadisticas. Las pilas se pintan con un patron
+ ** antes de arrancar y la pila libre es lo que queda sin tocar, igual que uxTaskGetStackHighWaterMark. Los contadores
+ ** se pasan a diag.c en nanosegundos y no en los microsegundos de BSP_COUNTER_HZ, porque en el host los trabajos
+ ** duran menos de un microsegundo; las muestras de un segundo entran en el desborde de 32 bits. El heap libre es el
+ ** que deja el modo dinamico de main.c despues de crear las tareas.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#define _XOPEN_SOURCE 700
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <ucontext.h>
+
+/* El tipo del reloj de la aplicacion choca con el clock_t de time.h, se lo renombra solo en este archivo */
+#define clock_t app_clock_t
+#include "clock.h"
+#include "diag.h"
+#include "digital.h"
+#include "screen.h"
+#include "chip.h"
+
+/* === Macros definitions ========================================================================================== */
+
+#define SIM_TICKS      10000 // Milisegundos simulados
+#define SAMPLE_TICKS   1000  // Periodo de las muestras, igual al del modo de diagnostico de app.c
+#define BUTTONS_PERIOD 20    // Periodos de app.h, en milisegundos
+#define UI_PERIOD      5
+
+#define TASKS        3        // Tareas de la aplicacion; la ociosa es la cuarta de las estadisticas
+#define STACK_BYTES  16384    // Pila de cada contexto del host
+#define STACK_PAINT  0xA5     // Patron con que se pintan las pilas
+#define HEAP_BYTES   (16 * 1024)                       // configTOTAL_HEAP_SIZE
+#define HEAP_USED    ((256 + 256 + 512 + 128) * 4 + 4 * 92) // Pilas y TCB de main.c y de la tarea ociosa
+#define NS_PER_TICK  1000000u // Tiempo virtual de un tick
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+static void JobClock(void);
+static void JobButtons(void);
+static void JobUI(void);
+
+/**
+ * @brief Devuelve el tiempo monotono del host en nanosegundos
+ */
+static uint64_t Now(void);
+
+/**
+ * @brief Cuerpo de una tarea emulada: corre su trabajo, mide la vuelta y vuelve al planificador
+ *
+ * @param task Indice de la tarea
+ */
+static void TaskBody(int task);
+
+/**
+ * @brief Calcula la pila que una tarea nunca uso, en palabras de 32 bits
+ *
+ * @param task Indice de la tarea
+ */
+static uint32_t StackFree(int task);
+
+/**
+ * @brief Verifica que la ultima muestra asigna CPU a cada tarea de la aplicacion y no toda a la ociosa
+ *
+ * @return true Si todas las tareas tienen un uso distinto de cero
+ */
+static bool SharesShown(void);
+
+/* === Private variable definitions ================================================================================ */
+
+static const char * const NAMES[TASKS + 1] = {"clk", "keys", "ui", "IDLE"};
+static void (*const JOBS[TASKS])(void) = {JobClock, JobButtons, JobUI};
+static const uint8_t PERIODS[TASKS] = {1, BUTTONS_PERIOD, UI_PERIOD};
+//! Carga de cada vuelta en tiempo virtual: 3% del reloj, 1% de las teclas y 8% de la interfaz
+static const uint32_t LOAD_NS[TASKS] = {30000, 200000, 400000};
+
+static const struct screen_driver_s null_driver = {0};
+
+static clock_t sim_clock;
+static screen_t sim_screen;
+static digital_input_t keys[6];
+static diag_t diag;
+
+//! Tiempo de ejecucion acumulado de cada tarea, en nanosegundos
+static uint64_t runtime[TASKS + 1];
+
+static ucontext_t scheduler_context;
+static ucontext_t task_context[TASKS];
+static unsigned char task_stack[TASKS][STACK_BYTES];
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Public function definitions ================================================================================= */
+
+int main(void) {
+    static char json[512];
+    clock_time_t start = {.time = {.seconds = {0, 0}, .minutes = {0, 0}, .hours = {2, 1}}};
+    volatile uint64_t busy = 0; // Volatil porque swapcontext vuelve como setjmp
+
+    sim_clock = ClockCreate(1000, 5);
+    ClockSetTime(sim_clock, &start);
+    sim_screen = ScreenCreate(4, &null_driver);
+    for (uint8_t i = 0; i < 6; i++) {
+        keys[i] = DigitalInputCreate(5, (uint8_t)(8 + i), false);
+    }
+    diag = DiagCreate(NAMES, TASKS + 1);
+
+    memset(task_stack, STACK_PAINT, sizeof(task_stack));
+    for (int task = 0; task < TASKS; task++) {
+        getcontext(&task_context[task]);
+        task_context[task].uc_stack.ss_sp = task_stack[task];
+        task_context[task].uc_stack.ss_size = sizeof(task_stack[task]);
+        task_context[task].uc_link = &scheduler_context;
+        makecontext(&task_context[task], (void (*)(void))TaskBody, 1, task);
+    }
+
+    for (uint32_t tick = 1; tick <= SIM_TICKS; tick++) {
+        uint64_t tick_busy = 0;
+
+        for (int task = 0; task < TASKS; task++) {
+            if (tick % PERIODS[task] == 0) {
+                uint64_t from = Now();
+                uint64_t used;
+
+                swapcontext(&scheduler_context, &task_context[task]);
+                used = Now() - from + LOAD_NS[task];
+                tick_busy += used;
+                runtime[task] += used;
+            }
+        }
+        busy += tick_busy;
+        runtime[TASKS] = (uint64_t)tick * NS_PER_TICK - busy;
+
+        if (tick % SAMPLE_TICKS == 0) {
+            for (int task = 0; task <= TASKS; task++) {
+                DiagTaskSample(diag, (uint8_t)task, (uint32_t)runtime[task],
+                               task < TASKS ? StackFree(task) : 0);
+            }
+            DiagSystemSample(diag, (uint32_t)((uint64_t)tick * NS_PER_TICK), HEAP_BYTES - HEAP_USED);
+        }
+    }
+
+    DiagWriteJson(diag, json, sizeof(json));
+    printf("%s\n", json);
+    return SharesShown() ? 0 : 1;
+}
+
+/* === Private function definitions ================================================================================ */
+
+static void JobClock(void) {
+    ClockNewTick(sim_clock);
+}
+
+static void JobButtons(void) {
+    volatile bool any = DigitalInputGetIsActive(keys[0]) || DigitalInputGetIsActive(keys[1]);
+
+    for (uint8_t i = 2; i < 6; i++) {
+        any = DigitalWasActive(keys[i]) || any;
+    }
+}
+
+static void JobUI(void) {
+    clock_time_t now;
+
+    ClockGetTime(sim_clock, &now);
+    ScreenWriteTime(sim_screen, now.time.hours, now.time.minutes);
+    ScreenPublish(sim_screen);
+}
+
+static uint64_t Now(void) {
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec;
+}
+
+static void TaskBody(int task) {
+    for (;;) {
+        uint64_t start = Now();
+        JOBS[task]();
+        DiagLoopTime(diag, (uint8_t)task, (uint32_t)(Now() - start) + LOAD_NS[task]);
+        /* vTaskDelay: la tarea se bloquea y vuelve el planificador */
+        swapcontext(&task_context[task], &scheduler_context);
+    }
+}
+
+static uint32_t StackFree(int task) {
+    uint32_t untouched = 0;
+
+    /* La pila crece hacia abajo, el patron intacto queda al comienzo del arreglo */
+    while (untouched < STACK_BYTES && task_stack[task][untouched] == STACK_PAINT) {
+        untouched++;
+    }
+    return untouched / 4;
+}
+
+static bool SharesShown(void) {
+    bool shown = DiagGetCpu(diag, TASKS) < 100;
+
+    for (int task = 0; task < TASKS; task++) {
+        if (DiagGetCpu(diag, (uint8_t)task) == 0) {
+            fprintf(stderr, "sim_diag: %s shows 0%% cpu\n", NAMES[task]);
+            shown = false;
+        }
+    }
+    return shown;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,238 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Martin Nicolas Soria <soria.m.nicolas@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, disponiblestribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file sim_sleep.c
+ ** @brief Simulacion en el host de un dia de la tarea de interfaz, con y sin apagado de la pantalla.
+ **
+ ** Reproduce el ciclo de TaskUI con refresco desde la tarea (un digito cada 5 ms) y el driver de bsp.c que escribe
+ ** cada digito con DigitCommit, contando las escrituras a registros GPIO y el tiempo de CPU del host por hora.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "screen.h"
+#include "sleep.h"
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define UI_PERIOD_MS    5               // Periodo de la tarea de interfaz
+#define RECHECK_MS      60000           // Periodo con que la tarea dormida revisa la ventana nocturna
+#define HOUR_MS         3600000UL       // Milisegundos de una hora
+#define DAY_HOURS       24              // Horas simuladas
+#define SLEEP_TIMEOUT   (10 * 60000UL)  // Apagado por inactividad, igual al de app.c
+#define NIGHT_FROM      (23 * 60)       // Comienzo de la ventana nocturna, igual al de app.c
+#define NIGHT_TO        (7 * 60)        // Fin de la ventana nocturna, igual al de app.c
+#define ALARM_FROM      (6 * HOUR_MS + 30 * 60000UL) // La alarma suena a las 06:30
+#define ALARM_TO        (6 * HOUR_MS + 32 * 60000UL) // y se cancela dos minutos despues
+
+#define COMMIT_WRITES   5 // Escrituras a registros de DigitCommit en bsp.c
+#define TURN_OFF_WRITES 3 // Escrituras a registros de DigitsTurnOff en bsp.c
+
+/* === Private data type declarations ============================================================================== */
+
+//! Resultados acumulados de una hora simulada
+typedef struct hour_stats_s {
+    uint32_t awake_ms;   //!< Tiempo con la pantalla encendida
+    uint32_t wakeups;    //!< Veces que se ejecuto la tarea de interfaz
+    uint32_t writes;     //!< Escrituras a registros GPIO
+    double cpu_ns;       //!< Tiempo de CPU del host
+} hour_stats_t;
+
+/* === Private function declarations =============================================================================== */
+
+static void CountDigitsTurnOff(void);
+static void CountSegmentsUpdate(uint8_t segments);
+static void CountDigitTurnOn(uint8_t digit);
+static void CountDigitCommit(uint8_t digit, uint8_t segments);
+
+/**
+ * @brief Compone y publica la hora como lo hace ui_render en modo normal
+ *
+ * @param screen Pantalla a actualizar
+ * @param now Milisegundos desde la medianoche
+ */
+static void Render(screen_t screen, uint32_t now);
+
+/**
+ * @brief Simula un dia de la tarea de interfaz con una politica de apagado
+ *
+ * @param policy Politica a usar
+ * @param stats Arreglo donde se acumulan los resultados de cada hora
+ */
+static void SimulateDay(sleep_t policy, hour_stats_t stats[DAY_HOURS]);
+
+/**
+ * @brief Imprime los totales de un dia simulado
+ *
+ * @param name Nombre de la simulacion
+ * @param stats Resultados de cada hora
+ */
+static void PrintTotals(const char * name, const hour_stats_t stats[DAY_HOURS]);
+
+/* === Private variable definitions ================================================================================ */
+
+static const struct screen_driver_s count_driver = {
+    .DigitsTurnOff = CountDigitsTurnOff,
+    .SegmentsUpdate = CountSegmentsUpdate,
+    .DigitTurnOn = CountDigitTurnOn,
+    .DigitCommit = CountDigitCommit,
+};
+
+//! Teclas simuladas, en milisegundos desde la medianoche
+static const uint32_t KEY_PRESSES[] = {
+    7 * HOUR_MS + 15 * 60000UL, 8 * HOUR_MS, 13 * HOUR_MS + 30 * 60000UL, 19 * HOUR_MS, 21 * HOUR_MS + 45 * 60000UL,
+    2 * HOUR_MS + 10 * 60000UL,
+};
+
+//! Escrituras a registros GPIO acumuladas por el driver
+static uint32_t gpio_writes;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Public function definitions ================================================================================= */
+
+int main(void) {
+    static hour_stats_t always[DAY_HOURS];
+    static hour_stats_t sleeping[DAY_HOURS];
+
+    SimulateDay(SleepCreate(0, 0, 0), always);
+    SimulateDay(SleepCreate(SLEEP_TIMEOUT, NIGHT_FROM, NIGHT_TO), sleeping);
+
+    printf("%-6s %10s %10s %12s %10s\n", "hour", "awake_s", "wakeups", "gpio_writes", "cpu_us");
+    for (int hour = 0; hour < DAY_HOURS; hour++) {
+        printf("%02d:00  %10lu %10lu %12lu %10.0f\n", hour, (unsigned long)sleeping[hour].awake_ms / 1000,
+               (unsigned long)sleeping[hour].wakeups, (unsigned long)sleeping[hour].writes,
+               sleeping[hour].cpu_ns / 1e3);
+    }
+    PrintTotals("always_on", always);
+    PrintTotals("sleep_policy", sleeping);
+    return 0;
+}
+
+/* === Private function definitions ================================================================================ */
+
+static void CountDigitsTurnOff(void) {
+    gpio_writes += TURN_OFF_WRITES;
+}
+
+static void CountSegmentsUpdate(uint8_t segments) {
+    (void)segments;
+    gpio_writes += 2;
+}
+
+static void CountDigitTurnOn(uint8_t digit) {
+    (void)digit;
+    gpio_writes += 1;
+}
+
+static void CountDigitCommit(uint8_t digit, uint8_t segments) {
+    (void)digit;
+    (void)segments;
+    gpio_writes += COMMIT_WRITES;
+}
+
+static void Render(screen_t screen, uint32_t now) {
+    uint32_t minute = now / 60000;
+    uint8_t hours[2] = {(uint8_t)(minute / 60 % 10), (uint8_t)(minute / 600)};
+    uint8_t minutes[2] = {(uint8_t)(minute % 60 % 10), (uint8_t)(minute % 60 / 10)};
+
+    ScreenWriteTime(screen, hours, minutes);
+    if ((now / 1000) % 2) {
+        ScreenEnablePoint(screen, 1);
+    } else {
+        ScreenDisablePoint(screen, 1);
+    }
+    ScreenPublish(screen);
+}
+
+static void SimulateDay(sleep_t policy, hour_stats_t stats[DAY_HOURS]) {
+    screen_t screen = ScreenCreate(4, &count_driver);
+    const uint32_t keys = sizeof(KEY_PRESSES) / sizeof(KEY_PRESSES[0]);
+    uint32_t now = 0;
+    bool asleep = false;
+    struct timespec start, end;
+    hour_stats_t * hour;
+    uint32_t next;
+
+    for (int i = 0; i < DAY_HOURS; i++) {
+        stats[i] = (hour_stats_t){0};
+    }
+
+    while (now < DAY_HOURS * HOUR_MS) {
+        hour = &stats[now / HOUR_MS];
+        gpio_writes = 0;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+
+        for (uint32_t i = 0; i < keys; i++) {
+            if (KEY_PRESSES[i] >= now && KEY_PRESSES[i] < now + UI_PERIOD_MS) {
+                SleepActivity(policy);
+            }
+        }
+        bool alarm = now >= ALARM_FROM && now < ALARM_TO;
+
+        hour->wakeups++;
+        if (SleepIsAwake(policy, now, (uint16_t)(now / 60000), alarm)) {
+            asleep = false;
+            Render(screen, now);
+            ScreenRefresh(screen);
+            hour->awake_ms += UI_PERIOD_MS;
+            next = now + UI_PERIOD_MS;
+        } else {
+            if (!asleep) {
+                ScreenSleep(screen);
+                asleep = true;
+            }
+            /* La tarea bloqueada solo vuelve por el periodo de revision, una tecla o la alarma */
+            next = now + RECHECK_MS;
+            for (uint32_t i = 0; i < keys; i++) {
+                if (KEY_PRESSES[i] > now && KEY_PRESSES[i] < next) {
+                    next = KEY_PRESSES[i] - KEY_PRESSES[i] % UI_PERIOD_MS;
+                }
+            }
+            if (ALARM_FROM > now && ALARM_FROM < next) {
+                next = ALARM_FROM;
+            }
+        }
+
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        hour->cpu_ns += (end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec);
+        hour->writes += gpio_writes;
+        now = next;
+    }
+}
+
+static void PrintTotals(const char * name, const hour_stats_t stats[DAY_HOURS]) {
+    hour_stats_t total = {0};
+
+    for (int hour = 0; hour < DAY_HOURS; hour++) {
+        total.awake_ms += stats[hour].awake_ms;
+        total.wakeups += stats[hour].wakeups;
+        total.writes += stats[hour].writes;
+        total.cpu_ns += stats[hour].cpu_ns;
+    }
+    printf("%-14s awake %5.1f h, %8.0f wakeups/h, %9.0f gpio_writes/h, %8.0f cpu_us/h\n", name,
+           total.awake_ms / (double)HOUR_MS, total.wakeups / (double)DAY_HOURS, total.writes / (double)DAY_HOURS,
+           total.cpu_ns / 1e3 / DAY_HOURS);
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,198 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Martin Nicolas Soria <soria.m.nicolas@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, disponiblestribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file sim_tickless.c
+ ** @brief Simulacion en el host de una semana del reloj con el tick suprimido mientras las tareas estan bloqueadas.
+ **
+ ** Reproduce los plazos de TaskClock, TaskButtons y TaskUI con APP_TICKLESS_IDLE sobre clock.c y sleep.c: el reloj
+ ** avanza con ClockAdvance en cada cambio de segundo, los botones se muestrean mas lento con la pantalla apagada y
+ ** la interfaz duerme hasta una tecla, la alarma o la revision de la ventana nocturna. Cada dia la alarma suena a las
+ ** 06:30 y una tecla la cancela dos minutos despues. Se compara la hora del reloj contra la cuenta de ticks en cada
+ ** despertar y se cuentan los despertares y los ticks suprimidos contra el tick fijo de 1 ms.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "clock.h"
+#include "sleep.h"
+#include <stdio.h>
+#include <stdint.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define DAY_MS          86400000UL // Milisegundos de un dia
+#define DAYS            7          // Dias simulados
+#define BUTTONS_PERIOD  20         // Periodos de app.h, en milisegundos
+#define BUTTONS_SLEEP   80
+#define UI_PERIOD       5
+#define RECHECK_MS      60000          // Revision de la ventana nocturna de TaskUI
+#define SLEEP_TIMEOUT   (10 * 60000UL) // Apagado por inactividad, igual al de app.c
+#define NIGHT_FROM      (23 * 60)      // Ventana nocturna, igual a la de app.c
+#define NIGHT_TO        (7 * 60)
+#define KEY_FROM        ((6 * 60 + 32) * 60000UL) // La tecla que cancela la alarma se pulsa a las 06:32
+#define KEY_MS          150                       // y se sostiene 150 ms
+#define MAX_SUPPRESSED  82 // Ticks que cubre la cuenta de 24 bits de SysTick a 204 MHz
+#define IDLE_BEFORE     2  // configEXPECTED_IDLE_TIME_BEFORE_SLEEP
+
+/* === Private data type declarations ============================================================================== */
+
+//! Resultados acumulados de un dia simulado
+typedef struct day_stats_s {
+    uint32_t wakeups;      //!< Despertares del procesador, por tareas o por rearmar SysTick
+    uint32_t idle_ticks;   //!< Ticks que el kernel suprime y suma con vTaskStepTick
+    uint32_t clock_runs;   //!< Ejecuciones de la tarea del reloj
+    uint32_t clock_errors; //!< Veces que la hora difirio de la cuenta de ticks
+    bool rang;             //!< Indica si la alarma sono en el dia
+    uint32_t alarm_late;   //!< Milisegundos entre las 06:30 y el encendido del indicador
+} day_stats_t;
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Devuelve los segundos del dia que marca el reloj
+ */
+static uint32_t ClockSeconds(clock_t clock);
+
+/**
+ * @brief Cuenta los despertares y los ticks suprimidos de un intervalo sin tareas listas
+ *
+ * @param stats Resultados del dia
+ * @param gap Ticks hasta la proxima tarea lista
+ */
+static void IdleGap(day_stats_t * stats, uint32_t gap);
+
+/* === Private variable definitions ================================================================================ */
+
+static const clock_time_t START = {.time = {.seconds = {0, 0}, .minutes = {0, 0}, .hours = {0, 0}}};
+static const clock_time_t ALARM = {.time = {.seconds = {0, 0}, .minutes = {0, 3}, .hours = {6, 0}}};
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Public function definitions ================================================================================= */
+
+int main(void) {
+    clock_t clock = ClockCreate(1000, 5);
+    sleep_t sleep = SleepCreate(SLEEP_TIMEOUT, NIGHT_FROM, NIGHT_TO);
+    day_stats_t days[DAYS] = {0};
+    uint64_t next_clock = 0, next_buttons = 0, next_ui = 0;
+    uint64_t last_clock = 0;
+    uint32_t now_ms = 0;
+    bool asleep = false, ringing = false, key_down = false;
+
+    ClockSetTime(clock, &START);
+    ClockSetAlarm(clock, &ALARM);
+
+    for (uint64_t tick = 0; tick < (uint64_t)DAYS * DAY_MS;) {
+        day_stats_t * stats = &days[tick / DAY_MS];
+        uint32_t day_ms = (uint32_t)(tick % DAY_MS);
+        bool wake_ui = false;
+
+        stats->wakeups++;
+        if (tick == next_clock) {
+            /* TaskClock */
+            uint32_t elapsed = (uint32_t)(tick - last_clock);
+            uint32_t next;
+
+            ClockAdvance(clock, elapsed);
+            now_ms += elapsed;
+            last_clock = tick;
+            next = 1000 - (uint32_t)(tick % 1000);
+            next_clock = tick + next;
+            stats->clock_runs++;
+            if (ClockSeconds(clock) != day_ms / 1000) {
+                stats->clock_errors++;
+            }
+            if (ClockIsAlarmTriggered(clock) != ringing) {
+                ringing = !ringing;
+                if (ringing) {
+                    stats->rang = true;
+                    stats->alarm_late = (uint32_t)(tick % DAY_MS) - (6 * 60 + 30) * 60000UL;
+                    wake_ui = true;
+                }
+            }
+        }
+        if (tick == next_buttons) {
+            /* TaskButtons: la tecla de cancelar solo cuenta en el flanco */
+            bool pressed = day_ms >= KEY_FROM && day_ms < KEY_FROM + KEY_MS;
+
+            if (pressed && !key_down) {
+                SleepActivity(sleep);
+                wake_ui = true;
+                if (!asleep && ClockIsAlarmTriggered(clock)) {
+                    ClockCancelAlarm(clock);
+                }
+            }
+            key_down = pressed;
+            next_buttons = tick + (asleep ? BUTTONS_SLEEP : BUTTONS_PERIOD);
+        }
+        if (tick == next_ui || wake_ui) {
+            /* TaskUI: con la pantalla apagada queda bloqueada hasta una notificacion o la revision nocturna */
+            uint32_t seconds = ClockSeconds(clock);
+
+            asleep = !SleepIsAwake(sleep, now_ms, (uint16_t)(seconds / 60), ClockIsAlarmTriggered(clock));
+            next_ui = tick + (asleep ? RECHECK_MS : UI_PERIOD);
+        }
+
+        uint64_t next = next_clock;
+        if (next_buttons < next) {
+            next = next_buttons;
+        }
+        if (next_ui < next) {
+            next = next_ui;
+        }
+        IdleGap(stats, (uint32_t)(next - tick));
+        tick = next;
+    }
+
+    printf("day  wakeups   ticked  suppressed  idle%%  clock_runs  errors  alarm_late_ms\n");
+    for (int day = 0; day < DAYS; day++) {
+        printf("%3d %8lu %8lu %11lu %6.2f %11lu %7lu %14ld\n", day + 1, (unsigned long)days[day].wakeups, DAY_MS,
+               (unsigned long)days[day].idle_ticks, 100.0 * days[day].idle_ticks / DAY_MS,
+               (unsigned long)days[day].clock_runs, (unsigned long)days[day].clock_errors,
+               days[day].rang ? (long)days[day].alarm_late : -1L);
+    }
+    ClockAdvance(clock, (uint32_t)((uint64_t)DAYS * DAY_MS - last_clock));
+    printf("end of week: clock %lu s after midnight, expected 0\n", (unsigned long)ClockSeconds(clock));
+    return 0;
+}
+
+/* === Private function definitions ================================================================================ */
+
+static uint32_t ClockSeconds(clock_t clock) {
+    clock_time_t now;
+
+    ClockGetTime(clock, &now);
+    return ((now.time.hours[1] * 10 + now.time.hours[0]) * 60 + now.time.minutes[1] * 10 + now.time.minutes[0]) * 60 +
+           now.time.seconds[1] * 10 + now.time.seconds[0];
+}
+
+static void IdleGap(day_stats_t * stats, uint32_t gap) {
+    if (gap < IDLE_BEFORE) {
+        return;
+    }
+    /* Cada sueño termina con un tick normal, y SysTick no puede suprimir mas de MAX_SUPPRESSED ticks seguidos, por
+     * lo que los intervalos largos se duermen en tramos con un despertar entre ellos */
+    uint32_t sleeps = (gap + MAX_SUPPRESSED - 1) / MAX_SUPPRESSED;
+
+    stats->wakeups += sleeps - 1;
+    stats->idle_ticks += gap - sleeps;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -42,18 +42,40 @@
 
 /* clang-format off */
 
-#define configSUPPORT_STATIC_ALLOCATION  0
+/* Con STATIC_ALLOCATION (ver pool.h) las tareas, la tarea ociosa y los temporizadores se crean con memoria estatica.
+ * La asignacion dinamica sigue habilitada solo para que el archivo heap_x.c que elige el modulo freertos compile sin
+ * cambios, con un heap minimo: ninguna llamada lo usa y, si alguna lo hiciera, falla y llama al aviso de memoria */
+#include "pool.h"
+
+#define configSUPPORT_STATIC_ALLOCATION  STATIC_ALLOCATION
+#define configSUPPORT_DYNAMIC_ALLOCATION 1
+
+/* Con APP_TICKLESS_IDLE el kernel suprime el tick mientras todas las tareas estan bloqueadas. Al despertar
+ * vTaskStepTick suma los ticks salteados, que app.c acumula como tiempo ocioso */
+#ifndef APP_TICKLESS_IDLE
+#define APP_TICKLESS_IDLE 0
+#endif
+
+/* Con APP_RUNTIME_STATS el kernel acumula el tiempo de ejecucion de cada tarea con el contador libre de TIMER3, que
+ * solo se lee en los cambios de contexto, y app.c lo muestra en el modo de diagnostico */
+#ifndef APP_RUNTIME_STATS
+#define APP_RUNTIME_STATS 1
+#endif
 
 #define configUSE_PREEMPTION             1
 #define configUSE_IDLE_HOOK              0
-#define configUSE_TICKLESS_IDLE          0
+#define configUSE_TICKLESS_IDLE          APP_TICKLESS_IDLE
 #define configUSE_TICK_HOOK              0
 #define configCPU_CLOCK_HZ               (SystemCoreClock)
 #define configTICK_RATE_HZ               ((TickType_t)1000) // 1000 ticks per second => 1ms tick rate
 #define configMAX_PRIORITIES             (15)
 #define configMINIMAL_STACK_SIZE         ((uint16_t)128)
 #define configAPPLICATION_ALLOCATED_HEAP 0
+#if STATIC_ALLOCATION
+#define configTOTAL_HEAP_SIZE            ((size_t)64) /* Minimo para heap_x.c, sin uso */
+#else
 #define configTOTAL_HEAP_SIZE            ((size_t)(16 * 1024)) /* 16 Kbytes. */
+#endif
 #define configMAX_TASK_NAME_LEN          (16)
 #define configUSE_TRACE_FACILITY         1
 #define configUSE_16_BIT_TICKS           0
@@ -62,17 +84,32 @@
 #define configQUEUE_REGISTRY_SIZE        8
 #define configCHECK_FOR_STACK_OVERFLOW   0
 #define configUSE_RECURSIVE_MUTEXES      1
-#define configUSE_MALLOC_FAILED_HOOK     0
+#define configUSE_MALLOC_FAILED_HOOK     STATIC_ALLOCATION
 #define configUSE_APPLICATION_TASK_TAG   0
 #define configUSE_COUNTING_SEMAPHORES    1
-#define configGENERATE_RUN_TIME_STATS    0
+#define configGENERATE_RUN_TIME_STATS    APP_RUNTIME_STATS
+
+#include <stdint.h>
+
+#if APP_TICKLESS_IDLE
+void AppAddIdleTicks(uint32_t ticks);
+#define configEXPECTED_IDLE_TIME_BEFORE_SLEEP 2
+#define traceINCREASE_TICK_COUNT(ticks)       AppAddIdleTicks(ticks)
+#endif
+
+#if APP_RUNTIME_STATS
+void board_counter_start(void);
+uint32_t board_counter(void);
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() board_counter_start()
+#define portGET_RUN_TIME_COUNTER_VALUE()         board_counter()
+#endif
 
 /* Co-routine definitions. */
 #define configUSE_CO_ROUTINES           0
 #define configMAX_CO_ROUTINE_PRIORITIES (2)
 
 /* Software timer definitions. */
-#define configUSE_TIMERS             1
+#define configUSE_TIMERS             0 /* La aplicacion no usa temporizadores de software */
 #define configTIMER_TASK_PRIORITY    (configMAX_PRIORITIES - 3)
 #define configTIMER_QUEUE_LENGTH     10
 #define configTIMER_TASK_STACK_DEPTH (configMINIMAL_STACK_SIZE * 4)
@@ -87,11 +124,13 @@
 #define INCLUDE_vTaskDelayUntil          1
 #define INCLUDE_vTaskDelay               1
 #define INCLUDE_xTaskGetSchedulerState   1
-#define INCLUDE_xTimerPendFunctionCall   1
+#define INCLUDE_xTimerPendFunctionCall   0
 #define INCLUDE_xSemaphoreGetMutexHolder 1
 #define INCLUDE_xTaskGetHandle           1
 #define INCLUDE_eTaskGetState            1
 #define INCLUDE_xTaskGetCurrentTaskHandle 1
+#define INCLUDE_xTaskGetIdleTaskHandle   1
+#define INCLUDE_uxTaskGetStackHighWaterMark 1
  
 
 /* Cortex-M specific definitions. */
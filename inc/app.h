@@ -33,6 +33,7 @@ extern "C" {
 #endif
 
 /* === Public macros definitions =================================================================================== */
+#include "app_schedule.h"
 #include "bsp.h"
 #include "clock.h"
 #include "screen.h"
@@ -40,6 +41,30 @@ extern "C" {
 #include "FreeRTOS.h"
 #include "task.h"
 
+/** Corre los trabajos desde el ejecutivo ciclico de main.c en una sola pila (1) o como tareas de FreeRTOS (0) */
+#ifndef APP_CYCLIC_EXECUTIVE
+#define APP_CYCLIC_EXECUTIVE 0
+#endif
+
+/** Monitorea los plazos de las tareas de FreeRTOS con el contador libre de board_counter (1) o no (0) */
+#ifndef APP_DEADLINE_MONITOR
+#define APP_DEADLINE_MONITOR 1
+#endif
+
+/** Tiempo sin cumplir los plazos hasta que el perro guardian reinicia la placa, en milisegundos; 0 no lo arranca.
+ * Necesita APP_DEADLINE_MONITOR */
+#ifndef APP_WATCHDOG_MS
+#define APP_WATCHDOG_MS 2000
+#endif
+
+#if APP_CYCLIC_EXECUTIVE && APP_TICKLESS_IDLE
+#error "APP_TICKLESS_IDLE (ver FreeRTOSConfig.h) necesita las tareas de FreeRTOS"
+#endif
+
+/** Periodo de los botones con la pantalla apagada y APP_TICKLESS_IDLE: solo hace falta ver la tecla que la enciende.
+ * Entra en un solo periodo de SysTick sin tick, que a 204 MHz cubre hasta 82 ms */
+#define APP_BUTTONS_SLEEP_PERIOD_MS 80
+
 /* === Public data type declarations =============================================================================== */
 
 /* === Public variable declarations ================================================================================ */
@@ -49,6 +74,46 @@ extern "C" {
 /** Inicializa BSP, display y reloj. Devuelve el handle de board para pasarlo a las tareas. */
 board_t AppInit(void);
 
+/**
+ * @brief Suma ticks al tiempo ocioso. La llama el kernel con APP_TICKLESS_IDLE cada vez que recupera los ticks
+ * suprimidos, con el planificador detenido.
+ *
+ * @param ticks Ticks en los que el procesador estuvo dormido
+ */
+void AppAddIdleTicks(uint32_t ticks);
+
+/**
+ * @brief Devuelve los ticks que el procesador paso dormido desde el arranque, siempre 0 sin APP_TICKLESS_IDLE.
+ */
+uint32_t AppGetIdleTicks(void);
+
+/**
+ * @brief Trabajo del reloj: avanza un milisegundo y actualiza el indicador de la alarma. Corre cada
+ * APP_CLOCK_PERIOD_MS.
+ */
+void JobClock(void);
+
+/**
+ * @brief Avanza el reloj los milisegundos transcurridos desde la ultima llamada y actualiza el indicador de la
+ * alarma. Es el trabajo del reloj con APP_TICKLESS_IDLE, que no corre en cada tick.
+ *
+ * @param elapsed_ms Milisegundos transcurridos
+ * @return uint32_t Milisegundos hasta el proximo cambio de segundo, cuando hay que volver a llamarla
+ */
+uint32_t JobClockAdvance(uint32_t elapsed_ms);
+
+/**
+ * @brief Trabajo de los botones: lee las teclas y cambia los modos de configuracion. Corre cada APP_BUTTONS_PERIOD_MS.
+ */
+void JobButtons(void);
+
+/**
+ * @brief Trabajo de la interfaz: dibuja la pantalla, o la apaga por inactividad. Corre cada APP_UI_PERIOD_MS.
+ *
+ * @return bool false si la pantalla esta apagada; hasta una tecla o la alarma no hay nada que dibujar
+ */
+bool JobUI(void);
+
 /**
  * @brief Tarea que gestiona el reloj, actualizando el tiempo y la alarma.
  * 
@@ -0,0 +1,81 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Martin Nicolas Soria <soria.m.nicolas@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, disponiblestribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+#ifndef APP_SCHEDULE_H_
+#define APP_SCHEDULE_H_
+
+/** @file app_schedule.h
+ ** @brief Periodos, pilas y tabla de marcos de los trabajos de la aplicacion
+ **
+ ** No depende del kernel ni de la placa, asi que main.c y las simulaciones del host usan los mismos valores.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/** Periodos de los trabajos del reloj, de los botones y de la interfaz, en milisegundos */
+#define APP_CLOCK_PERIOD_MS   1
+#define APP_BUTTONS_PERIOD_MS 20
+#define APP_UI_PERIOD_MS      5
+
+/** Pilas de las tareas de FreeRTOS, en palabras. Con el ejecutivo ciclico los trabajos comparten la pila de main, que
+ * debe alojar al mas profundo */
+#define APP_CLOCK_STACK   256
+#define APP_BUTTONS_STACK 256
+#define APP_UI_STACK      512
+
+/** Trabajos del ejecutivo ciclico, por su bit en la tabla de marcos */
+#define APP_JOB_CLOCK   (1u << 0)
+#define APP_JOB_BUTTONS (1u << 1)
+#define APP_JOB_UI      (1u << 2)
+
+/** Cantidad de marcos menores del marco mayor */
+#define APP_FRAME_COUNT (APP_BUTTONS_PERIOD_MS / APP_CLOCK_PERIOD_MS)
+
+/** Tabla de marcos del ejecutivo ciclico. El marco menor es el periodo del reloj y el mayor el de los botones. La
+ * interfaz corre cada 5 marcos, corrida respecto de los botones para que ningun marco tenga los tres trabajos */
+#define APP_FRAMES                                                                                                    \
+    {                                                                                                                 \
+        APP_JOB_CLOCK | APP_JOB_BUTTONS, APP_JOB_CLOCK, APP_JOB_CLOCK | APP_JOB_UI, APP_JOB_CLOCK, APP_JOB_CLOCK,     \
+        APP_JOB_CLOCK, APP_JOB_CLOCK, APP_JOB_CLOCK | APP_JOB_UI, APP_JOB_CLOCK, APP_JOB_CLOCK,                       \
+        APP_JOB_CLOCK, APP_JOB_CLOCK, APP_JOB_CLOCK | APP_JOB_UI, APP_JOB_CLOCK, APP_JOB_CLOCK,                       \
+        APP_JOB_CLOCK, APP_JOB_CLOCK, APP_JOB_CLOCK | APP_JOB_UI, APP_JOB_CLOCK, APP_JOB_CLOCK,                       \
+    }
+
+/* === Public data type declarations =============================================================================== */
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* APP_SCHEDULE_H_ */
@@ -31,6 +31,7 @@ SPDX-License-Identifier: MIT
 #include "chip.h"
 #include "digital.h"
 #include "screen.h"
+#include "pattern.h"
 
 /* === Header for C++ compatibility ================================================================================ */
 
@@ -76,29 +77,121 @@ extern "C" {
 #define LED_3_GPIO 1
 #define LED_3_BIT  12
 
-#define TEC_1_PORT 1
-#define TEC_1_PIN  0
-#define TEC_1_FUNC SCU_MODE_FUNC0
-#define TEC_1_GPIO 0
-#define TEC_1_BIT  4
-
-#define TEC_2_PORT 1
-#define TEC_2_PIN  1
-#define TEC_2_FUNC SCU_MODE_FUNC0
-#define TEC_2_GPIO 0
-#define TEC_2_BIT  8
-
-#define TEC_3_PORT 1
-#define TEC_3_PIN  2
-#define TEC_3_FUNC SCU_MODE_FUNC0
-#define TEC_3_GPIO 0
-#define TEC_3_BIT  9
-
-#define TEC_4_PORT 1
-#define TEC_4_PIN  6
-#define TEC_4_FUNC SCU_MODE_FUNC0
-#define TEC_4_GPIO 1
-#define TEC_4_BIT  9
+/** Clases de pines de la tabla de la placa, que definen su configuracion inicial */
+#define BSP_PIN_DIGIT   1 /**< Catodo de un digito, salida apagada al iniciar */
+#define BSP_PIN_SEGMENT 2 /**< Segmento del puerto de segmentos, salida apagada al iniciar */
+#define BSP_PIN_POINT   3 /**< Punto decimal, salida apagada al iniciar */
+#define BSP_PIN_KEY     4 /**< Tecla, entrada con resistencia de pull-up */
+
+/** Teclas de la EDU-CIAA, en la tabla con los nombres de las teclas de funcion del poncho que reemplazan */
+#define EDU_CIAA_FUNCTION_KEY_PINS(PIN)                                                                               \
+    PIN(KEY_F1, 1, 0, SCU_MODE_FUNC0, 0, 4, BSP_PIN_KEY)                                                              \
+    PIN(KEY_F2, 1, 1, SCU_MODE_FUNC0, 0, 8, BSP_PIN_KEY)                                                              \
+    PIN(KEY_F3, 1, 2, SCU_MODE_FUNC0, 0, 9, BSP_PIN_KEY)                                                              \
+    PIN(KEY_F4, 1, 6, SCU_MODE_FUNC0, 1, 9, BSP_PIN_KEY)
+
+/** Variantes de placa: cada una es solo una tabla de pines */
+#define BSP_BOARD_PONCHO        0 /**< Pantalla y teclas del poncho */
+#define BSP_BOARD_EDU_CIAA_KEYS 1 /**< Pantalla del poncho con las teclas F1 a F4 en las teclas de la EDU-CIAA */
+
+#ifndef BSP_BOARD
+#define BSP_BOARD BSP_BOARD_PONCHO
+#endif
+
+/** Tabla de pines de la placa elegida: PIN(nombre, puerto SCU, pin SCU, funcion, puerto GPIO, bit GPIO, clase) */
+#if BSP_BOARD == BSP_BOARD_PONCHO
+#define BSP_BOARD_PINS(PIN) PONCHO_DISPLAY_PINS(PIN) PONCHO_FUNCTION_KEY_PINS(PIN) PONCHO_CONFIRM_KEY_PINS(PIN)
+#elif BSP_BOARD == BSP_BOARD_EDU_CIAA_KEYS
+#define BSP_BOARD_PINS(PIN) PONCHO_DISPLAY_PINS(PIN) EDU_CIAA_FUNCTION_KEY_PINS(PIN) PONCHO_CONFIRM_KEY_PINS(PIN)
+#else
+#error "BSP_BOARD desconocida"
+#endif
+
+/** Termino de la mascara de una clase de pines, para sumar sobre la tabla */
+#define BSP_PIN_MASK_TERM(CLASS, class, bit) | (((class) == (CLASS)) ? (1u << (bit)) : 0u)
+#define BSP_DIGITS_MASK_TERM(name, port, pin, func, gpio, bit, class)   BSP_PIN_MASK_TERM(BSP_PIN_DIGIT, class, bit)
+#define BSP_SEGMENTS_MASK_TERM(name, port, pin, func, gpio, bit, class) BSP_PIN_MASK_TERM(BSP_PIN_SEGMENT, class, bit)
+
+/** Mascaras de los digitos y de los segmentos en sus puertos GPIO, calculadas desde la tabla de pines */
+#define DIGITS_MASK   (0u BSP_BOARD_PINS(BSP_DIGITS_MASK_TERM))
+#define SEGMENTS_MASK (0u BSP_BOARD_PINS(BSP_SEGMENTS_MASK_TERM))
+
+/** Verificacion en tiempo de compilacion: un arreglo de tamaño negativo si la condicion es falsa */
+#define BSP_STATIC_ASSERT(condition, name) typedef char bsp_assert_##name[(condition) ? 1 : -1]
+
+/** Pantalla conectada a un MAX7219 por SSP1 (1) o multiplexada directamente por GPIO desde el poncho (0) */
+#ifndef BSP_DISPLAY_MAX7219
+#define BSP_DISPLAY_MAX7219 0
+#endif
+
+#define MAX7219_MOSI_PORT 1
+#define MAX7219_MOSI_PIN  4
+#define MAX7219_MOSI_FUNC SCU_MODE_FUNC5
+
+#define MAX7219_SCK_PORT 0xF
+#define MAX7219_SCK_PIN  4
+#define MAX7219_SCK_FUNC SCU_MODE_FUNC0
+
+#define MAX7219_LOAD_PORT 1
+#define MAX7219_LOAD_PIN  5
+#define MAX7219_LOAD_FUNC SCU_MODE_FUNC5
+
+/** Velocidad del bus SSP hacia el MAX7219, en bits por segundo */
+#define MAX7219_BITRATE 1000000
+
+/** Pantalla en un LCD de caracteres HD44780 por el conector LCD de la EDU-CIAA, con bus de 4 bits (1) */
+#ifndef BSP_DISPLAY_HD44780
+#define BSP_DISPLAY_HD44780 0
+#endif
+
+#if BSP_DISPLAY_HD44780 && BSP_DISPLAY_MAX7219
+#error "BSP_DISPLAY_HD44780 y BSP_DISPLAY_MAX7219 no pueden usarse juntas"
+#endif
+
+#if BSP_DISPLAY_HD44780 && BSP_BOARD == BSP_BOARD_PONCHO
+#error "El conector LCD usa los pines de F1 a F3 del poncho, BSP_DISPLAY_HD44780 necesita BSP_BOARD_EDU_CIAA_KEYS"
+#endif
+
+/** Pines del conector LCD: PIN(nombre, puerto SCU, pin SCU, funcion, puerto GPIO, bit GPIO) */
+#define HD44780_PINS(PIN)                                                                                             \
+    PIN(D4, 4, 4,  SCU_MODE_FUNC0, 2, 4)                                                                              \
+    PIN(D5, 4, 5,  SCU_MODE_FUNC0, 2, 5)                                                                              \
+    PIN(D6, 4, 6,  SCU_MODE_FUNC0, 2, 6)                                                                              \
+    PIN(D7, 4, 10, SCU_MODE_FUNC4, 5, 14)                                                                             \
+    PIN(RS, 4, 8,  SCU_MODE_FUNC4, 5, 12)                                                                             \
+    PIN(EN, 4, 9,  SCU_MODE_FUNC4, 5, 13)
+
+/** Esperas del LCD en microsegundos: despues del encendido, de las instrucciones de borrado y de las demas */
+#define HD44780_POWER_UP_US 50000
+#define HD44780_CLEAR_US    2000
+#define HD44780_COMMAND_US  50
+
+/** Refresca la pantalla desde la interrupcion de un temporizador (1) o desde la tarea de interfaz (0). Con un
+ * MAX7219 o un LCD el controlador mantiene la imagen por su cuenta y alcanza con enviar los cuadros desde la tarea de
+ * interfaz */
+#ifndef BSP_SCREEN_REFRESH_ISR
+#define BSP_SCREEN_REFRESH_ISR (!BSP_DISPLAY_MAX7219 && !BSP_DISPLAY_HD44780)
+#endif
+
+/** Frecuencia de barrido de la pantalla, en digitos por segundo */
+#ifndef BSP_SCREEN_REFRESH_HZ
+#define BSP_SCREEN_REFRESH_HZ 800
+#endif
+
+/** Frecuencia del contador del temporizador de barrido, que define la resolucion del jitter medido */
+#define BSP_SCREEN_TIMER_HZ 1000000
+
+/** Frecuencia del contador del temporizador que reproduce las secuencias del indicador de alarma */
+#define BSP_PATTERN_TIMER_HZ 1000
+
+/** Frecuencia del contador del temporizador que marca los marcos del ejecutivo ciclico */
+#define BSP_FRAME_TIMER_HZ 1000000
+
+/** Frecuencia del contador libre de TIMER3 que miden las estadisticas de ejecucion; desborda cada 71 minutos */
+#define BSP_COUNTER_HZ 1000000
+
+/** Frecuencia del contador del perro guardian: el oscilador interno de 12 MHz con el divisor fijo por 4 */
+#define BSP_WATCHDOG_HZ (12000000 / 4)
 
 /* === Public data type declarations =============================================================================== */
 
@@ -109,6 +202,7 @@ extern "C" {
  */
 typedef struct board_s {
     digital_output_t alarm_led;    /**< Indicador de la alarma */
+    pattern_player_t alarm_pattern; /**< Reproductor de secuencias del indicador de la alarma */
     digital_input_t set_time;   /**< Botón para configurar la hora */
     digital_input_t set_alarm;  /**< Botón para configurar la alarma */
     digital_input_t decrement;  /**< Botón para decrementar valores */
@@ -128,6 +222,68 @@ typedef struct board_s {
  */
 board_t board_create(void);
 
+/**
+ * @brief Apaga la pantalla y detiene su refresco por interrupcion, si esta habilitado.
+ * @param board Placa creada con board_create.
+ */
+void board_screen_sleep(board_t board);
+
+/**
+ * @brief Reanuda el refresco por interrupcion de la pantalla; el primer digito se muestra antes de un periodo.
+ *
+ * Sin refresco por interrupcion no hace nada: la pantalla se enciende con el siguiente ScreenRefresh.
+ *
+ * @param board Placa creada con board_create.
+ */
+void board_screen_wake(board_t board);
+
+/**
+ * @brief Reproduce una secuencia en el indicador de la alarma desde la interrupcion de TIMER1.
+ *
+ * La interrupcion solo se produce en cada cambio de la salida y queda deshabilitada con el reproductor detenido.
+ *
+ * @param board Placa creada con board_create.
+ * @param pattern Secuencia a reproducir desde el comienzo, NULL para apagar el indicador.
+ */
+void board_alarm_pattern(board_t board, const pattern_t * pattern);
+
+/**
+ * @brief Llama a una funcion desde la interrupcion de TIMER2 con un periodo fijo, para marcar los marcos menores
+ * del ejecutivo ciclico.
+ *
+ * La interrupcion tiene menor prioridad que el barrido de la pantalla y las secuencias del indicador.
+ *
+ * @param period_us Periodo en microsegundos.
+ * @param handler Funcion a llamar en cada periodo.
+ */
+void board_frame_timer(uint32_t period_us, void (*handler)(void));
+
+/**
+ * @brief Pone en marcha el contador libre de TIMER3, sin interrupciones.
+ *
+ * Lo llama el kernel al arrancar cuando genera estadisticas de ejecucion.
+ */
+void board_counter_start(void);
+
+/**
+ * @brief Devuelve el valor del contador libre de TIMER3, en ciclos de BSP_COUNTER_HZ.
+ */
+uint32_t board_counter(void);
+
+/**
+ * @brief Arranca el perro guardian, que reinicia el microcontrolador si no se lo alimenta a tiempo.
+ *
+ * Una vez arrancado no se puede detener.
+ *
+ * @param timeout_ms Tiempo sin alimentarlo hasta el reinicio, hasta 5592 ms.
+ */
+void board_watchdog_start(uint32_t timeout_ms);
+
+/**
+ * @brief Alimenta el perro guardian y reinicia su cuenta.
+ */
+void board_watchdog_feed(void);
+
 /* === End of conditional blocks =================================================================================== */
 
 #ifdef __cplusplus
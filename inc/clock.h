@@ -27,7 +27,7 @@ SPDX-License-Identifier: MIT
 /* === Headers files inclusions ==================================================================================== */
 #include <stdint.h>
 #include <stdbool.h>
-#include "bsp.h"
+#include "digital.h"
 
 /* === Header for C++ compatibility ================================================================================ */
 
@@ -105,6 +105,17 @@ bool ClockSetTime(clock_t clock, const clock_time_t * new_time);
  */
 void ClockNewTick(clock_t clock);
 
+/**
+ * @brief Avanza el reloj varios ticks de una vez, en tiempo constante.
+ *
+ * Deja el reloj, la alarma y la posposicion igual que la misma cantidad de llamadas a ClockNewTick; se usa al
+ * despertar de un periodo sin ticks.
+ *
+ * @param clock Instancia del reloj.
+ * @param ticks Cantidad de ticks transcurridos.
+ */
+void ClockAdvance(clock_t clock, uint32_t ticks);
+
 
 /**
  * @brief Configura la hora de la alarma.
@@ -166,16 +177,16 @@ void ClockCancelAlarm(clock_t self);
 bool ClockIsAlarmEnabled(clock_t self);
 
 /**
- * @brief Habilita la alarma.
+ * @brief Enciende el indicador de la alarma.
  *
- * @param clock Instancia del reloj.
+ * @param alarm_led Salida del indicador, creada con la polaridad del LED.
  */
 void AlarmLedOn(digital_output_t alarm_led);
 
 /**
- * @brief Deshabilita la alarma.
+ * @brief Apaga el indicador de la alarma.
  *
- * @param clock Instancia del reloj.
+ * @param alarm_led Salida del indicador, creada con la polaridad del LED.
  */
 void AlarmLedOff(digital_output_t alarm_led);
 
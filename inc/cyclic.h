@@ -0,0 +1,116 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Martin Nicolas Soria <soria.m.nicolas@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, disponiblestribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+#ifndef CYCLIC_H_
+#define CYCLIC_H_
+
+/** @file cyclic.h
+ ** @brief Ejecutivo ciclico: trabajos que corren hasta terminar en una sola pila, segun una tabla estatica de marcos
+ **
+ ** El marco menor es el periodo de la interrupcion que llama a CyclicTick. La tabla tiene un marco menor por entrada
+ ** y su largo es el marco mayor; cada entrada es una mascara de los trabajos que corren en ese marco, en el orden en
+ ** que aparecen en la lista de trabajos.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/** @brief Cantidad maxima de trabajos de una tabla, uno por bit de la mascara de cada marco */
+#define CYCLIC_MAX_JOBS 32
+
+/* === Public data type declarations =============================================================================== */
+
+/** @brief Trabajo periodico, que corre hasta terminar sin bloquearse */
+typedef void (*cyclic_job_t)(void);
+
+/** @brief Tabla estatica de un ejecutivo ciclico */
+typedef struct cyclic_schedule_s {
+    const cyclic_job_t * jobs; /**< Trabajos, en el orden en que corren dentro de un marco */
+    uint8_t job_count;         /**< Cantidad de trabajos, hasta CYCLIC_MAX_JOBS */
+    const uint32_t * frames;   /**< Mascara de los trabajos de cada marco menor */
+    uint8_t frame_count;       /**< Cantidad de marcos menores del marco mayor */
+} cyclic_schedule_t;
+
+/** @brief Estructura privada del ejecutivo */
+typedef struct cyclic_s * cyclic_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Crea un ejecutivo ciclico que comienza por el primer marco de la tabla
+ *
+ * @param schedule Tabla de marcos, que debe existir mientras se use el ejecutivo
+ * @return cyclic_t Puntero al ejecutivo creado, NULL si la tabla no es valida o hubo error
+ */
+cyclic_t CyclicCreate(const cyclic_schedule_t * schedule);
+
+/**
+ * @brief Indica que empezo un nuevo marco menor; se llama desde la interrupcion del temporizador
+ *
+ * @param self Puntero al ejecutivo
+ */
+void CyclicTick(cyclic_t self);
+
+/**
+ * @brief Indica si hay algun marco menor esperando para correr
+ *
+ * @param self Puntero al ejecutivo
+ * @return bool true si CyclicRunPending correria un marco
+ */
+bool CyclicIsPending(cyclic_t self);
+
+/**
+ * @brief Corre los trabajos del siguiente marco si su interrupcion ya ocurrio; se llama desde el lazo principal
+ *
+ * Si al terminar ya empezo mas de un marco nuevo se cuenta un desborde. Los marcos atrasados no se saltean, para que
+ * los trabajos que cuentan tiempo por marco no pierdan cuentas.
+ *
+ * @param self Puntero al ejecutivo
+ * @return bool true si corrio un marco
+ */
+bool CyclicRunPending(cyclic_t self);
+
+/**
+ * @brief Devuelve la cantidad de marcos que terminaron despues del comienzo del marco siguiente
+ *
+ * @param self Puntero al ejecutivo
+ * @return uint32_t Cantidad de desbordes
+ */
+uint32_t CyclicGetOverruns(cyclic_t self);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CYCLIC_H_ */
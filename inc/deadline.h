@@ -0,0 +1,175 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Martin Nicolas Soria <soria.m.nicolas@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, disponiblestribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+#ifndef DEADLINE_H_
+#define DEADLINE_H_
+
+/** @file deadline.h
+ ** @brief Declaraciones del monitor de plazos de las tareas periodicas
+ **
+ ** Cada tarea declara su periodo y su plazo, informa cuando se libera y cuando termina cada vuelta, y el monitor
+ ** guarda la latencia de liberacion en un histograma y cuenta los plazos vencidos. Los tiempos se miden en unidades
+ ** de un contador libre de 32 bits que puede desbordar.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/** @brief Cantidad maxima de tareas que se pueden monitorear */
+#define DEADLINE_MAX_TASKS 4
+
+/** @brief Cantidad de intervalos del histograma de latencia de liberacion */
+#define DEADLINE_BINS 8
+
+/** @brief Limite del primer intervalo del histograma; cada intervalo siguiente duplica al anterior y el ultimo junta
+ * todas las latencias mayores */
+#define DEADLINE_JITTER_BASE 8
+
+/* === Public data type declarations =============================================================================== */
+
+/** @brief Estructura privada del monitor de plazos */
+typedef struct deadline_s * deadline_t;
+
+/**
+ * @brief Funcion que se llama cuando una tarea termina despues de su plazo, desde la misma tarea, o cuando
+ * DeadlineAllMet la encuentra colgada, desde la tarea que consulta
+ *
+ * @param task Indice de la tarea
+ * @param lateness Tiempo que paso desde el plazo hasta que termino la vuelta, o desde el limite de la vuelta colgada
+ */
+typedef void (*deadline_miss_t)(uint8_t task, uint32_t lateness);
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Crea un monitor de plazos sin tareas declaradas
+ *
+ * @param handler Funcion a llamar con cada plazo vencido, NULL si no se necesita
+ * @return deadline_t Monitor creado, NULL si hubo error
+ */
+deadline_t DeadlineCreate(deadline_miss_t handler);
+
+/**
+ * @brief Declara o redeclara el periodo y el plazo de una tarea
+ *
+ * La siguiente liberacion de la tarea toma el nuevo periodo como referencia, por lo que tambien sirve para cambiar el
+ * periodo de una tarea.
+ *
+ * @param self Monitor de plazos
+ * @param task Indice de la tarea, menor a DEADLINE_MAX_TASKS
+ * @param period Periodo de la tarea
+ * @param deadline Plazo para terminar cada vuelta, medido desde la liberacion esperada
+ * @return true Si la tarea quedo declarada
+ */
+bool DeadlineDeclare(deadline_t self, uint8_t task, uint32_t period, uint32_t deadline);
+
+/**
+ * @brief Informa que una tarea comienza una vuelta
+ *
+ * La liberacion esperada es la anterior mas un periodo, asi la latencia no se acumula. La primera liberacion despues
+ * de declarar la tarea o de DeadlinePause se toma como referencia, sin latencia.
+ *
+ * @param self Monitor de plazos
+ * @param task Indice de la tarea
+ * @param now Valor actual del contador
+ */
+void DeadlineRelease(deadline_t self, uint8_t task, uint32_t now);
+
+/**
+ * @brief Informa que una tarea termino una vuelta y verifica su plazo
+ *
+ * @param self Monitor de plazos
+ * @param task Indice de la tarea
+ * @param now Valor actual del contador
+ * @return true Si la vuelta termino dentro del plazo
+ * @return false Si vencio el plazo; en ese caso ya se llamo a la funcion de aviso
+ */
+bool DeadlineComplete(deadline_t self, uint8_t task, uint32_t now);
+
+/**
+ * @brief Fija la liberacion esperada de la vuelta siguiente, para tareas que no se liberan cada un periodo fijo
+ *
+ * Sirve para una tarea que se bloquea un tiempo variable, como con vTaskDelay: la latencia y el plazo de la vuelta
+ * siguiente se miden desde el momento pedido en lugar de desde la liberacion anterior mas un periodo, y la tarea se
+ * considera colgada si no termina esa vuelta dentro del plazo. Se llama despues de DeadlineComplete y solo afecta a
+ * la liberacion siguiente.
+ *
+ * @param self Monitor de plazos
+ * @param task Indice de la tarea
+ * @param release Valor del contador en que la tarea pidio despertar
+ */
+void DeadlineSchedule(deadline_t self, uint8_t task, uint32_t release);
+
+/**
+ * @brief Suspende el monitoreo de una tarea que se bloquea sin periodo, por ejemplo hasta una notificacion
+ *
+ * @param self Monitor de plazos
+ * @param task Indice de la tarea
+ */
+void DeadlinePause(deadline_t self, uint8_t task);
+
+/**
+ * @brief Indica si todas las tareas cumplieron sus plazos desde la llamada anterior
+ *
+ * Ademas de no tener plazos vencidos, ninguna tarea monitoreada puede llevar mas de un periodo y un plazo sin
+ * terminar una vuelta, o pasar el plazo de la liberacion fijada con DeadlineSchedule, lo que detecta tambien a las
+ * tareas que no vuelven a ejecutarse. Cada vuelta colgada cuenta como un plazo vencido de su tarea y se avisa una
+ * vez. Es la condicion para alimentar el perro guardian.
+ *
+ * @param self Monitor de plazos
+ * @param now Valor actual del contador
+ * @return true Si todas las tareas cumplieron
+ */
+bool DeadlineAllMet(deadline_t self, uint32_t now);
+
+/**
+ * @brief Devuelve la cantidad de plazos vencidos de una tarea desde que se creo el monitor, incluidas las vueltas
+ * colgadas que detecto DeadlineAllMet
+ */
+uint32_t DeadlineGetMisses(deadline_t self, uint8_t task);
+
+/**
+ * @brief Devuelve la cantidad de liberaciones de una tarea que cayeron en un intervalo del histograma de latencia
+ *
+ * @param self Monitor de plazos
+ * @param task Indice de la tarea
+ * @param bin Intervalo, menor a DEADLINE_BINS
+ */
+uint32_t DeadlineGetJitter(deadline_t self, uint8_t task, uint8_t bin);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DEADLINE_H_ */
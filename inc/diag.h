@@ -0,0 +1,154 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Martin Nicolas Soria <soria.m.nicolas@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, disponiblestribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+#ifndef DIAG_H_
+#define DIAG_H_
+
+/** @file diag.h
+ ** @brief Declaraciones de las estadisticas de ejecucion de las tareas y su presentacion
+ **
+ ** Las tareas informan la duracion de cada vuelta de su ciclo; el uso de CPU, la pila libre y el heap se toman en
+ ** muestras que pide quien las muestra, por lo que sin nadie mirando solo cuesta comparar un maximo por vuelta.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/** @brief Cantidad maxima de tareas que se pueden seguir */
+#define DIAG_MAX_TASKS 4
+
+/** @brief Largo del texto de una pagina de diagnostico, con el punto y el terminador */
+#define DIAG_PAGE_TEXT 6
+
+/* === Public data type declarations =============================================================================== */
+
+/** @brief Estructura privada de las estadisticas */
+typedef struct diag_s * diag_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Crea las estadisticas de un conjunto de tareas
+ *
+ * @param names Nombres de las tareas, que se usan en el volcado JSON y deben seguir existiendo
+ * @param count Cantidad de tareas, hasta DIAG_MAX_TASKS
+ * @return diag_t Estadisticas creadas, NULL si hubo error
+ */
+diag_t DiagCreate(const char * const names[], uint8_t count);
+
+/**
+ * @brief Registra la duracion de una vuelta del ciclo de una tarea y conserva la maxima
+ *
+ * @param self Estadisticas
+ * @param task Indice de la tarea
+ * @param elapsed Duracion de la vuelta, en unidades del contador de ejecucion
+ */
+void DiagLoopTime(diag_t self, uint8_t task, uint32_t elapsed);
+
+/**
+ * @brief Carga la muestra de una tarea
+ *
+ * @param self Estadisticas
+ * @param task Indice de la tarea
+ * @param runtime Tiempo de ejecucion acumulado de la tarea, en unidades del contador de ejecucion
+ * @param stack_free Minimo de pila libre que tuvo la tarea, en palabras
+ */
+void DiagTaskSample(diag_t self, uint8_t task, uint32_t runtime, uint32_t stack_free);
+
+/**
+ * @brief Cierra una muestra y calcula el uso de CPU de cada tarea desde la muestra anterior
+ *
+ * La primera muestra calcula el uso desde el arranque. El contador puede desbordar una vez entre dos muestras.
+ *
+ * @param self Estadisticas
+ * @param runtime Valor actual del contador de ejecucion
+ * @param heap_free_min Minimo de heap libre desde el arranque, en bytes
+ */
+void DiagSystemSample(diag_t self, uint32_t runtime, uint32_t heap_free_min);
+
+/**
+ * @brief Devuelve el uso de CPU de una tarea en la ultima muestra, en porcentaje
+ */
+uint8_t DiagGetCpu(diag_t self, uint8_t task);
+
+/**
+ * @brief Devuelve el minimo de pila libre de una tarea en la ultima muestra, en palabras
+ */
+uint32_t DiagGetStackFree(diag_t self, uint8_t task);
+
+/**
+ * @brief Devuelve la vuelta mas larga de una tarea, en unidades del contador de ejecucion
+ */
+uint32_t DiagGetLoopMax(diag_t self, uint8_t task);
+
+/**
+ * @brief Devuelve el minimo de heap libre de la ultima muestra, en bytes
+ */
+uint32_t DiagGetHeapFree(diag_t self);
+
+/**
+ * @brief Devuelve la cantidad de paginas de diagnostico
+ */
+uint8_t DiagGetPages(diag_t self);
+
+/**
+ * @brief Arma el texto de una pagina de diagnostico para ScreenWriteText
+ *
+ * Primero estan las paginas de uso de CPU de cada tarea (C), despues las de pila libre (S) y las de vuelta mas larga
+ * (L), con el valor en tres digitos que se satura en 999. La tarea se indica con el punto encendido en el digito de su
+ * indice. La ultima pagina es el heap libre en kilobytes con un decimal (H).
+ *
+ * @param self Estadisticas
+ * @param page Pagina, menor a DiagGetPages
+ * @param text Texto resultante
+ * @return true Si la pagina existe
+ */
+bool DiagFormatPage(diag_t self, uint8_t page, char text[DIAG_PAGE_TEXT]);
+
+/**
+ * @brief Escribe las estadisticas como un objeto JSON
+ *
+ * @param self Estadisticas
+ * @param buffer Destino del texto, que siempre queda terminado en cero
+ * @param size Tamaño del destino
+ * @return int Largo del texto completo; si es mayor o igual que size el texto quedo cortado
+ */
+int DiagWriteJson(diag_t self, char * buffer, size_t size);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DIAG_H_ */
@@ -37,11 +37,31 @@ extern "C" {
 
 /* === Public macros definitions =================================================================================== */
 
+/** @brief Cantidad maxima de salidas de un grupo, una por bit del puerto */
+#define DIGITAL_GROUP_MAX 32
+
+/** @brief Cantidad maxima de escrituras que acumula un lote antes de aplicarlo */
+#define DIGITAL_BATCH_MAX 16
+
 /* === Public data type declarations =============================================================================== */
 
 /** @brief Estructura para una salida digital */
 typedef struct digital_output_s * digital_output_t;
 
+/** @brief Estructura para un grupo de salidas digitales de un mismo puerto */
+typedef struct digital_output_group_s * digital_output_group_t;
+
+/**
+ * @brief Lote de escrituras a salidas de cualquier puerto, que se aplican juntas con DigitalBatchCommit
+ *
+ * Se declara en la pila o como variable estatica y no debe ser modificado directamente por el usuario.
+ */
+typedef struct digital_batch_s {
+    uint8_t count;                                 /**< Cantidad de escrituras acumuladas */
+    digital_output_t outputs[DIGITAL_BATCH_MAX];   /**< Salidas a escribir */
+    bool states[DIGITAL_BATCH_MAX];                /**< Estado pedido para cada salida */
+} digital_batch_t;
+
 /** @brief Estructura para una entrada digital */
 typedef struct digital_input_s * digital_input_t;
 
@@ -61,11 +81,15 @@ typedef enum digital_states_e {
 /**
  * @brief Funcion para crear una salida digital
  *
+ * La salida comienza desactivada. El modulo recuerda el estado escrito y solo escribe el pin cuando cambia, por lo
+ * que el pin no debe modificarse por fuera de estas funciones.
+ *
  * @param gpio Puerto de la salida digital
  * @param bit Pin de la salida digital
+ * @param inverted Indica si la salida se activa con nivel bajo
  * @return digital_output_t Puntero a la salida digital creada
  */
-digital_output_t DigitalOutputCreate(uint8_t gpio, uint8_t bit);
+digital_output_t DigitalOutputCreate(uint8_t gpio, uint8_t bit, bool inverted);
 
 /**
  * @brief Funcion para activar una salida digital
@@ -81,6 +105,14 @@ void DigitalOutputActivate(digital_output_t self);
  */
 void DigitalOutputDeactivate(digital_output_t self);
 
+/**
+ * @brief Funcion para obtener el ultimo estado escrito en una salida digital, sin leer el pin
+ *
+ * @param self Puntero a la salida digital creada
+ * @return bool Indica si la salida esta activa
+ */
+bool DigitalOutputGetIsActive(digital_output_t self);
+
 /**
  * @brief Funcion para alternar el estado de una salida digital
  *
@@ -88,6 +120,74 @@ void DigitalOutputDeactivate(digital_output_t self);
  */
 void DigitalOutputToggle(digital_output_t self);
 
+/**
+ * @brief Funcion para crear un grupo con salidas ya creadas de un mismo puerto
+ *
+ * Cada salida queda identificada por su posicion en el arreglo, que es el bit que la representa en las mascaras de
+ * DigitalOutputGroupWrite. Las salidas siguen pudiendo usarse en forma individual.
+ *
+ * @param outputs Salidas que forman el grupo
+ * @param count Cantidad de salidas, hasta DIGITAL_GROUP_MAX
+ * @return digital_output_group_t Puntero al grupo creado, NULL si las salidas son de puertos distintos o hay error
+ */
+digital_output_group_t DigitalOutputGroupCreate(const digital_output_t outputs[], uint8_t count);
+
+/**
+ * @brief Funcion para cambiar cualquier subconjunto de las salidas de un grupo con una sola escritura al puerto
+ *
+ * Programa el registro MASK del puerto y escribe el nuevo nivel de todos los pines por MPIN, por lo que los pines
+ * cambian a la vez. La secuencia corre con las interrupciones enmascaradas y deja MASK en 0. Solo se escribe si
+ * alguna salida cambia de estado.
+ *
+ * @param self Puntero al grupo
+ * @param members Mascara de las salidas a escribir, un bit por posicion en el grupo
+ * @param states Estado de cada salida a escribir, un bit por posicion en el grupo
+ */
+void DigitalOutputGroupWrite(digital_output_group_t self, uint32_t members, uint32_t states);
+
+/**
+ * @brief Funcion para activar un subconjunto de las salidas de un grupo con una sola escritura al puerto
+ *
+ * @param self Puntero al grupo
+ * @param members Mascara de las salidas a activar
+ */
+void DigitalOutputGroupActivate(digital_output_group_t self, uint32_t members);
+
+/**
+ * @brief Funcion para desactivar un subconjunto de las salidas de un grupo con una sola escritura al puerto
+ *
+ * @param self Puntero al grupo
+ * @param members Mascara de las salidas a desactivar
+ */
+void DigitalOutputGroupDeactivate(digital_output_group_t self, uint32_t members);
+
+/**
+ * @brief Funcion para vaciar un lote de escrituras
+ *
+ * @param batch Lote a inicializar
+ */
+void DigitalBatchInit(digital_batch_t * batch);
+
+/**
+ * @brief Funcion para agregar la escritura de una salida a un lote, sin tocar el puerto
+ *
+ * @param batch Lote de escrituras
+ * @param output Salida a escribir
+ * @param active Estado pedido
+ * @return bool false si el lote esta lleno o los parametros son invalidos
+ */
+bool DigitalBatchWrite(digital_batch_t * batch, digital_output_t output, bool active);
+
+/**
+ * @brief Funcion para aplicar un lote con una escritura enmascarada por cada puerto que cambia, y vaciarlo
+ *
+ * Si una salida aparece varias veces vale la ultima escritura. Escribe cada puerto igual que los grupos.
+ *
+ * @param batch Lote de escrituras
+ * @return uint8_t Cantidad de puertos escritos
+ */
+uint8_t DigitalBatchCommit(digital_batch_t * batch);
+
 /**
  * @brief Funcion para crear una entrada digital
  *
@@ -0,0 +1,111 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Martin Nicolas Soria <soria.m.nicolas@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, disponiblestribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef DIGITAL_PIN_H
+#define DIGITAL_PIN_H
+
+/** @file digital_pin.h
+ ** @brief Pines digitales resueltos en tiempo de compilacion, como alternativa sin estado al modulo digital
+ **
+ ** Cada macro genera funciones `static inline` para un pin fijo, con el puerto, el bit y la polaridad como
+ ** constantes. Las lecturas y escrituras usan el registro de un byte por pin (B) del LPC43xx, y la inversion el
+ ** registro NOT, por lo que cada operacion es una sola carga o un solo almacenamiento, sin objetos en el heap ni ramas
+ ** por la polaridad. Los accesos pasan por las funciones en linea de LPCOpen, que compilan a esa misma instruccion y
+ ** que en las pruebas del host registra el modelo de chip.h.
+ **
+ ** El comportamiento visible en el pin es el mismo que el de digital_output_t y digital_input_t. A diferencia de
+ ** esas, los pines de este archivo no recuerdan el ultimo estado: una salida siempre escribe el pin y su estado se
+ ** lee del propio pin. Un mismo pin no debe manejarse a la vez con las dos interfaces.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "chip.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/**
+ * @brief Genera las funciones de una salida digital fija: nameInit, nameActivate, nameDeactivate, nameWrite,
+ * nameToggle y nameGetIsActive
+ *
+ * @param name Prefijo de las funciones generadas
+ * @param gpio Puerto de la salida, constante
+ * @param bit Pin de la salida, constante
+ * @param inverted Indica si la salida se activa con nivel bajo, constante
+ */
+#define DIGITAL_PIN_OUTPUT(name, gpio, bit, inverted)                                                                 \
+    static inline void name##Init(void) {                                                                             \
+        Chip_GPIO_WritePortBit(LPC_GPIO_PORT, (gpio), (bit), (inverted));                                             \
+        Chip_GPIO_SetPinDIROutput(LPC_GPIO_PORT, (gpio), (bit));                                                      \
+    }                                                                                                                 \
+    static inline void name##Activate(void) {                                                                         \
+        Chip_GPIO_WritePortBit(LPC_GPIO_PORT, (gpio), (bit), !(inverted));                                            \
+    }                                                                                                                 \
+    static inline void name##Deactivate(void) {                                                                       \
+        Chip_GPIO_WritePortBit(LPC_GPIO_PORT, (gpio), (bit), (inverted));                                             \
+    }                                                                                                                 \
+    static inline void name##Write(bool active) {                                                                     \
+        Chip_GPIO_WritePortBit(LPC_GPIO_PORT, (gpio), (bit), active != (bool)(inverted));                             \
+    }                                                                                                                 \
+    static inline void name##Toggle(void) {                                                                           \
+        Chip_GPIO_SetPinToggle(LPC_GPIO_PORT, (gpio), (bit));                                                         \
+    }                                                                                                                 \
+    static inline bool name##GetIsActive(void) {                                                                      \
+        return Chip_GPIO_ReadPortBit(LPC_GPIO_PORT, (gpio), (bit)) != (bool)(inverted);                               \
+    }
+
+/**
+ * @brief Genera las funciones de una entrada digital fija: nameInit y nameGetIsActive
+ *
+ * Para detectar flancos se sigue usando digital_input_t, que guarda el estado anterior.
+ *
+ * @param name Prefijo de las funciones generadas
+ * @param gpio Puerto de la entrada, constante
+ * @param bit Pin de la entrada, constante
+ * @param inverted Indica si la entrada se activa con nivel bajo, constante
+ */
+#define DIGITAL_PIN_INPUT(name, gpio, bit, inverted)                                                                  \
+    static inline void name##Init(void) {                                                                             \
+        Chip_GPIO_SetPinDIRInput(LPC_GPIO_PORT, (gpio), (bit));                                                       \
+    }                                                                                                                 \
+    static inline bool name##GetIsActive(void) {                                                                      \
+        return Chip_GPIO_ReadPortBit(LPC_GPIO_PORT, (gpio), (bit)) != (bool)(inverted);                               \
+    }
+
+/* === Public data type declarations =============================================================================== */
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DIGITAL_PIN_H */
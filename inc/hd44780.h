@@ -0,0 +1,102 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Martin Nicolas Soria <soria.m.nicolas@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, disponiblestribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef HD44780_H_
+#define HD44780_H_
+
+/** @file hd44780.h
+ ** @brief Declaraciones del adaptador de la pantalla de 7 segmentos a un LCD de caracteres HD44780
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/** @brief Cantidad maxima de digitos; cada digito ocupa una celda para el caracter y otra para el punto */
+#define HD44780_MAX_DIGITS 8
+
+/** @brief Cantidad maxima de celdas usadas en la primera linea del LCD */
+#define HD44780_MAX_CELLS (2 * HD44780_MAX_DIGITS)
+
+/* === Public data type declarations =============================================================================== */
+
+/** @brief Estructura privada del adaptador */
+typedef struct hd44780_s * hd44780_t;
+
+/**
+ * @brief Funcion que realiza una transaccion de un byte con el LCD
+ *
+ * La implementacion se encarga del modo de 4 u 8 bits y de esperar que el controlador termine la instruccion.
+ *
+ * @param data true para escribir un dato en la DDRAM (RS en alto), false para una instruccion
+ * @param value Byte a escribir
+ */
+typedef void (*hd44780_bus_t)(bool data, uint8_t value);
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Crea un adaptador, inicializa el LCD y lo deja en blanco
+ *
+ * @param digits Cantidad de digitos de la pantalla
+ * @param bus Funcion para realizar transacciones con el LCD
+ * @return hd44780_t Puntero al adaptador creado, NULL si hubo error
+ */
+hd44780_t Hd44780Create(uint8_t digits, hd44780_bus_t bus);
+
+/**
+ * @brief Muestra un cuadro enviando solo las celdas que cambiaron
+ *
+ * Cada digito se convierte al caracter cuyo glifo coincide con sus segmentos y el punto ocupa la celda siguiente.
+ * Las celdas modificadas consecutivas comparten un unico posicionamiento del cursor. Tiene la firma de
+ * frame_transfer_t salvo por la instancia, para usarla desde el driver de la pantalla.
+ *
+ * @param self Adaptador
+ * @param segments Segmentos de cada digito, usando las macros SEGMENT_x de screen.h
+ * @param digits Cantidad de digitos del arreglo
+ * @param brightness Nivel de brillo; 0 apaga la pantalla y cualquier otro valor la enciende
+ */
+void Hd44780WriteFrame(hd44780_t self, const uint8_t segments[], uint8_t digits, uint8_t brightness);
+
+/**
+ * @brief Devuelve la cantidad de transacciones realizadas con el LCD, incluyendo la inicializacion
+ *
+ * @param self Adaptador
+ * @return uint32_t Transacciones realizadas
+ */
+uint32_t Hd44780GetTransactions(hd44780_t self);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HD44780_H_ */
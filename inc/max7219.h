@@ -0,0 +1,98 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Martin Nicolas Soria <soria.m.nicolas@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, disponiblestribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef MAX7219_H_
+#define MAX7219_H_
+
+/** @file max7219.h
+ ** @brief Declaraciones del codificador de cuadros para controladores de pantalla MAX7219
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/** @brief Cantidad maxima de digitos que maneja un MAX7219 */
+#define MAX7219_MAX_DIGITS 8
+
+/** @brief Cantidad maxima de palabras que genera un cuadro: un registro por digito, brillo y apagado */
+#define MAX7219_MAX_WORDS (MAX7219_MAX_DIGITS + 2)
+
+/* === Public data type declarations =============================================================================== */
+
+/** @brief Estructura privada del codificador */
+typedef struct max7219_s * max7219_t;
+
+/**
+ * @brief Funcion que envia palabras de 16 bits por el bus serie, con un pulso de carga despues de cada una
+ *
+ * El buffer pertenece al codificador y solo es valido durante la llamada; una implementacion por DMA debe copiarlo
+ * despues de esperar a que termine la transferencia anterior.
+ */
+typedef void (*max7219_bus_t)(const uint16_t words[], uint8_t count);
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Crea un codificador y envia la secuencia de inicializacion del controlador
+ *
+ * @param digits Cantidad de digitos conectados
+ * @param bus Funcion para enviar palabras por el bus
+ * @return max7219_t Puntero al codificador creado, NULL si hubo error
+ */
+max7219_t Max7219Create(uint8_t digits, max7219_bus_t bus);
+
+/**
+ * @brief Envia un cuadro, transmitiendo solo los registros que cambiaron desde el cuadro anterior
+ *
+ * Tiene la firma de frame_transfer_t salvo por la instancia, para usarla desde el driver de la pantalla.
+ *
+ * @param self Codificador
+ * @param segments Segmentos de cada digito, usando las macros SEGMENT_x de screen.h
+ * @param digits Cantidad de digitos del arreglo
+ * @param brightness Nivel de brillo entre 0 y 15; 0 apaga el controlador
+ */
+void Max7219WriteFrame(max7219_t self, const uint8_t segments[], uint8_t digits, uint8_t brightness);
+
+/**
+ * @brief Devuelve la cantidad total de bytes enviados por el bus, incluyendo la inicializacion
+ *
+ * @param self Codificador
+ * @return uint32_t Bytes enviados
+ */
+uint32_t Max7219GetBytesSent(max7219_t self);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MAX7219_H_ */
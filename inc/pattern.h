@@ -0,0 +1,106 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Martin Nicolas Soria <soria.m.nicolas@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, disponiblestribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+#ifndef PATTERN_H_
+#define PATTERN_H_
+
+/** @file pattern.h
+ ** @brief Declaraciones del reproductor de secuencias de encendido para salidas digitales
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "digital.h"
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/* === Public data type declarations =============================================================================== */
+
+/**
+ * @brief Secuencia de encendido que se repite sin fin
+ *
+ * Las duraciones alternan salida activa e inactiva, empezando por activa, por lo que la cantidad debe ser par.
+ */
+typedef struct pattern_s {
+    const uint16_t * durations; /**< Duracion de cada paso, en milisegundos */
+    uint8_t length;             /**< Cantidad de pasos */
+} pattern_t;
+
+/** @brief Estructura privada del reproductor */
+typedef struct pattern_player_s * pattern_player_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/** @brief Parpadeo simetrico de un segundo de periodo */
+extern const pattern_t PATTERN_BLINK;
+
+/** @brief Destello corto una vez por segundo */
+extern const pattern_t PATTERN_PULSE;
+
+/** @brief SOS en codigo Morse con unidad de 150 ms */
+extern const pattern_t PATTERN_SOS;
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Crea un reproductor detenido sobre una salida digital
+ *
+ * @param output Salida que controla el reproductor
+ * @return pattern_player_t Puntero al reproductor creado, NULL si hubo error
+ */
+pattern_player_t PatternPlayerCreate(digital_output_t output);
+
+/**
+ * @brief Comienza a reproducir una secuencia desde su primer paso, o detiene el reproductor
+ *
+ * Activa la salida y devuelve la duracion del primer paso, que el llamador debe programar en un temporizador
+ * para llamar a PatternAdvance al vencer.
+ *
+ * @param self Reproductor
+ * @param pattern Secuencia a reproducir, NULL para detener y desactivar la salida
+ * @return uint32_t Milisegundos hasta el siguiente paso, 0 si el reproductor quedo detenido
+ */
+uint32_t PatternPlay(pattern_player_t self, const pattern_t * pattern);
+
+/**
+ * @brief Pasa al siguiente paso de la secuencia, pensado para llamarse desde la interrupcion de un temporizador
+ *
+ * Solo escribe la salida al cambiar de paso, por lo que el costo es nulo entre cambios.
+ *
+ * @param self Reproductor
+ * @return uint32_t Milisegundos hasta el siguiente paso, 0 si el reproductor esta detenido
+ */
+uint32_t PatternAdvance(pattern_player_t self);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PATTERN_H_ */
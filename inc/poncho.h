@@ -52,136 +52,39 @@ extern "C" {
 
 /* === Public macros definitions =============================================================== */
  
-// Definiciones de los recursos asociados a los DIGITs de la pantalla
-#define DIGITS_GPIO   0
+// Tablas de pines del poncho: PIN(nombre, puerto SCU, pin SCU, funcion, puerto GPIO, bit GPIO, clase). Las
+// mascaras y el codigo de inicializacion se derivan de estas tablas en bsp.h y bsp.c
 
-#define DIGIT_1_PORT 0
-#define DIGIT_1_PIN  0
-#define DIGIT_1_FUNC SCU_MODE_FUNC0
-#define DIGIT_1_GPIO DIGITS_GPIO
-#define DIGIT_1_BIT  0
-#define DIGIT_1_MASK (1 << DIGIT_1_BIT)
-
-#define DIGIT_2_PORT 0
-#define DIGIT_2_PIN  1
-#define DIGIT_2_FUNC SCU_MODE_FUNC0
-#define DIGIT_2_GPIO DIGITS_GPIO
-#define DIGIT_2_BIT  1
-#define DIGIT_2_MASK (1 << DIGIT_2_BIT)
-
-#define DIGIT_3_PORT 1
-#define DIGIT_3_PIN  15
-#define DIGIT_3_FUNC SCU_MODE_FUNC0
-#define DIGIT_3_GPIO DIGITS_GPIO
-#define DIGIT_3_BIT  2
-#define DIGIT_3_MASK (1 << DIGIT_3_BIT)
-
-#define DIGIT_4_PORT 1
-#define DIGIT_4_PIN  17
-#define DIGIT_4_FUNC SCU_MODE_FUNC0
-#define DIGIT_4_GPIO DIGITS_GPIO
-#define DIGIT_4_BIT  3
-#define DIGIT_4_MASK (1 << DIGIT_4_BIT)
-
-#define DIGITS_MASK (DIGIT_1_MASK | DIGIT_2_MASK | DIGIT_3_MASK | DIGIT_4_MASK)
-
-// Definiciones de los recursos asociados a los SEGMENTs de la pantalla
+// Puertos GPIO compartidos por los digitos y los segmentos de la pantalla
+#define DIGITS_GPIO   0
 #define SEGMENTS_GPIO 2
 
-#define SEGMENT_A_PORT 4
-#define SEGMENT_A_PIN  0
-#define SEGMENT_A_FUNC SCU_MODE_FUNC0
-#define SEGMENT_A_GPIO SEGMENTS_GPIO
-#define SEGMENT_A_BIT  0
-#define SEGMENT_A_MASK (1 << SEGMENT_A_BIT)
-
-#define SEGMENT_B_PORT 4
-#define SEGMENT_B_PIN  1
-#define SEGMENT_B_FUNC SCU_MODE_FUNC0
-#define SEGMENT_B_GPIO SEGMENTS_GPIO
-#define SEGMENT_B_BIT  1
-#define SEGMENT_B_MASK (1 << SEGMENT_B_BIT)
-
-#define SEGMENT_C_PORT 4
-#define SEGMENT_C_PIN  2
-#define SEGMENT_C_FUNC SCU_MODE_FUNC0
-#define SEGMENT_C_GPIO SEGMENTS_GPIO
-#define SEGMENT_C_BIT  2
-#define SEGMENT_C_MASK (1 << SEGMENT_C_BIT)
-
-#define SEGMENT_D_PORT 4
-#define SEGMENT_D_PIN  3
-#define SEGMENT_D_FUNC SCU_MODE_FUNC0
-#define SEGMENT_D_GPIO SEGMENTS_GPIO
-#define SEGMENT_D_BIT  3
-#define SEGMENT_D_MASK (1 << SEGMENT_D_BIT)
-
-#define SEGMENT_E_PORT 4
-#define SEGMENT_E_PIN  4
-#define SEGMENT_E_FUNC SCU_MODE_FUNC0
-#define SEGMENT_E_GPIO SEGMENTS_GPIO
-#define SEGMENT_E_BIT  4
-#define SEGMENT_E_MASK (1 << SEGMENT_E_BIT)
-
-#define SEGMENT_F_PORT 4
-#define SEGMENT_F_PIN  5
-#define SEGMENT_F_FUNC SCU_MODE_FUNC0
-#define SEGMENT_F_GPIO SEGMENTS_GPIO
-#define SEGMENT_F_BIT  5
-#define SEGMENT_F_MASK (1 << SEGMENT_F_BIT)
-
-#define SEGMENT_G_PORT 4
-#define SEGMENT_G_PIN  6
-#define SEGMENT_G_FUNC SCU_MODE_FUNC0
-#define SEGMENT_G_GPIO SEGMENTS_GPIO
-#define SEGMENT_G_BIT  6
-#define SEGMENT_G_MASK (1 << SEGMENT_G_BIT)
-
-#define SEGMENTS_MASK (SEGMENT_A_MASK | SEGMENT_B_MASK | SEGMENT_C_MASK | \
-        SEGMENT_D_MASK | SEGMENT_E_MASK | SEGMENT_F_MASK | SEGMENT_G_MASK )
-
-#define SEGMENT_P_PORT 6
-#define SEGMENT_P_PIN  8
-#define SEGMENT_P_FUNC SCU_MODE_FUNC4
-#define SEGMENT_P_GPIO 5
-#define SEGMENT_P_BIT  16
-
-// Definiciones de los recursos asociados a las teclas del poncho
-#define KEY_F1_PORT 4
-#define KEY_F1_PIN  8
-#define KEY_F1_FUNC SCU_MODE_FUNC4
-#define KEY_F1_GPIO 5
-#define KEY_F1_BIT  12
-
-#define KEY_F2_PORT 4
-#define KEY_F2_PIN  9
-#define KEY_F2_FUNC SCU_MODE_FUNC4
-#define KEY_F2_GPIO 5
-#define KEY_F2_BIT  13
-
-#define KEY_F3_PORT 4
-#define KEY_F3_PIN  10
-#define KEY_F3_FUNC SCU_MODE_FUNC4
-#define KEY_F3_GPIO 5
-#define KEY_F3_BIT  14
-
-#define KEY_F4_PORT 6
-#define KEY_F4_PIN  7
-#define KEY_F4_FUNC SCU_MODE_FUNC4
-#define KEY_F4_GPIO 5
-#define KEY_F4_BIT  15
-
-#define KEY_ACCEPT_PIN  2
-#define KEY_ACCEPT_PORT 3
-#define KEY_ACCEPT_FUNC SCU_MODE_FUNC4
-#define KEY_ACCEPT_GPIO 5
-#define KEY_ACCEPT_BIT  9
-
-#define KEY_CANCEL_PORT 3
-#define KEY_CANCEL_PIN  1
-#define KEY_CANCEL_FUNC SCU_MODE_FUNC4
-#define KEY_CANCEL_GPIO 5
-#define KEY_CANCEL_BIT  8
+// Pines de la pantalla de 7 segmentos
+#define PONCHO_DISPLAY_PINS(PIN)                                                                                      \
+    PIN(DIGIT_1,   0, 0,  SCU_MODE_FUNC0, 0, 0,  BSP_PIN_DIGIT)                                                       \
+    PIN(DIGIT_2,   0, 1,  SCU_MODE_FUNC0, 0, 1,  BSP_PIN_DIGIT)                                                       \
+    PIN(DIGIT_3,   1, 15, SCU_MODE_FUNC0, 0, 2,  BSP_PIN_DIGIT)                                                       \
+    PIN(DIGIT_4,   1, 17, SCU_MODE_FUNC0, 0, 3,  BSP_PIN_DIGIT)                                                       \
+    PIN(SEGMENT_A, 4, 0,  SCU_MODE_FUNC0, 2, 0,  BSP_PIN_SEGMENT)                                                     \
+    PIN(SEGMENT_B, 4, 1,  SCU_MODE_FUNC0, 2, 1,  BSP_PIN_SEGMENT)                                                     \
+    PIN(SEGMENT_C, 4, 2,  SCU_MODE_FUNC0, 2, 2,  BSP_PIN_SEGMENT)                                                     \
+    PIN(SEGMENT_D, 4, 3,  SCU_MODE_FUNC0, 2, 3,  BSP_PIN_SEGMENT)                                                     \
+    PIN(SEGMENT_E, 4, 4,  SCU_MODE_FUNC0, 2, 4,  BSP_PIN_SEGMENT)                                                     \
+    PIN(SEGMENT_F, 4, 5,  SCU_MODE_FUNC0, 2, 5,  BSP_PIN_SEGMENT)                                                     \
+    PIN(SEGMENT_G, 4, 6,  SCU_MODE_FUNC0, 2, 6,  BSP_PIN_SEGMENT)                                                     \
+    PIN(SEGMENT_P, 6, 8,  SCU_MODE_FUNC4, 5, 16, BSP_PIN_POINT)
+
+// Teclas de funcion del poncho
+#define PONCHO_FUNCTION_KEY_PINS(PIN)                                                                                 \
+    PIN(KEY_F1,     4, 8,  SCU_MODE_FUNC4, 5, 12, BSP_PIN_KEY)                                                        \
+    PIN(KEY_F2,     4, 9,  SCU_MODE_FUNC4, 5, 13, BSP_PIN_KEY)                                                        \
+    PIN(KEY_F3,     4, 10, SCU_MODE_FUNC4, 5, 14, BSP_PIN_KEY)                                                        \
+    PIN(KEY_F4,     6, 7,  SCU_MODE_FUNC4, 5, 15, BSP_PIN_KEY)
+
+// Teclas de aceptar y cancelar del poncho
+#define PONCHO_CONFIRM_KEY_PINS(PIN)                                                                                  \
+    PIN(KEY_ACCEPT, 3, 2,  SCU_MODE_FUNC4, 5, 9,  BSP_PIN_KEY)                                                        \
+    PIN(KEY_CANCEL, 3, 1,  SCU_MODE_FUNC4, 5, 8,  BSP_PIN_KEY)
 
 
 // Definiciones de los recursos asociados a los LEDs del poncho
@@ -0,0 +1,93 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Martin Nicolas Soria <soria.m.nicolas@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, disponiblestribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+#ifndef POOL_H_
+#define POOL_H_
+
+/** @file pool.h
+ ** @brief Reserva de memoria de los objetos de los modulos, desde el heap o desde arreglos estaticos
+ **
+ ** Con STATIC_ALLOCATION en 1 ningun modulo llama a malloc: cada uno declara con POOL_DECLARE un arreglo con la
+ ** cantidad maxima de objetos que puede crear y POOL_ALLOC devuelve NULL cuando se agota, igual que malloc sin
+ ** memoria. La cantidad de cada modulo se define en su archivo fuente y puede cambiarse desde la compilacion. El
+ ** mismo simbolo configura FreeRTOS en FreeRTOSConfig.h para crear tareas y temporizadores sin heap. POOL_DECLARE se
+ ** escribe sin punto y coma final, porque con STATIC_ALLOCATION en 0 no genera nada.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdint.h>
+#include <stdlib.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/** @brief Reserva todos los objetos en arreglos estaticos (1) o con malloc (0) */
+#ifndef STATIC_ALLOCATION
+#define STATIC_ALLOCATION 0
+#endif
+
+#if STATIC_ALLOCATION
+
+/**
+ * @brief Declara el arreglo estatico de un modulo y la cantidad de objetos ya entregados
+ *
+ * @param type Estructura de los objetos
+ * @param name Nombre del arreglo
+ * @param count Cantidad maxima de objetos
+ */
+#define POOL_DECLARE(type, name, count)                                                                               \
+    static type name[count];                                                                                          \
+    static uint8_t name##_used;
+
+/**
+ * @brief Entrega el siguiente objeto libre del arreglo, o NULL si ya se entregaron todos
+ *
+ * @param type Estructura de los objetos
+ * @param name Nombre del arreglo declarado con POOL_DECLARE
+ */
+#define POOL_ALLOC(type, name)                                                                                        \
+    ((name##_used < sizeof(name) / sizeof(name[0])) ? &name[name##_used++] : (type *)NULL)
+
+#else
+
+#define POOL_DECLARE(type, name, count)
+#define POOL_ALLOC(type, name)          ((type *)malloc(sizeof(type)))
+
+#endif
+
+/* === Public data type declarations =============================================================================== */
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* POOL_H_ */
@@ -0,0 +1,151 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Martin Nicolas Soria <soria.m.nicolas@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, disponiblestribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+#ifndef PROBE_H_
+#define PROBE_H_
+
+/** @file probe.h
+ ** @brief Declaraciones de las sondas que miden la duracion de los caminos criticos
+ **
+ ** Cada sonda encierra un tramo de codigo entre PROBE_BEGIN y PROBE_END y acumula en una tabla fija el minimo, el
+ ** maximo, el promedio y un histograma del que salen los percentiles. En la placa el contador es el de ciclos del DWT
+ ** del Cortex-M4; en el host son nanosegundos de clock_gettime. Con PROBE_ENABLED en 0 las macros no generan codigo y
+ ** probe.c queda vacio.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/** @brief Compila las sondas (1) o las elimina del todo (0) */
+#ifndef PROBE_ENABLED
+#define PROBE_ENABLED 0
+#endif
+
+/** @brief Cantidad de intervalos del histograma de cada sonda. Cada potencia de dos se parte en cuatro intervalos,
+ * asi el percentil se informa con un error menor al 25%; con 64 intervalos se cubren hasta 131071 cuentas y las
+ * mayores caen en el ultimo */
+#define PROBE_BINS 64
+
+/** @brief Indica si se compila para el Cortex-M de la placa, que tiene el contador de ciclos del DWT */
+#if defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_7M__)
+#define PROBE_TARGET 1
+#else
+#define PROBE_TARGET 0
+#endif
+
+/** @brief Lectura del contador de las sondas, reemplazable desde el build con otra expresion de 32 bits */
+#ifndef PROBE_COUNTER
+#if PROBE_TARGET
+#define PROBE_COUNTER() (*(volatile uint32_t *)0xE0001004UL) // DWT->CYCCNT
+#else
+#define PROBE_COUNTER() ProbeHostCounter()
+#endif
+#endif
+
+#if PROBE_ENABLED
+/** @brief Comienza la medicion de una sonda; debe cerrarse con PROBE_END en el mismo bloque */
+#define PROBE_BEGIN(probe) uint32_t probe_start_##probe = PROBE_COUNTER()
+/** @brief Termina la medicion de una sonda y la registra */
+#define PROBE_END(probe)   ProbeRecord(probe, PROBE_COUNTER() - probe_start_##probe)
+#else
+#define PROBE_BEGIN(probe) ((void)0)
+#define PROBE_END(probe)   ((void)0)
+#endif
+
+/* === Public data type declarations =============================================================================== */
+
+/** @brief Sondas de los caminos criticos; cada una se registra desde un solo contexto */
+typedef enum {
+    PROBE_CLOCK_TICK = 0,  //!< ClockNewTick, en la tarea o el trabajo del reloj
+    PROBE_SCREEN_REFRESH,  //!< ScreenRefreshTimed en la interrupcion de TIMER0, o ScreenRefresh desde la tarea
+    PROBE_UI_RENDER,       //!< ui_render de app.c, en la tarea o el trabajo de la interfaz
+    PROBE_DIGITAL_CHANGED, //!< DigitalWasChanged, en la tarea o el trabajo de los botones
+    PROBE_COUNT
+} probe_id_t;
+
+/** @brief Resumen de una sonda, en cuentas del contador */
+typedef struct probe_stats_s {
+    uint32_t count; //!< Mediciones registradas
+    uint32_t min;   //!< Medicion minima
+    uint32_t max;   //!< Medicion maxima
+    uint32_t mean;  //!< Promedio
+    uint32_t p50;   //!< Mediana, como el limite superior de su intervalo del histograma
+    uint32_t p90;   //!< Percentil 90
+    uint32_t p99;   //!< Percentil 99
+} probe_stats_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Pone en marcha el contador de las sondas; en la placa habilita el contador de ciclos del DWT
+ */
+void ProbeCounterStart(void);
+
+/**
+ * @brief Devuelve el contador del host, en nanosegundos truncados a 32 bits
+ */
+uint32_t ProbeHostCounter(void);
+
+/**
+ * @brief Registra una medicion de una sonda
+ *
+ * @param probe Sonda
+ * @param elapsed Duracion medida, en cuentas del contador
+ */
+void ProbeRecord(probe_id_t probe, uint32_t elapsed);
+
+/**
+ * @brief Calcula el resumen de una sonda
+ *
+ * @param probe Sonda
+ * @param stats Resumen calculado
+ * @return true Si la sonda tiene mediciones
+ */
+bool ProbeGetStats(probe_id_t probe, probe_stats_t * stats);
+
+/**
+ * @brief Devuelve el nombre de una sonda para los informes, NULL si no existe
+ */
+const char * ProbeName(probe_id_t probe);
+
+/**
+ * @brief Borra las mediciones de todas las sondas
+ */
+void ProbeReset(void);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PROBE_H_ */
@@ -46,7 +46,31 @@ extern "C" {
 #define SEGMENT_G (1 << 6)
 #define SEGMENT_P (1 << 7)
 
-
+/** @brief Glifo que se muestra para codigos o caracteres sin representacion en 7 segmentos */
+#define SCREEN_GLYPH_INVALID (SEGMENT_A | SEGMENT_D | SEGMENT_G)
+
+/** @brief Atributo de digito: el digito parpadea con la velocidad fijada por DisplayFlashDigit */
+#define SCREEN_ATTR_BLINK (1 << 0)
+/** @brief Atributo de digito: el punto decimal esta encendido */
+#define SCREEN_ATTR_POINT (1 << 1)
+/** @brief Atributo de digito: el punto decimal parpadea con la velocidad fijada por DisplayFlashPoints */
+#define SCREEN_ATTR_POINT_BLINK (1 << 2)
+/** @brief Atributo de digito: el digito se muestra apagado sin perder su valor */
+#define SCREEN_ATTR_BLANK (1 << 3)
+
+/** @brief Cantidad de bits de la modulacion por codigo binario usada para el brillo */
+#define SCREEN_BRIGHTNESS_BITS 4
+/** @brief Cantidad de niveles de brillo disponibles */
+#define SCREEN_BRIGHTNESS_LEVELS (1 << SCREEN_BRIGHTNESS_BITS)
+/** @brief Nivel de brillo maximo, que es el valor inicial */
+#define SCREEN_BRIGHTNESS_MAX (SCREEN_BRIGHTNESS_LEVELS - 1)
+/** @brief Tiempo minimo por digito del refresco temporizado, para que el subcuadro mas corto dure al menos 1 */
+#define SCREEN_MIN_REFRESH_PERIOD (SCREEN_BRIGHTNESS_LEVELS - 1)
+
+#ifndef SCREEN_MARQUEE_LENGTH
+/** @brief Capacidad del buffer de marquesina, incluyendo un espacio en blanco de entrada y salida por digito */
+#define SCREEN_MARQUEE_LENGTH 64
+#endif
 
 /* === Public data type declarations =============================================================================== */
 /** @brief Estructura privada para el controlador de pantalla */
@@ -61,13 +85,43 @@ typedef void (*digits_update_t)(uint8_t);
 /** @brief Funcion para encender un digito especifico */
 typedef void (*digit_turn_on_t)(uint8_t);
 
+/** @brief Funcion para dejar la pantalla a oscuras durante un subcuadro apagado */
+typedef void (*blanking_interval_t)(void);
+
+/** @brief Funcion para mostrar un digito completo, apagando el anterior, en una secuencia fija de escrituras */
+typedef void (*digit_commit_t)(uint8_t digit, uint8_t segments);
+
+/** @brief Funcion para enviar un cuadro completo a un controlador que multiplexa por su cuenta */
+typedef void (*frame_transfer_t)(const uint8_t segments[], uint8_t digits, uint8_t brightness);
+
 /** @brief Driver para controlar la pantalla de 7 segmentos*/
 typedef struct screen_driver_s {
     digits_turn_of_t DigitsTurnOff;
     digits_update_t SegmentsUpdate;
     digit_turn_on_t DigitTurnOn;
+    blanking_interval_t BlankingInterval; /**< Opcional, si es NULL se usa DigitsTurnOff */
+    digit_commit_t DigitCommit;           /**< Opcional, si es NULL se usan las tres funciones anteriores */
+    frame_transfer_t FrameTransfer;       /**< Opcional, si no es NULL reemplaza el barrido por digito */
 } const * screen_driver_t;
 
+/** @brief Animaciones que se muestran al publicar un cuadro con digitos distintos */
+typedef enum screen_transition_e {
+    SCREEN_TRANSITION_NONE = 0, /**< Los digitos cambian de inmediato */
+    SCREEN_TRANSITION_ROLL,     /**< El valor anterior sube y el nuevo entra desde abajo */
+    SCREEN_TRANSITION_FADE,     /**< Fundido por tramado temporal entre el valor anterior y el nuevo */
+    SCREEN_TRANSITION_WIPE,     /**< Los digitos se reemplazan de izquierda a derecha */
+} screen_transition_t;
+
+/** @brief Estadisticas del jitter medido entre refrescos temporizados */
+typedef struct screen_jitter_s {
+    uint32_t period;   /**< Tiempo asignado a cada digito, en unidades del temporizador */
+    uint32_t count;    /**< Cantidad de intervalos medidos */
+    int32_t last;      /**< Desvio del ultimo intervalo respecto del intervalo programado */
+    int32_t min;       /**< Menor desvio registrado */
+    int32_t max;       /**< Mayor desvio registrado */
+    uint64_t sum_abs;  /**< Suma de los valores absolutos de los desvios, para calcular el promedio */
+} screen_jitter_t;
+
 /* === Public variable declarations ================================================================================ */
 
 /* === Public function declarations ================================================================================ */
@@ -85,20 +139,190 @@ screen_t ScreenCreate(uint8_t digits, screen_driver_t driver);
 /**
  * @brief Muestra un arreglo de dígitos BCD en la pantalla
  *
+ * Como el resto de las funciones de escritura, compone sobre el cuadro en preparación. Los cambios se muestran
+ * recién después de llamar a ScreenPublish.
+ *
  * @param screen Pantalla a modificar
  * @param value Arreglo de valores BCD
  * @param size Cantidad de valores en el arreglo
  */
 void ScreenWriteBCD(screen_t screen, uint8_t value[], uint8_t size);
 
+/**
+ * @brief Muestra segmentos crudos en la pantalla, sin pasar por la tabla de glifos
+ *
+ * @param screen Pantalla a modificar
+ * @param segments Arreglo con los segmentos de cada digito, usando las macros SEGMENT_x
+ * @param size Cantidad de digitos en el arreglo
+ */
+void ScreenWriteSegments(screen_t screen, const uint8_t segments[], uint8_t size);
+
+/**
+ * @brief Muestra una cadena de texto en la pantalla
+ *
+ * Cada caracter ocupa un digito, salvo el punto que se agrega al digito anterior. Los caracteres sin
+ * representacion se muestran con SCREEN_GLYPH_INVALID y los digitos sobrantes quedan apagados.
+ *
+ * @param screen Pantalla a modificar
+ * @param text Cadena terminada en cero
+ * @return uint8_t Cantidad de digitos escritos
+ */
+uint8_t ScreenWriteText(screen_t screen, const char * text);
+
+/**
+ * @brief Convierte un caracter en los segmentos que lo representan
+ *
+ * @param character Caracter ASCII a convertir
+ * @return uint8_t Segmentos del glifo, o SCREEN_GLYPH_INVALID si el caracter no tiene representacion
+ */
+uint8_t ScreenCharToSegments(char character);
+
+/**
+ * @brief Muestra una hora en formato HH:MM a partir de sus digitos BCD
+ *
+ * Usa tablas precalculadas de pares de segmentos para 00 a 23 y 00 a 59, sin conversiones intermedias. Mientras la
+ * hora no cambia y no hubo otras escrituras, la llamada no modifica el cuadro en preparacion. Los valores fuera de
+ * rango se muestran con SCREEN_GLYPH_INVALID.
+ *
+ * @param screen Pantalla a modificar, con al menos cuatro digitos
+ * @param hours Digitos BCD de las horas, unidades en la posicion 0 y decenas en la 1
+ * @param minutes Digitos BCD de los minutos, unidades en la posicion 0 y decenas en la 1
+ * @return 0 si fue exitoso, -1 si hubo error
+ */
+int ScreenWriteTime(screen_t screen, const uint8_t hours[2], const uint8_t minutes[2]);
+
+/**
+ * @brief Desplaza una secuencia de segmentos de cualquier largo a traves de la pantalla
+ *
+ * La secuencia se copia una sola vez en el cuadro en preparacion, precedida y seguida por un digito en blanco por
+ * cada digito de la pantalla. El refresco solo corre la ventana visible una posicion cada `divisor` barridos, hasta
+ * que el texto sale por completo. Los atributos de parpadeo no se aplican mientras dura la marquesina y cualquier
+ * otra escritura la cancela.
+ *
+ * @param screen Pantalla a modificar
+ * @param segments Segmentos de cada posicion, usando las macros SEGMENT_x
+ * @param length Cantidad de posiciones de la secuencia
+ * @param divisor Cantidad de barridos entre cada paso del desplazamiento, mayor que cero
+ * @return 0 si fue exitoso, -1 si la secuencia no entra en SCREEN_MARQUEE_LENGTH o hubo error
+ */
+int ScreenWriteMarqueeSegments(screen_t screen, const uint8_t segments[], uint16_t length, uint16_t divisor);
+
+/**
+ * @brief Desplaza un texto de cualquier largo a traves de la pantalla
+ *
+ * El texto se convierte a segmentos con las mismas reglas que ScreenWriteText y luego se comporta igual que
+ * ScreenWriteMarqueeSegments.
+ *
+ * @param screen Pantalla a modificar
+ * @param text Cadena terminada en cero
+ * @param divisor Cantidad de barridos entre cada paso del desplazamiento, mayor que cero
+ * @return 0 si fue exitoso, -1 si el texto no entra en SCREEN_MARQUEE_LENGTH o hubo error
+ */
+int ScreenWriteMarquee(screen_t screen, const char * text, uint16_t divisor);
+
+/**
+ * @brief Configura la animacion que se muestra cuando cambian los digitos publicados
+ *
+ * Los cuadros intermedios se precalculan en ScreenPublish; el refresco solo avanza un indice cada `divisor`
+ * barridos, con el mismo costo que sin animacion. Una publicacion con otro valor a mitad de una animacion la
+ * cancela y comienza la siguiente desde el ultimo valor publicado.
+ *
+ * @param screen Pantalla a configurar
+ * @param type Tipo de animacion
+ * @param divisor Cantidad de barridos que se muestra cada cuadro intermedio, mayor que cero salvo sin animacion
+ * @return 0 si fue exitoso, -1 si hubo error
+ */
+int ScreenSetTransition(screen_t screen, screen_transition_t type, uint16_t divisor);
+
+/**
+ * @brief Informa si la ultima marquesina escrita ya termino de mostrarse
+ *
+ * Se consulta desde la tarea de interfaz; el refresco marca la finalizacion cuando la ventana llega al final.
+ *
+ * @param screen Pantalla a consultar
+ * @return true si la marquesina termino, false si sigue desplazandose o no hay marquesina
+ */
+bool ScreenMarqueeFinished(screen_t screen);
+
+
+/**
+ * @brief Publica el cuadro en preparación para que se muestre a partir del próximo barrido
+ *
+ * El intercambio es atómico, sin bloqueos: el refresco nunca ve un cuadro a medio componer y todos los dígitos
+ * de un barrido salen del mismo cuadro. El cuadro en preparación sigue conteniendo lo publicado, por lo que las
+ * escrituras siguientes pueden ser incrementales.
+ *
+ * @param self Instancia de pantalla
+ */
+void ScreenPublish(screen_t self);
 
 /**
  * @brief Actualiza el estado visual de un dígito de la pantalla
  *
+ * Con un driver que ofrece FrameTransfer cada llamada equivale a un barrido completo: toma el ultimo cuadro
+ * publicado y lo envia solo si cambio lo que muestra el controlador.
+ *
  * @param screen Pantalla a actualizar
  */
 void ScreenRefresh(screen_t screen);
 
+/**
+ * @brief Apaga la pantalla para dejar de refrescarla
+ *
+ * Apaga los dígitos, o envía el cuadro con brillo 0 a un driver con FrameTransfer, y reinicia el barrido. El
+ * siguiente refresco vuelve a encenderla empezando por el primer dígito con el último cuadro publicado, y el
+ * tiempo que estuvo apagada no se cuenta como jitter.
+ *
+ * @param self Instancia de pantalla
+ */
+void ScreenSleep(screen_t self);
+
+/**
+ * @brief Configura el tiempo asignado a cada dígito en el refresco temporizado y reinicia las estadisticas
+ *
+ * Con este valor se precalculan las duraciones de los subcuadros de la modulación de brillo. Un periodo menor que
+ * SCREEN_MIN_REFRESH_PERIOD dejaria subcuadros de duracion nula, por lo que se toma el minimo.
+ *
+ * @param self Instancia de pantalla
+ * @param period Tiempo por dígito, en las mismas unidades que las marcas de tiempo del temporizador, al menos
+ * SCREEN_MIN_REFRESH_PERIOD
+ */
+void ScreenSetRefreshPeriod(screen_t self, uint32_t period);
+
+/**
+ * @brief Muestra el siguiente subcuadro desde la interrupcion de un temporizador y registra el jitter
+ *
+ * Con brillo máximo cada dígito se muestra en un solo subcuadro. Con cualquier otro nivel cada dígito se divide
+ * en SCREEN_BRIGHTNESS_BITS subcuadros de duraciones 1, 2, 4, ... (modulación por código binario), tomados de
+ * una tabla precalculada, por lo que el costo de cada llamada no depende del nivel de brillo.
+ *
+ * @param self Instancia de pantalla
+ * @param timestamp Valor del contador libre del temporizador al momento de la interrupcion
+ * @return uint32_t Tiempo hasta la próxima llamada, en unidades del temporizador
+ */
+uint32_t ScreenRefreshTimed(screen_t self, uint32_t timestamp);
+
+/**
+ * @brief Fija el brillo de la pantalla en el cuadro en preparación
+ *
+ * El brillo solo se aplica en el refresco temporizado y toma efecto al publicar el cuadro.
+ *
+ * @param self Instancia de pantalla
+ * @param level Nivel de brillo, de 0 (apagada) a SCREEN_BRIGHTNESS_MAX
+ * @return 0 si fue exitoso, -1 si hubo error
+ */
+int ScreenSetBrightness(screen_t self, uint8_t level);
+
+/**
+ * @brief Obtiene las estadisticas de jitter de los refrescos temporizados
+ *
+ * @param self Instancia de pantalla
+ * @param stats Puntero donde se copian las estadisticas
+ * @return true Si las estadisticas fueron copiadas
+ * @return false Si algun parametro es invalido
+ */
+bool ScreenGetJitter(screen_t self, screen_jitter_t * stats);
+
 
 /**
  * @brief Hace parpadear un rango de dígitos de la pantalla
@@ -106,7 +330,7 @@ void ScreenRefresh(screen_t screen);
  * @param self Instancia de pantalla
  * @param from Dígito inicial
  * @param to Dígito final
- * @param divisor Controla la velocidad del parpadeo
+ * @param divisor Controla la velocidad del parpadeo, 0 lo deshabilita
  * @return 0 si fue exitoso, -1 si hubo error
  */
 int DisplayFlashDigit(screen_t self, uint8_t from, uint8_t to, uint8_t divisor);
@@ -136,11 +360,45 @@ void ScreenDisablePoint(screen_t self, uint8_t digit);
  * @param self Instancia de pantalla
  * @param from Índice inicial
  * @param to Índice final
- * @param divisor Controla la velocidad del parpadeo
+ * @param divisor Controla la velocidad del parpadeo, 0 lo deshabilita
  * @return 0 si fue exitoso, -1 si hubo error
  */
 int DisplayFlashPoints(screen_t self, uint8_t from, uint8_t to, uint8_t divisor);
 
+/**
+ * @brief Agrega atributos a un rango de dígitos, sin modificar los del resto
+ *
+ * Permite tener varias regiones independientes parpadeando a la vez. Los cuadros de cada fase de parpadeo se
+ * precomponen en este momento, de modo que el refresco solo selecciona la fase y lee un valor por dígito.
+ *
+ * @param self Instancia de pantalla
+ * @param from Índice inicial
+ * @param to Índice final
+ * @param attributes Combinación de atributos SCREEN_ATTR_*
+ * @return 0 si fue exitoso, -1 si hubo error
+ */
+int ScreenSetAttributes(screen_t self, uint8_t from, uint8_t to, uint8_t attributes);
+
+/**
+ * @brief Quita atributos de un rango de dígitos, sin modificar los del resto
+ *
+ * @param self Instancia de pantalla
+ * @param from Índice inicial
+ * @param to Índice final
+ * @param attributes Combinación de atributos SCREEN_ATTR_*
+ * @return 0 si fue exitoso, -1 si hubo error
+ */
+int ScreenClearAttributes(screen_t self, uint8_t from, uint8_t to, uint8_t attributes);
+
+/**
+ * @brief Obtiene los atributos de un dígito
+ *
+ * @param self Instancia de pantalla
+ * @param digit Índice del dígito
+ * @return uint8_t Combinación de atributos SCREEN_ATTR_* del dígito
+ */
+uint8_t ScreenGetAttributes(screen_t self, uint8_t digit);
+
 /* === End of conditional blocks =================================================================================== */
 
 #ifdef __cplusplus
@@ -0,0 +1,104 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Martin Nicolas Soria <soria.m.nicolas@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, disponiblestribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+#ifndef SLEEP_H_
+#define SLEEP_H_
+
+/** @file sleep.h
+ ** @brief Declaraciones de la politica de apagado de la pantalla por inactividad y horario nocturno
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/** @brief Minuto del dia a usar cuando la hora del reloj todavia no es valida; nunca cae en la ventana nocturna */
+#define SLEEP_MINUTE_UNKNOWN 0xFFFF
+
+/** @brief Tiempo maximo que una tecla mantiene encendida la pantalla de noche, en milisegundos; tambien se usa de dia
+ * para descartar la actividad si el apagado por inactividad esta deshabilitado */
+#define SLEEP_NIGHT_HOLD 60000
+
+/* === Public data type declarations =============================================================================== */
+
+/** @brief Estructura privada de la politica de apagado */
+typedef struct sleep_s * sleep_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Crea una politica de apagado de la pantalla
+ *
+ * La pantalla se considera en uso al crear la politica. Si `night_from` y `night_to` son iguales no hay ventana
+ * nocturna; si `night_from` es mayor que `night_to` la ventana cruza la medianoche.
+ *
+ * @param timeout Tiempo sin actividad hasta apagar la pantalla, en milisegundos; 0 deshabilita el apagado por
+ * inactividad
+ * @param night_from Minuto del dia en que empieza la ventana nocturna, de 0 a 1439
+ * @param night_to Minuto del dia en que termina la ventana nocturna, de 0 a 1439
+ * @return sleep_t Puntero a la politica creada, NULL si hubo error
+ */
+sleep_t SleepCreate(uint32_t timeout, uint16_t night_from, uint16_t night_to);
+
+/**
+ * @brief Registra actividad del usuario, por ejemplo una tecla
+ *
+ * Solo incrementa un contador, por lo que puede llamarse desde otra tarea que la que consulta la politica. El
+ * momento de la actividad se toma en la siguiente llamada a SleepIsAwake.
+ *
+ * @param self Politica de apagado
+ */
+void SleepActivity(sleep_t self);
+
+/**
+ * @brief Evalua si la pantalla debe estar encendida
+ *
+ * La alarma activa o la actividad reciente la mantienen encendida. Sin actividad reciente se apaga durante la
+ * ventana nocturna, y fuera de ella solo si el apagado por inactividad esta habilitado. Dentro de la ventana la
+ * actividad es reciente durante SLEEP_NIGHT_HOLD, o el tiempo de inactividad si es menor, aunque haya ocurrido antes
+ * de que la ventana empiece.
+ *
+ * @param self Politica de apagado
+ * @param now Tiempo actual en milisegundos, de un contador libre que puede desbordar
+ * @param minute Minuto del dia segun el reloj, o SLEEP_MINUTE_UNKNOWN
+ * @param alarm Indica si la alarma esta sonando
+ * @return true La pantalla debe estar encendida
+ * @return false La pantalla debe estar apagada
+ */
+bool SleepIsAwake(sleep_t self, uint32_t now, uint16_t minute, bool alarm);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SLEEP_H_ */
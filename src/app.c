@@ -27,14 +27,60 @@ SPDX-License-Identifier: MIT
 #include "clock.h"
 #include "screen.h"
 #include "digital.h"
+#include "sleep.h"
+#include "diag.h"
+#include "deadline.h"
+#include "probe.h"
 #include "FreeRTOS.h"
 #include "task.h"
-#include "timers.h"
 #include <string.h>
 #include <stdbool.h>
 #include <stdint.h>
 /* === Macros definitions ========================================================================================== */
 
+/* Divisor de parpadeo para mantener un periodo de unos 800 ms con cualquiera de los modos de refresco: el
+ * parpadeo dura 2 * divisor barridos completos de los 4 digitos */
+#if BSP_SCREEN_REFRESH_ISR
+#define UI_FLASH_DIVISOR (BSP_SCREEN_REFRESH_HZ / 10)
+/* DisplayFlashDigit y DisplayFlashPoints reciben el divisor en 8 bits; con 2560 Hz o mas cambiaria el parpadeo */
+BSP_STATIC_ASSERT(UI_FLASH_DIVISOR <= UINT8_MAX, flash_divisor_fits);
+#elif BSP_DISPLAY_MAX7219 || BSP_DISPLAY_HD44780
+#define UI_FLASH_DIVISOR 80
+#else
+#define UI_FLASH_DIVISOR 20
+#endif
+
+/* Apagado de la pantalla: minutos sin teclas hasta apagarla (0 deshabilita) y ventana nocturna en minutos del dia,
+ * durante la cual se apaga aunque el apagado por inactividad este deshabilitado */
+#ifndef UI_SLEEP_TIMEOUT_MIN
+#define UI_SLEEP_TIMEOUT_MIN 10
+#endif
+#ifndef UI_NIGHT_FROM
+#define UI_NIGHT_FROM (23 * 60)
+#endif
+#ifndef UI_NIGHT_TO
+#define UI_NIGHT_TO (7 * 60)
+#endif
+
+/* Con la pantalla apagada la tarea de interfaz se despierta una vez por minuto para ver si termino la noche */
+#define UI_SLEEP_RECHECK_MS 60000
+
+/* Tiempo sin teclas en los modos de configuracion hasta volver al modo normal */
+#define UI_EDIT_TIMEOUT_MS 30000
+
+/* Tiempo que hay que sostener una tecla, o las dos de configuracion juntas para el modo de diagnostico */
+#define UI_HOLD_MS 3000
+
+/* Periodo de las muestras de uso de CPU, pila y heap mientras se muestra el modo de diagnostico */
+#define UI_DIAG_SAMPLE_MS 1000
+
+/* Clave de render que no corresponde a ningun estado, para obligar a componer y publicar el cuadro siguiente */
+#define UI_RENDER_KEY_NONE 0xFFFFFFFFu
+
+/* El contador de ejecucion, las muestras del kernel y los plazos solo existen con las tareas de FreeRTOS */
+#define UI_KERNEL_STATS (APP_RUNTIME_STATS && !APP_CYCLIC_EXECUTIVE)
+#define UI_DEADLINES    (APP_DEADLINE_MONITOR && !APP_CYCLIC_EXECUTIVE)
+
 
 /* === Private data type declarations ============================================================================== */
 
@@ -47,9 +93,21 @@ typedef enum {
     UI_MODE_SET_TIME_MIN,
     UI_MODE_SET_TIME_HOUR,
     UI_MODE_SET_ALARM_MIN,
-    UI_MODE_SET_ALARM_HOUR
+    UI_MODE_SET_ALARM_HOUR,
+    UI_MODE_DIAG
 } ui_mode_t;
 
+/* Tareas que siguen las estadisticas de ejecucion y el monitor de plazos, con los nombres con que las crea main.c */
+typedef enum {
+    APP_TASK_CLOCK = 0,
+    APP_TASK_BUTTONS,
+    APP_TASK_UI,
+    APP_TASK_IDLE,
+    APP_TASKS
+} app_task_t;
+
+static const char * const TASK_NAMES[APP_TASKS] = {"clk", "keys", "ui", "IDLE"};
+
 static board_t g_board;
 static screen_t g_screen;
 static clock_t g_clock;
@@ -57,53 +115,212 @@ static ui_mode_t g_mode = UI_MODE_NORMAL;
 static clock_time_t g_edit;
 static clock_time_t g_alarm_cfg;
 static bool g_blink_sec = false;
-static TimerHandle_t g_timeout;
+static uint32_t g_edit_timeout;
+static sleep_t g_sleep;
+static TaskHandle_t g_ui_task;
+static volatile bool g_asleep = false;
+/* Milisegundos desde el arranque, contados por JobClock en los dos modos de ejecucion */
+static volatile uint32_t g_now_ms;
+/* Estado de JobClock y JobButtons entre ejecuciones */
+static uint32_t g_clock_ms;
+static bool g_ringing;
+static uint32_t g_hold_set_time;
+static uint32_t g_hold_set_alarm;
+static uint32_t g_hold_diag;
+/* Estadisticas de ejecucion y pagina que muestra el modo de diagnostico */
+static diag_t g_diag;
+static TaskHandle_t g_task_handles[APP_TASKS];
+static uint8_t g_diag_page;
+static uint32_t g_diag_sample;
+/* Monitor de plazos de las tareas y aviso de plazo vencido, que muestra el punto del digito 2 hasta una tecla */
+static deadline_t g_deadline;
+static volatile bool g_deadline_missed;
+/* Ticks suprimidos por el kernel con todas las tareas bloqueadas */
+static volatile uint32_t g_idle_ticks;
+/* Estado con que se compuso el ultimo cuadro publicado fuera del modo de diagnostico */
+static uint32_t g_render_key = UI_RENDER_KEY_NONE;
+
+/* Brillo de la pantalla para cada hora del dia, atenuado durante la noche */
+static const uint8_t BRIGHTNESS_BY_HOUR[24] = {
+    2, 2, 2, 2, 2, 2, 4, 8, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 12, 8, 6, 4, 3,
+};
 
 /* === Public variable definitions ================================================================================= */
 
 /* === Public function definitions ================================================================================= */
 
-static void to_digits(const clock_time_t *t, uint8_t d[4]) {
-    uint8_t hh = (uint8_t)(t->time.hours[1] * 10u + t->time.hours[0]);
-    uint8_t mm = (uint8_t)(t->time.minutes[1] * 10u + t->time.minutes[0]);
-    d[0] = (uint8_t)((hh / 10u) % 10u);
-    d[1] = (uint8_t)(hh % 10u);
-    d[2] = (uint8_t)((mm / 10u) % 10u);
-    d[3] = (uint8_t)(mm % 10u);
+static void ui_start_timeout(void) {
+    g_edit_timeout = UI_EDIT_TIMEOUT_MS;
 }
 
-static void ui_start_timeout(void) {
-    xTimerStop(g_timeout, 0);
-    xTimerStart(g_timeout, 0);
+static void ui_wake(void) {
+    SleepActivity(g_sleep);
+    if (g_ui_task != NULL) {
+        xTaskNotifyGive(g_ui_task);
+    }
 }
 
-static void ui_timeout_cb(TimerHandle_t xTimer) {
-    (void)xTimer;
-    g_mode = UI_MODE_NORMAL;
+static void alarm_indicator_update(void) {
+    /* El indicador solo se toca en los cambios; el parpadeo lo reproduce la interrupcion de TIMER1. Se asigna el
+     * estado leido en lugar de invertirlo, asi si JobClock y JobButtons se intercalan los dos dejan el mismo */
+    bool ringing = ClockIsAlarmTriggered(g_clock);
+
+    if (ringing != g_ringing) {
+        g_ringing = ringing;
+        board_alarm_pattern(g_board, ringing ? &PATTERN_BLINK : NULL);
+        if (ringing) {
+            ui_wake();
+        }
+    }
+}
+
+static bool ui_awake(void) {
+    clock_time_t now;
+    uint16_t minute = SLEEP_MINUTE_UNKNOWN;
+
+    if (ClockGetTime(g_clock, &now)) {
+        minute = (uint16_t)((now.time.hours[1] * 10 + now.time.hours[0]) * 60 + now.time.minutes[1] * 10 +
+                            now.time.minutes[0]);
+    }
+    return g_mode != UI_MODE_NORMAL ||
+           SleepIsAwake(g_sleep, g_now_ms, minute,
+                        ClockIsAlarmTriggered(g_clock));
+}
+
+static uint32_t task_counter(void) {
+#if UI_KERNEL_STATS || UI_DEADLINES
+    return board_counter();
+#else
+    return 0;
+#endif
+}
+
+static uint32_t task_loop_start(app_task_t task) {
+    uint32_t now = task_counter();
+
+    DeadlineRelease(g_deadline, task, now);
+    return now;
+}
+
+static void task_loop_end(app_task_t task, uint32_t start) {
+    uint32_t now = task_counter();
+
+    DiagLoopTime(g_diag, task, now - start);
+    DeadlineComplete(g_deadline, task, now);
+}
+
+static void task_deadline_missed(uint8_t task, uint32_t lateness) {
+    (void)task;
+    (void)lateness;
+    g_deadline_missed = true;
+}
+
+static void watchdog_gate(void) {
+#if UI_DEADLINES && APP_WATCHDOG_MS
+    /* Un plazo vencido solo saltea una alimentacion; el reinicio llega si los plazos se siguen venciendo */
+    if (DeadlineAllMet(g_deadline, task_counter())) {
+        board_watchdog_feed();
+    }
+#endif
+}
+
+static void diag_sample(void) {
+#if UI_KERNEL_STATS
+    /* Una entrada de mas para que el kernel no rechace la consulta si se agrega una tarea */
+    TaskStatus_t status[APP_TASKS + 1];
+    uint32_t total;
+    UBaseType_t count = uxTaskGetSystemState(status, APP_TASKS + 1, &total);
+
+    g_task_handles[APP_TASK_IDLE] = xTaskGetIdleTaskHandle();
+    for (UBaseType_t index = 0; index < count; index++) {
+        for (uint8_t task = 0; task < APP_TASKS; task++) {
+            if (status[index].xHandle == g_task_handles[task]) {
+                DiagTaskSample(g_diag, task, status[index].ulRunTimeCounter, status[index].usStackHighWaterMark);
+            }
+        }
+    }
+#if STATIC_ALLOCATION
+    DiagSystemSample(g_diag, total, 0);
+#else
+    DiagSystemSample(g_diag, total, xPortGetMinimumEverFreeHeapSize());
+#endif
+#endif
+}
+
+/* Resume todo lo que define el cuadro de los modos normal y de configuracion: hora mostrada, modo, validez de la hora,
+ * brillo y puntos. El parpadeo lo reproduce la pantalla, asi que la fase no forma parte de la clave */
+static uint32_t ui_render_key(const clock_time_t * shown, bool valid_now, uint8_t brightness) {
+    return ((uint32_t)shown->time.hours[1] << 28) | ((uint32_t)shown->time.hours[0] << 24) |
+           ((uint32_t)shown->time.minutes[1] << 20) | ((uint32_t)shown->time.minutes[0] << 16) |
+           ((uint32_t)g_mode << 12) | ((uint32_t)brightness << 8) | ((uint32_t)valid_now << 4) |
+           ((uint32_t)g_blink_sec << 3) | ((uint32_t)ClockIsAlarmEnabled(g_clock) << 2) |
+           ((uint32_t)ClockIsAlarmTriggered(g_clock) << 1) | (uint32_t)g_deadline_missed;
+}
+
+static void ui_render_diag(void) {
+    char text[DIAG_PAGE_TEXT];
+
+    /* El texto de diagnostico reemplaza al cuadro de la hora, que hay que recomponer al volver */
+    g_render_key = UI_RENDER_KEY_NONE;
+
+    if (g_diag_sample > APP_UI_PERIOD_MS) {
+        g_diag_sample -= APP_UI_PERIOD_MS;
+    } else {
+        g_diag_sample = UI_DIAG_SAMPLE_MS;
+        diag_sample();
+    }
+
+    for (int i = 0; i < 4; i++) {
+        ScreenDisablePoint(g_screen, i);
+    }
+    DisplayFlashPoints(g_screen, 0, 3, 0);
+    DisplayFlashDigit(g_screen, 0, 3, 0);
+    DiagFormatPage(g_diag, g_diag_page, text);
+    ScreenWriteText(g_screen, text);
+    ScreenPublish(g_screen);
 }
 
 static void ui_render(void) {
-    uint8_t digits[4];
+    const clock_time_t *shown = &g_edit;
+    clock_time_t now;
     bool valid_now = true;
+    uint8_t brightness = 0;
+    uint32_t key;
 
-    if (g_mode == UI_MODE_SET_TIME_MIN || g_mode == UI_MODE_SET_TIME_HOUR ||
-        g_mode == UI_MODE_SET_ALARM_MIN || g_mode == UI_MODE_SET_ALARM_HOUR) {
-        to_digits(&g_edit, digits);
-    } else {
-        clock_time_t now;
+    if (g_mode == UI_MODE_DIAG) {
+        ui_render_diag();
+        return;
+    }
+
+    if (g_mode == UI_MODE_NORMAL) {
         valid_now = ClockGetTime(g_clock, &now);
-        to_digits(&now, digits);
+        shown = &now;
+        if (valid_now) {
+            brightness = BRIGHTNESS_BY_HOUR[now.time.hours[1] * 10 + now.time.hours[0]];
+        }
+    }
+
+    /* La hora cambia una vez por minuto y los puntos una vez por segundo: en el resto de las llamadas el cuadro
+     * publicado ya es el correcto y no se vuelve a componer ni a copiar */
+    key = ui_render_key(shown, valid_now, brightness);
+    if (key == g_render_key) {
+        return;
     }
+    g_render_key = key;
 
-    ScreenWriteBCD(g_screen, digits, 4);
+    if (brightness) {
+        ScreenSetBrightness(g_screen, brightness);
+    }
+    ScreenWriteTime(g_screen, shown->time.hours, shown->time.minutes);
 
     for (int i = 0; i < 4; i++) {
         ScreenDisablePoint(g_screen, i);
     }
 
     if (g_mode == UI_MODE_NORMAL && !valid_now) {
-        DisplayFlashDigit(g_screen, 0, 3, 20);
-        DisplayFlashPoints(g_screen, 0, 3, 20);
+        DisplayFlashPoints(g_screen, 0, 3, UI_FLASH_DIVISOR);
+    } else {
+        DisplayFlashPoints(g_screen, 0, 3, 0);
     }
 
     if (g_mode == UI_MODE_NORMAL) {
@@ -116,11 +333,18 @@ static void ui_render(void) {
     if (ClockIsAlarmTriggered(g_clock)) {
         ScreenEnablePoint(g_screen, 3);
     }
+    if (g_deadline_missed) {
+        ScreenEnablePoint(g_screen, 2);
+    }
 
     if (g_mode == UI_MODE_SET_TIME_MIN || g_mode == UI_MODE_SET_ALARM_MIN) {
-        DisplayFlashDigit(g_screen, 2, 3, 20);
+        DisplayFlashDigit(g_screen, 2, 3, UI_FLASH_DIVISOR);
     } else if (g_mode == UI_MODE_SET_TIME_HOUR || g_mode == UI_MODE_SET_ALARM_HOUR) {
-        DisplayFlashDigit(g_screen, 0, 1, 20);
+        DisplayFlashDigit(g_screen, 0, 1, UI_FLASH_DIVISOR);
+    } else if (!valid_now) {
+        DisplayFlashDigit(g_screen, 0, 3, UI_FLASH_DIVISOR);
+    } else {
+        DisplayFlashDigit(g_screen, 0, 3, 0);
     }
 
     if (g_mode == UI_MODE_SET_ALARM_MIN || g_mode == UI_MODE_SET_ALARM_HOUR) {
@@ -128,140 +352,304 @@ static void ui_render(void) {
             ScreenEnablePoint(g_screen, i);
         }
     }
+
+    ScreenPublish(g_screen);
 }
 
 board_t AppInit(void) {
     g_board = board_create();
+    configASSERT(g_board != NULL);
     g_screen = g_board->screen;
     g_clock = ClockCreate(1000, 5);
     memset(&g_edit, 0, sizeof(g_edit));
     memset(&g_alarm_cfg, 0, sizeof(g_alarm_cfg));
-    g_timeout = xTimerCreate("inact", pdMS_TO_TICKS(30000), pdFALSE, NULL, ui_timeout_cb);
+    g_sleep = SleepCreate(UI_SLEEP_TIMEOUT_MIN * 60000UL, UI_NIGHT_FROM, UI_NIGHT_TO);
+    configASSERT(g_sleep != NULL);
+    g_diag = DiagCreate(TASK_NAMES, APP_TASKS);
+    configASSERT(g_diag != NULL);
+#if UI_DEADLINES
+    g_deadline = DeadlineCreate(task_deadline_missed);
+    configASSERT(g_deadline != NULL);
+    board_counter_start();
+#endif
+#if PROBE_ENABLED
+    ProbeCounterStart();
+#endif
     return g_board;
 }
 
-void TaskClock(void *param) {
-    (void)param;
-    uint32_t ms = 0;
-    for (;;) {
-        ClockNewTick(g_clock);
-        vTaskDelay(pdMS_TO_TICKS(1));
-        ms++;
-        if (ms >= 1000) {
-            ms = 0;
+void AppAddIdleTicks(uint32_t ticks) {
+    g_idle_ticks += ticks;
+}
+
+uint32_t AppGetIdleTicks(void) {
+    return g_idle_ticks;
+}
+
+void JobClock(void) {
+    (void)JobClockAdvance(APP_CLOCK_PERIOD_MS);
+}
+
+uint32_t JobClockAdvance(uint32_t elapsed_ms) {
+    /* El reloj cuenta 1000 ticks por segundo, uno por milisegundo */
+    ClockAdvance(g_clock, elapsed_ms);
+    g_now_ms += elapsed_ms;
+    g_clock_ms += elapsed_ms;
+    if (g_clock_ms >= 1000) {
+        if ((g_clock_ms / 1000) % 2 != 0) {
             g_blink_sec = !g_blink_sec;
         }
-        if (ClockIsAlarmTriggered(g_clock)) {
-            AlarmLedOn(g_board->alarm_led);
-        } else {
-            AlarmLedOff(g_board->alarm_led);
-        }
+        g_clock_ms %= 1000;
     }
+    alarm_indicator_update();
+    /* g_clock_ms sigue en fase con los ticks del reloj, asi el reloj solo dispara la alarma en este limite; las
+     * teclas que la apagan o la posponen actualizan el indicador desde JobButtons */
+    return 1000 - g_clock_ms;
 }
 
-void TaskButtons(void *param) {
-    (void)param;
-    uint32_t f1 = 0, f2 = 0;
-    for (;;) {
-        if (DigitalInputGetIsActive(g_board->set_time)) {
-            f1 += 20;
-            if (f1 >= 3000 && g_mode == UI_MODE_NORMAL) {
-                ClockGetTime(g_clock, &g_edit);
-                g_mode = UI_MODE_SET_TIME_MIN;
-                ui_start_timeout();
-            }
-        } else {
-            f1 = 0;
+void JobButtons(void) {
+    if (g_edit_timeout > APP_BUTTONS_PERIOD_MS) {
+        g_edit_timeout -= APP_BUTTONS_PERIOD_MS;
+    } else if (g_edit_timeout != 0) {
+        g_edit_timeout = 0;
+        g_mode = UI_MODE_NORMAL;
+    }
+
+    bool set_time = DigitalInputGetIsActive(g_board->set_time);
+    bool set_alarm = DigitalInputGetIsActive(g_board->set_alarm);
+    bool increment = DigitalWasActive(g_board->increment);
+    bool decrement = DigitalWasActive(g_board->decrement);
+    bool accept = DigitalWasActive(g_board->accept);
+    bool cancel = DigitalWasActive(g_board->cancel);
+
+    if (set_time || set_alarm || increment || decrement || accept || cancel) {
+        ui_wake();
+        /* La tecla que enciende la pantalla no se interpreta, porque el usuario no veia que estaba tocando */
+        if (g_asleep) {
+            return;
         }
+        g_deadline_missed = false;
+    }
 
-        if (DigitalInputGetIsActive(g_board->set_alarm)) {
-            f2 += 20;
-            if (f2 >= 3000 && g_mode == UI_MODE_NORMAL) {
-                ClockGetAlarm(g_clock, &g_edit);
-                g_mode = UI_MODE_SET_ALARM_MIN;
-                ui_start_timeout();
-            }
-        } else {
-            f2 = 0;
+    /* Las dos teclas de configuracion sostenidas juntas abren el modo de diagnostico en lugar de la configuracion */
+    if (set_time && set_alarm) {
+        g_hold_diag += APP_BUTTONS_PERIOD_MS;
+        if (g_hold_diag >= UI_HOLD_MS && g_mode == UI_MODE_NORMAL) {
+            g_mode = UI_MODE_DIAG;
+            g_diag_page = 0;
+            g_diag_sample = 0;
+            ui_start_timeout();
         }
+        set_time = false;
+        set_alarm = false;
+    } else {
+        g_hold_diag = 0;
+    }
 
-        if (DigitalWasActive(g_board->increment)) {
-            if (g_mode == UI_MODE_SET_TIME_MIN || g_mode == UI_MODE_SET_ALARM_MIN) {
-                int min = g_edit.time.minutes[0] + g_edit.time.minutes[1] * 10;
-                min = (min + 1) % 60;
-                g_edit.time.minutes[0] = (uint8_t)(min % 10);
-                g_edit.time.minutes[1] = (uint8_t)(min / 10);
-                ui_start_timeout();
-            } else if (g_mode == UI_MODE_SET_TIME_HOUR || g_mode == UI_MODE_SET_ALARM_HOUR) {
-                int hour = g_edit.time.hours[0] + g_edit.time.hours[1] * 10;
-                hour = (hour + 1) % 24;
-                g_edit.time.hours[0] = (uint8_t)(hour % 10);
-                g_edit.time.hours[1] = (uint8_t)(hour / 10);
-                ui_start_timeout();
-            }
+    if (set_time) {
+        g_hold_set_time += APP_BUTTONS_PERIOD_MS;
+        if (g_hold_set_time >= UI_HOLD_MS && g_mode == UI_MODE_NORMAL) {
+            ClockGetTime(g_clock, &g_edit);
+            g_mode = UI_MODE_SET_TIME_MIN;
+            ui_start_timeout();
         }
+    } else {
+        g_hold_set_time = 0;
+    }
 
-        if (DigitalWasActive(g_board->decrement)) {
-            if (g_mode == UI_MODE_SET_TIME_MIN || g_mode == UI_MODE_SET_ALARM_MIN) {
-                int min = g_edit.time.minutes[0] + g_edit.time.minutes[1] * 10;
-                min = (min + 59) % 60;
-                g_edit.time.minutes[0] = (uint8_t)(min % 10);
-                g_edit.time.minutes[1] = (uint8_t)(min / 10);
-                ui_start_timeout();
-            } else if (g_mode == UI_MODE_SET_TIME_HOUR || g_mode == UI_MODE_SET_ALARM_HOUR) {
-                int hour = g_edit.time.hours[0] + g_edit.time.hours[1] * 10;
-                hour = (hour + 23) % 24;
-                g_edit.time.hours[0] = (uint8_t)(hour % 10);
-                g_edit.time.hours[1] = (uint8_t)(hour / 10);
-                ui_start_timeout();
-            }
+    if (set_alarm) {
+        g_hold_set_alarm += APP_BUTTONS_PERIOD_MS;
+        if (g_hold_set_alarm >= UI_HOLD_MS && g_mode == UI_MODE_NORMAL) {
+            ClockGetAlarm(g_clock, &g_edit);
+            g_mode = UI_MODE_SET_ALARM_MIN;
+            ui_start_timeout();
+        }
+    } else {
+        g_hold_set_alarm = 0;
+    }
+
+    if (increment) {
+        if (g_mode == UI_MODE_SET_TIME_MIN || g_mode == UI_MODE_SET_ALARM_MIN) {
+            int min = g_edit.time.minutes[0] + g_edit.time.minutes[1] * 10;
+            min = (min + 1) % 60;
+            g_edit.time.minutes[0] = (uint8_t)(min % 10);
+            g_edit.time.minutes[1] = (uint8_t)(min / 10);
+            ui_start_timeout();
+        } else if (g_mode == UI_MODE_SET_TIME_HOUR || g_mode == UI_MODE_SET_ALARM_HOUR) {
+            int hour = g_edit.time.hours[0] + g_edit.time.hours[1] * 10;
+            hour = (hour + 1) % 24;
+            g_edit.time.hours[0] = (uint8_t)(hour % 10);
+            g_edit.time.hours[1] = (uint8_t)(hour / 10);
+            ui_start_timeout();
+        } else if (g_mode == UI_MODE_DIAG) {
+            g_diag_page = (uint8_t)((g_diag_page + 1) % DiagGetPages(g_diag));
+            ui_start_timeout();
         }
+    }
+
+    if (decrement) {
+        if (g_mode == UI_MODE_SET_TIME_MIN || g_mode == UI_MODE_SET_ALARM_MIN) {
+            int min = g_edit.time.minutes[0] + g_edit.time.minutes[1] * 10;
+            min = (min + 59) % 60;
+            g_edit.time.minutes[0] = (uint8_t)(min % 10);
+            g_edit.time.minutes[1] = (uint8_t)(min / 10);
+            ui_start_timeout();
+        } else if (g_mode == UI_MODE_SET_TIME_HOUR || g_mode == UI_MODE_SET_ALARM_HOUR) {
+            int hour = g_edit.time.hours[0] + g_edit.time.hours[1] * 10;
+            hour = (hour + 23) % 24;
+            g_edit.time.hours[0] = (uint8_t)(hour % 10);
+            g_edit.time.hours[1] = (uint8_t)(hour / 10);
+            ui_start_timeout();
+        } else if (g_mode == UI_MODE_DIAG) {
+            g_diag_page = (uint8_t)((g_diag_page + DiagGetPages(g_diag) - 1) % DiagGetPages(g_diag));
+            ui_start_timeout();
+        }
+    }
 
-        if (DigitalWasActive(g_board->accept)) {
-            if (g_mode == UI_MODE_SET_TIME_MIN) {
-                g_mode = UI_MODE_SET_TIME_HOUR;
-                ui_start_timeout();
-            } else if (g_mode == UI_MODE_SET_TIME_HOUR) {
-                ClockSetTime(g_clock, &g_edit);
-                g_mode = UI_MODE_NORMAL;
-            } else if (g_mode == UI_MODE_SET_ALARM_MIN) {
-                g_mode = UI_MODE_SET_ALARM_HOUR;
-                ui_start_timeout();
-            } else if (g_mode == UI_MODE_SET_ALARM_HOUR) {
-                g_alarm_cfg = g_edit;
-                g_mode = UI_MODE_NORMAL;
+    if (accept) {
+        if (g_mode == UI_MODE_SET_TIME_MIN) {
+            g_mode = UI_MODE_SET_TIME_HOUR;
+            ui_start_timeout();
+        } else if (g_mode == UI_MODE_SET_TIME_HOUR) {
+            ClockSetTime(g_clock, &g_edit);
+            g_mode = UI_MODE_NORMAL;
+        } else if (g_mode == UI_MODE_SET_ALARM_MIN) {
+            g_mode = UI_MODE_SET_ALARM_HOUR;
+            ui_start_timeout();
+        } else if (g_mode == UI_MODE_SET_ALARM_HOUR) {
+            g_alarm_cfg = g_edit;
+            g_mode = UI_MODE_NORMAL;
+        } else if (g_mode == UI_MODE_DIAG) {
+            g_mode = UI_MODE_NORMAL;
+        } else {
+            if (ClockIsAlarmTriggered(g_clock)) {
+                ClockSnooze(g_clock);
+                alarm_indicator_update();
             } else {
-                if (ClockIsAlarmTriggered(g_clock)) {
-                    ClockSnooze(g_clock);
-                } else {
-                    ClockSetAlarm(g_clock, &g_alarm_cfg);
-                }
+                ClockSetAlarm(g_clock, &g_alarm_cfg);
             }
         }
+    }
 
-        if (DigitalWasActive(g_board->cancel)) {
-            if (g_mode == UI_MODE_SET_TIME_MIN || g_mode == UI_MODE_SET_TIME_HOUR ||
-                g_mode == UI_MODE_SET_ALARM_MIN || g_mode == UI_MODE_SET_ALARM_HOUR) {
-                g_mode = UI_MODE_NORMAL;
+    if (cancel) {
+        if (g_mode == UI_MODE_SET_TIME_MIN || g_mode == UI_MODE_SET_TIME_HOUR || g_mode == UI_MODE_SET_ALARM_MIN ||
+            g_mode == UI_MODE_SET_ALARM_HOUR || g_mode == UI_MODE_DIAG) {
+            g_mode = UI_MODE_NORMAL;
+        } else {
+            if (ClockIsAlarmTriggered(g_clock)) {
+                ClockCancelAlarm(g_clock);
+                alarm_indicator_update();
             } else {
-                if (ClockIsAlarmTriggered(g_clock)) {
-                    ClockCancelAlarm(g_clock);
-                } else {
-                    ClockDisableAlarm(g_clock);
-                }
+                ClockDisableAlarm(g_clock);
             }
         }
+    }
+}
+
+bool JobUI(void) {
+    if (!ui_awake()) {
+        /* Sin render ni refresco hasta una tecla o la alarma */
+        if (!g_asleep) {
+            g_asleep = true;
+            board_screen_sleep(g_board);
+        }
+        return false;
+    }
+    if (g_asleep) {
+        /* Al despertar se recompone el cuadro aunque la clave no cambie */
+        g_render_key = UI_RENDER_KEY_NONE;
+    }
+    PROBE_BEGIN(PROBE_UI_RENDER);
+    ui_render();
+    PROBE_END(PROBE_UI_RENDER);
+    if (g_asleep) {
+        /* El multiplexado vuelve despues de publicar, asi los primeros barridos ya muestran el cuadro actual aunque
+         * otra tarea desaloje a esta entre las dos llamadas */
+        board_screen_wake(g_board);
+        g_asleep = false;
+    }
+#if !BSP_SCREEN_REFRESH_ISR
+    ScreenRefresh(g_screen);
+#endif
+    return true;
+}
+
+void TaskClock(void * param) {
+    (void)param;
+    g_task_handles[APP_TASK_CLOCK] = xTaskGetCurrentTaskHandle();
+#if APP_TICKLESS_IDLE
+    /* El reloj avanza lo que marca la cuenta de ticks del kernel, que vTaskStepTick mantiene al dia aunque el tick
+     * se suprima, y la tarea solo despierta en cada cambio de segundo */
+    TickType_t last = xTaskGetTickCount();
+    DeadlineDeclare(g_deadline, APP_TASK_CLOCK, 1000000, APP_CLOCK_PERIOD_MS * 1000);
+    for (;;) {
+        uint32_t start = task_loop_start(APP_TASK_CLOCK);
+        TickType_t now = xTaskGetTickCount();
+        uint32_t next = JobClockAdvance((uint32_t)(now - last) * portTICK_PERIOD_MS);
+        last = now;
+        task_loop_end(APP_TASK_CLOCK, start);
+        /* La espera no es de un periodo fijo, asi que el plazo de la vuelta siguiente se mide desde el despertar
+         * pedido y no desde la liberacion anterior mas el periodo declarado */
+        DeadlineSchedule(g_deadline, APP_TASK_CLOCK, task_counter() + next * 1000);
+        vTaskDelay(pdMS_TO_TICKS(next));
+    }
+#else
+    TickType_t wake = xTaskGetTickCount();
+    DeadlineDeclare(g_deadline, APP_TASK_CLOCK, APP_CLOCK_PERIOD_MS * 1000, APP_CLOCK_PERIOD_MS * 1000);
+    for (;;) {
+        uint32_t start = task_loop_start(APP_TASK_CLOCK);
+        JobClock();
+        task_loop_end(APP_TASK_CLOCK, start);
+        vTaskDelayUntil(&wake, pdMS_TO_TICKS(APP_CLOCK_PERIOD_MS));
+    }
+#endif
+}
 
-        vTaskDelay(pdMS_TO_TICKS(20));
+void TaskButtons(void * param) {
+    (void)param;
+    TickType_t wake = xTaskGetTickCount();
+    uint32_t period = APP_BUTTONS_PERIOD_MS;
+
+    g_task_handles[APP_TASK_BUTTONS] = xTaskGetCurrentTaskHandle();
+    DeadlineDeclare(g_deadline, APP_TASK_BUTTONS, period * 1000, period * 1000);
+#if UI_DEADLINES && APP_WATCHDOG_MS
+    board_watchdog_start(APP_WATCHDOG_MS);
+#endif
+    for (;;) {
+        uint32_t start = task_loop_start(APP_TASK_BUTTONS);
+        JobButtons();
+        task_loop_end(APP_TASK_BUTTONS, start);
+        watchdog_gate();
+#if APP_TICKLESS_IDLE
+        uint32_t next = g_asleep ? APP_BUTTONS_SLEEP_PERIOD_MS : APP_BUTTONS_PERIOD_MS;
+        if (next != period) {
+            period = next;
+            DeadlineDeclare(g_deadline, APP_TASK_BUTTONS, period * 1000, period * 1000);
+        }
+#endif
+        vTaskDelayUntil(&wake, pdMS_TO_TICKS(period));
     }
 }
 
-void TaskUI(void *param) {
+void TaskUI(void * param) {
     (void)param;
+    TickType_t wake = xTaskGetTickCount();
+
+    g_ui_task = xTaskGetCurrentTaskHandle();
+    g_task_handles[APP_TASK_UI] = g_ui_task;
+    DeadlineDeclare(g_deadline, APP_TASK_UI, APP_UI_PERIOD_MS * 1000, APP_UI_PERIOD_MS * 1000);
     for (;;) {
-        ui_render();
-        ScreenRefresh(g_screen);
-        vTaskDelay(pdMS_TO_TICKS(5));
+        uint32_t start = task_loop_start(APP_TASK_UI);
+        bool awake = JobUI();
+        task_loop_end(APP_TASK_UI, start);
+        if (awake) {
+            vTaskDelayUntil(&wake, pdMS_TO_TICKS(APP_UI_PERIOD_MS));
+        } else {
+            /* Con la pantalla apagada la tarea queda bloqueada hasta una tecla o la alarma, sin plazos */
+            DeadlinePause(g_deadline, APP_TASK_UI);
+            ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(UI_SLEEP_RECHECK_MS));
+            wake = xTaskGetTickCount();
+        }
     }
 }
 
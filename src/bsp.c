@@ -24,29 +24,95 @@ SPDX-License-Identifier: MIT
 /* === Headers files inclusions ==================================================================================== */
 
 #include "bsp.h"
+#include "hd44780.h"
+#include "max7219.h"
+#include "digital_pin.h"
+#include "pool.h"
 #include <stdlib.h>
 #include <stddef.h>
+#include <string.h>
 
 /* === Macros definitions ========================================================================================== */
 
-/* === Private data type declarations ============================================================================== */
+//! Cantidad de puertos GPIO del LPC43xx
+#define BSP_GPIO_PORTS 8
 
-/* === Private function declarations =============================================================================== */
+//! Entrada de la tabla constante de pines
+#define BSP_PIN_ENTRY(name, port, pin, func, gpio, bit, class)                                                        \
+    {(port), (pin), (uint16_t)(((class) == BSP_PIN_KEY ? (SCU_MODE_INBUFF_EN | SCU_MODE_PULLUP)                      \
+                                                      : (SCU_MODE_INBUFF_EN | SCU_MODE_INACT)) |                      \
+                               (func)),                                                                               \
+     (gpio), (bit), (class)},
 
-/**
- * @brief Configura los pines SCU y GPIO de los dígitos
- */
-void DigitsInit(void);
+//! Entrada de la tabla de pines del conector LCD, todos salidas
+#define HD44780_PIN_ENTRY(name, port, pin, func, gpio, bit)                                                           \
+    {(port), (pin), (uint16_t)(SCU_MODE_INACT | (func)), (gpio), (bit), BSP_PIN_SEGMENT},
 
-/**
- * @brief Configura los pines SCU y GPIO de los segmentos
- */
-void SegmentsInit(void);
+//! Posicion de RS y de EN en la tabla de pines del LCD, despues de D4 a D7
+#define HD44780_PIN_RS 4
+#define HD44780_PIN_EN 5
+
+//! Puerto y bit GPIO de cada pin por su nombre, como BSP_GPIO_KEY_F1 y BSP_BIT_KEY_F1
+#define BSP_PIN_NAMES(name, port, pin, func, gpio, bit, class) BSP_GPIO_##name = (gpio), BSP_BIT_##name = (bit),
+
+//! Un enumerador por bit GPIO y otro por pin SCU: un pin repetido en la tabla redeclara el enumerador y no compila
+#define BSP_PIN_GPIO_USED(name, port, pin, func, gpio, bit, class) BSP_PIN_USED_GPIO##gpio##_##bit,
+#define BSP_PIN_SCU_USED(name, port, pin, func, gpio, bit, class)  BSP_PIN_USED_P##port##_##pin,
+
+//! Cantidad de pines de una clase que no estan en el puerto GPIO de la clase
+#define BSP_DIGITS_OFF_PORT(name, port, pin, func, gpio, bit, class)                                                  \
+    +(((class) == BSP_PIN_DIGIT) && ((gpio) != DIGITS_GPIO))
+#define BSP_SEGMENTS_OFF_PORT(name, port, pin, func, gpio, bit, class)                                                \
+    +(((class) == BSP_PIN_SEGMENT) && ((gpio) != SEGMENTS_GPIO))
+
+//! Cantidad de pines de una clase en la tabla
+#define BSP_DIGITS_COUNT(name, port, pin, func, gpio, bit, class) +((class) == BSP_PIN_DIGIT)
+
+/* === Private data type declarations ============================================================================== */
+
+//! Configuracion de un pin de la placa
+typedef struct bsp_pin_s {
+    uint8_t port;  //!< Puerto SCU
+    uint8_t pin;   //!< Pin SCU
+    uint16_t mode; //!< Modo y funcion SCU
+    uint8_t gpio;  //!< Puerto GPIO
+    uint8_t bit;   //!< Bit GPIO
+    uint8_t class; //!< Clase del pin, BSP_PIN_x
+} bsp_pin_t;
+
+//! Nombres de los pines de la tabla
+enum bsp_pin_names_e { BSP_BOARD_PINS(BSP_PIN_NAMES) };
+
+//! Punto decimal, escrito desde la interrupcion del refresco con un solo acceso al registro del pin
+DIGITAL_PIN_OUTPUT(SegmentPoint, BSP_GPIO_SEGMENT_P, BSP_BIT_SEGMENT_P, false)
+
+//! Pines GPIO usados por la tabla, solo para detectar repetidos
+enum bsp_pin_gpio_used_e { BSP_BOARD_PINS(BSP_PIN_GPIO_USED) };
+
+//! Pines SCU usados por la tabla, solo para detectar repetidos
+enum bsp_pin_scu_used_e { BSP_BOARD_PINS(BSP_PIN_SCU_USED) };
+
+/* Los drivers de la pantalla escriben puertos completos, por lo que cada clase debe compartir un puerto y los
+ * segmentos deben ocupar los mismos bits que las macros SEGMENT_x de screen.h */
+BSP_STATIC_ASSERT((0 BSP_BOARD_PINS(BSP_DIGITS_OFF_PORT)) == 0, digits_share_port);
+BSP_STATIC_ASSERT((0 BSP_BOARD_PINS(BSP_SEGMENTS_OFF_PORT)) == 0, segments_share_port);
+BSP_STATIC_ASSERT((0 BSP_BOARD_PINS(BSP_DIGITS_COUNT)) == 4, four_digits);
+BSP_STATIC_ASSERT(SEGMENTS_MASK == (SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G),
+                  segments_mask);
+BSP_STATIC_ASSERT((1u << BSP_BIT_SEGMENT_A) == SEGMENT_A && (1u << BSP_BIT_SEGMENT_B) == SEGMENT_B &&
+                      (1u << BSP_BIT_SEGMENT_C) == SEGMENT_C && (1u << BSP_BIT_SEGMENT_D) == SEGMENT_D &&
+                      (1u << BSP_BIT_SEGMENT_E) == SEGMENT_E && (1u << BSP_BIT_SEGMENT_F) == SEGMENT_F &&
+                      (1u << BSP_BIT_SEGMENT_G) == SEGMENT_G,
+                  segments_order);
+
+/* === Private function declarations =============================================================================== */
 
 /**
- * @brief Configura las teclas
+ * @brief Configura los pines de la tabla de la placa, con una escritura de nivel y una de direccion por puerto GPIO
+ *
+ * @param display Indica si se configuran tambien los pines de la pantalla multiplexada
  */
-void KeysInit(void);
+static void PinsInit(bool display);
 
 /**
  * @brief Apaga todos los dígitos y limpia los segmentos
@@ -65,112 +131,482 @@ void SegmentsUpdate(uint8_t value);
  */
 void DigitTurnOn(uint8_t digit);
 
+/**
+ * @brief Apaga los dígitos durante un subcuadro oscuro de la modulación de brillo
+ */
+void DigitsBlank(void);
+
+/**
+ * @brief Muestra un dígito completo escribiendo directamente los registros SET y CLR de cada puerto
+ * @param digit Índice del dígito a encender (0-3)
+ * @param segments Máscara con los segmentos a encender, incluyendo el punto
+ */
+void DigitCommit(uint8_t digit, uint8_t segments);
+
+/**
+ * @brief Configura el temporizador que barre la pantalla a frecuencia fija
+ * @param screen Pantalla a refrescar desde la interrupcion
+ * @param frequency Cantidad de digitos a refrescar por segundo
+ */
+static void ScreenTimerInit(screen_t screen, uint32_t frequency);
+
+/**
+ * @brief Configura TIMER1 como contador libre en milisegundos para reproducir secuencias desde su interrupcion
+ *
+ * @param player Reproductor atendido desde la interrupcion
+ */
+static void PatternTimerInit(pattern_player_t player);
+
+#if BSP_DISPLAY_MAX7219
+/**
+ * @brief Configura SSP1 con tramas de 16 bits, que pulsan la señal de carga del MAX7219 entre palabras, y su DMA
+ */
+static void DisplayBusInit(void);
+
+/**
+ * @brief Envia palabras al MAX7219 por DMA, esperando antes que termine la transferencia anterior
+ * @param words Palabras a enviar
+ * @param count Cantidad de palabras
+ */
+static void DisplayBusWrite(const uint16_t words[], uint8_t count);
+
+/**
+ * @brief Envia un cuadro de la pantalla al MAX7219
+ * @param segments Segmentos de cada dígito
+ * @param digits Cantidad de dígitos
+ * @param brightness Nivel de brillo
+ */
+static void DisplayFrameTransfer(const uint8_t segments[], uint8_t digits, uint8_t brightness);
+#elif BSP_DISPLAY_HD44780
+/**
+ * @brief Configura los pines del conector LCD y pasa el controlador a bus de 4 bits
+ */
+static void DisplayBusInit(void);
+
+/**
+ * @brief Espera un tiempo con el contador libre de TIMER3
+ * @param us Microsegundos a esperar
+ */
+static void DisplayWait(uint32_t us);
+
+/**
+ * @brief Escribe los 4 bits bajos de un valor en D4 a D7 y pulsa EN
+ * @param nibble Valor a escribir
+ */
+static void DisplayBusNibble(uint8_t nibble);
+
+/**
+ * @brief Realiza una transaccion de un byte con el LCD, en dos mitades, y espera que la ejecute
+ * @param data true para un dato, false para una instruccion
+ * @param value Byte a escribir
+ */
+static void DisplayBusWrite(bool data, uint8_t value);
+
+/**
+ * @brief Envia un cuadro de la pantalla al LCD
+ * @param segments Segmentos de cada dígito
+ * @param digits Cantidad de dígitos
+ * @param brightness Nivel de brillo
+ */
+static void DisplayFrameTransfer(const uint8_t segments[], uint8_t digits, uint8_t brightness);
+#endif
+
 /* === Private variable definitions ================================================================================ */
 static const struct screen_driver_s screen_driver = {
     .DigitsTurnOff = DigitsTurnOff,
     .SegmentsUpdate = SegmentsUpdate,
     .DigitTurnOn = DigitTurnOn,
+    .BlankingInterval = DigitsBlank,
+    .DigitCommit = DigitCommit,
+};
+
+//! Máscara del puerto de dígitos que enciende cada dígito, precalculada para no desplazar en el barrido
+static const uint32_t DIGIT_ON_MASK[4] = {
+    1u << BSP_BIT_DIGIT_4,
+    1u << BSP_BIT_DIGIT_3,
+    1u << BSP_BIT_DIGIT_2,
+    1u << BSP_BIT_DIGIT_1,
+};
+
+//! Tabla de pines de la placa elegida con BSP_BOARD
+static const bsp_pin_t BOARD_PINS[] = {BSP_BOARD_PINS(BSP_PIN_ENTRY)};
+
+#if BSP_DISPLAY_MAX7219
+static const struct screen_driver_s frame_driver = {
+    .FrameTransfer = DisplayFrameTransfer,
+};
+
+//! Codificador del MAX7219 que recibe los cuadros de la pantalla
+static max7219_t display_chip;
+
+//! Canal de DMA asignado a la transmision de SSP1
+static uint8_t display_dma_channel;
+
+//! Copia de las palabras en transmision, para que el codificador pueda reusar su buffer
+static uint16_t display_words[MAX7219_MAX_WORDS];
+#elif BSP_DISPLAY_HD44780
+static const struct screen_driver_s frame_driver = {
+    .FrameTransfer = DisplayFrameTransfer,
 };
+
+//! Pines D4 a D7, RS y EN del conector LCD, en ese orden
+static const bsp_pin_t DISPLAY_PINS[] = {HD44780_PINS(HD44780_PIN_ENTRY)};
+
+//! Adaptador del LCD que recibe los cuadros de la pantalla
+static hd44780_t display_chip;
+#endif
+
+//! Objeto de la placa
+POOL_DECLARE(struct board_s, board_pool, 1)
+
+//! Pantalla refrescada desde la interrupcion del temporizador
+static screen_t refresh_screen;
+
+//! Periodo del barrido en cuentas del temporizador
+static uint32_t refresh_period;
+
+//! Reproductor de secuencias atendido desde la interrupcion de TIMER1
+static pattern_player_t pattern_player;
+
+//! Funcion llamada en cada marco desde la interrupcion de TIMER2
+static void (*frame_handler)(void);
+
+//! Periodo de los marcos en cuentas del temporizador
+static uint32_t frame_period;
+
 /* === Public variable definitions ================================================================================= */
 
 /* === Public function definitions ================================================================================= */
 
 board_t board_create(void) {
-    struct board_s * board = malloc(sizeof(struct board_s));
+    struct board_s * board = POOL_ALLOC(struct board_s, board_pool);
     if (board != NULL) {
-        DigitsInit();
-        SegmentsInit();
-        KeysInit();
-
+#if BSP_DISPLAY_MAX7219
+        PinsInit(false);
+        DisplayBusInit();
+        display_chip = Max7219Create(4, DisplayBusWrite);
+        board->screen = ScreenCreate(4, &frame_driver);
+#elif BSP_DISPLAY_HD44780
+        PinsInit(false);
+        DisplayBusInit();
+        display_chip = Hd44780Create(4, DisplayBusWrite);
+        board->screen = ScreenCreate(4, &frame_driver);
+#else
+        PinsInit(true);
         board->screen = ScreenCreate(4, &screen_driver);
-
-        board->set_time = DigitalInputCreate(KEY_F1_GPIO, KEY_F1_BIT, false);
-        board->set_alarm = DigitalInputCreate(KEY_F2_GPIO, KEY_F2_BIT, false);
-        board->decrement = DigitalInputCreate(KEY_F3_GPIO, KEY_F3_BIT, false);
-        board->increment = DigitalInputCreate(KEY_F4_GPIO, KEY_F4_BIT, false);
-        board->accept = DigitalInputCreate(KEY_ACCEPT_GPIO, KEY_ACCEPT_BIT, false);
-        board->cancel = DigitalInputCreate(KEY_CANCEL_GPIO, KEY_CANCEL_BIT, false);
-
-        board->alarm_led = DigitalOutputCreate(PONCHO_RGB_RED_GPIO, PONCHO_RGB_RED_BIT);
+#endif
+
+        board->set_time = DigitalInputCreate(BSP_GPIO_KEY_F1, BSP_BIT_KEY_F1, false);
+        board->set_alarm = DigitalInputCreate(BSP_GPIO_KEY_F2, BSP_BIT_KEY_F2, false);
+        board->decrement = DigitalInputCreate(BSP_GPIO_KEY_F3, BSP_BIT_KEY_F3, false);
+        board->increment = DigitalInputCreate(BSP_GPIO_KEY_F4, BSP_BIT_KEY_F4, false);
+        board->accept = DigitalInputCreate(BSP_GPIO_KEY_ACCEPT, BSP_BIT_KEY_ACCEPT, false);
+        board->cancel = DigitalInputCreate(BSP_GPIO_KEY_CANCEL, BSP_BIT_KEY_CANCEL, false);
+
+        /* El LED rojo del poncho se enciende con nivel bajo */
+        board->alarm_led = DigitalOutputCreate(PONCHO_RGB_RED_GPIO, PONCHO_RGB_RED_BIT, true);
+        board->alarm_pattern = PatternPlayerCreate(board->alarm_led);
+
+        /* Sin alguno de los objetos la placa no sirve; con STATIC_ALLOCATION indica un arreglo mal dimensionado */
+        if (board->screen == NULL || board->set_time == NULL || board->set_alarm == NULL ||
+            board->decrement == NULL || board->increment == NULL || board->accept == NULL || board->cancel == NULL ||
+            board->alarm_pattern == NULL) {
+            return NULL;
+        }
+#if BSP_DISPLAY_MAX7219 || BSP_DISPLAY_HD44780
+        if (display_chip == NULL) {
+            return NULL;
+        }
+#endif
+        PatternTimerInit(board->alarm_pattern);
+#if BSP_SCREEN_REFRESH_ISR
+        ScreenTimerInit(board->screen, BSP_SCREEN_REFRESH_HZ);
+#endif
     }
     return board;
 }
 
-/* === Private function definitions ================================================================================ */
-
-void DigitsInit(void) {
-    Chip_SCU_PinMuxSet(DIGIT_1_PORT, DIGIT_1_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | DIGIT_1_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, DIGIT_1_GPIO, DIGIT_1_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, DIGIT_1_GPIO, DIGIT_1_BIT, true);
+void board_screen_sleep(board_t board) {
+#if BSP_SCREEN_REFRESH_ISR
+    NVIC_DisableIRQ(TIMER0_IRQn);
+    Chip_TIMER_Disable(LPC_TIMER0);
+#endif
+    ScreenSleep(board->screen);
+}
 
-    Chip_SCU_PinMuxSet(DIGIT_2_PORT, DIGIT_2_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | DIGIT_2_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, DIGIT_2_GPIO, DIGIT_2_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, DIGIT_2_GPIO, DIGIT_2_BIT, true);
+void board_screen_wake(board_t board) {
+    (void)board;
+#if BSP_SCREEN_REFRESH_ISR
+    /* El contador quedo detenido; el proximo match se programa a un periodo para encender el primer digito */
+    Chip_TIMER_SetMatch(LPC_TIMER0, 0, Chip_TIMER_ReadCount(LPC_TIMER0) + refresh_period);
+    Chip_TIMER_ClearMatch(LPC_TIMER0, 0);
+    NVIC_ClearPendingIRQ(TIMER0_IRQn);
+    NVIC_EnableIRQ(TIMER0_IRQn);
+    Chip_TIMER_Enable(LPC_TIMER0);
+#endif
+}
 
-    Chip_SCU_PinMuxSet(DIGIT_3_PORT, DIGIT_3_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | DIGIT_3_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, DIGIT_3_GPIO, DIGIT_3_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, DIGIT_3_GPIO, DIGIT_3_BIT, true);
+void board_alarm_pattern(board_t board, const pattern_t * pattern) {
+    uint32_t interval;
+
+    NVIC_DisableIRQ(TIMER1_IRQn);
+    interval = PatternPlay(board->alarm_pattern, pattern);
+    if (interval) {
+        Chip_TIMER_SetMatch(LPC_TIMER1, 0,
+                            Chip_TIMER_ReadCount(LPC_TIMER1) + interval * (BSP_PATTERN_TIMER_HZ / 1000));
+        Chip_TIMER_ClearMatch(LPC_TIMER1, 0);
+        NVIC_ClearPendingIRQ(TIMER1_IRQn);
+        NVIC_EnableIRQ(TIMER1_IRQn);
+    }
+}
 
-    Chip_SCU_PinMuxSet(DIGIT_4_PORT, DIGIT_4_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | DIGIT_4_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, DIGIT_4_GPIO, DIGIT_4_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, DIGIT_4_GPIO, DIGIT_4_BIT, true);
+void TIMER1_IRQHandler(void) {
+    if (Chip_TIMER_MatchPending(LPC_TIMER1, 0)) {
+        Chip_TIMER_ClearMatch(LPC_TIMER1, 0);
+        uint32_t interval = PatternAdvance(pattern_player);
+        if (interval) {
+            Chip_TIMER_SetMatch(LPC_TIMER1, 0, LPC_TIMER1->MR[0] + interval * (BSP_PATTERN_TIMER_HZ / 1000));
+        } else {
+            NVIC_DisableIRQ(TIMER1_IRQn);
+        }
+    }
 }
 
-void SegmentsInit(void) {
+void board_frame_timer(uint32_t period_us, void (*handler)(void)) {
+    frame_handler = handler;
+    frame_period = period_us * (BSP_FRAME_TIMER_HZ / 1000000);
+
+    /* Igual que el barrido, el match avanza un periodo por interrupcion y los marcos no acumulan latencia */
+    Chip_TIMER_Init(LPC_TIMER2);
+    Chip_TIMER_PrescaleSet(LPC_TIMER2, Chip_Clock_GetRate(CLK_MX_TIMER2) / BSP_FRAME_TIMER_HZ - 1);
+    Chip_TIMER_SetMatch(LPC_TIMER2, 0, frame_period);
+    Chip_TIMER_MatchEnableInt(LPC_TIMER2, 0);
+    Chip_TIMER_Reset(LPC_TIMER2);
+
+    NVIC_SetPriority(TIMER2_IRQn, 2);
+    NVIC_ClearPendingIRQ(TIMER2_IRQn);
+    NVIC_EnableIRQ(TIMER2_IRQn);
+    Chip_TIMER_Enable(LPC_TIMER2);
+}
 
-    Chip_SCU_PinMuxSet(SEGMENT_A_PORT, SEGMENT_A_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_A_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_A_GPIO, SEGMENT_A_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_A_GPIO, SEGMENT_A_BIT, true);
+void TIMER2_IRQHandler(void) {
+    if (Chip_TIMER_MatchPending(LPC_TIMER2, 0)) {
+        Chip_TIMER_ClearMatch(LPC_TIMER2, 0);
+        Chip_TIMER_SetMatch(LPC_TIMER2, 0, LPC_TIMER2->MR[0] + frame_period);
+        frame_handler();
+    }
+}
 
-    Chip_SCU_PinMuxSet(SEGMENT_B_PORT, SEGMENT_B_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_B_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_B_GPIO, SEGMENT_B_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_B_GPIO, SEGMENT_B_BIT, true);
+void board_counter_start(void) {
+    Chip_TIMER_Init(LPC_TIMER3);
+    Chip_TIMER_PrescaleSet(LPC_TIMER3, Chip_Clock_GetRate(CLK_MX_TIMER3) / BSP_COUNTER_HZ - 1);
+    Chip_TIMER_Reset(LPC_TIMER3);
+    Chip_TIMER_Enable(LPC_TIMER3);
+}
 
-    Chip_SCU_PinMuxSet(SEGMENT_C_PORT, SEGMENT_C_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_C_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_C_GPIO, SEGMENT_C_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_C_GPIO, SEGMENT_C_BIT, true);
+uint32_t board_counter(void) {
+    return Chip_TIMER_ReadCount(LPC_TIMER3);
+}
 
-    Chip_SCU_PinMuxSet(SEGMENT_D_PORT, SEGMENT_D_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_D_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_D_GPIO, SEGMENT_D_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_D_GPIO, SEGMENT_D_BIT, true);
+void board_watchdog_start(uint32_t timeout_ms) {
+    Chip_WWDT_Init(LPC_WWDT);
+    Chip_WWDT_SetTimeOut(LPC_WWDT, timeout_ms * (BSP_WATCHDOG_HZ / 1000));
+    Chip_WWDT_SetOption(LPC_WWDT, WWDT_WDMOD_WDRESET);
+    Chip_WWDT_Start(LPC_WWDT);
+}
 
-    Chip_SCU_PinMuxSet(SEGMENT_E_PORT, SEGMENT_E_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_E_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_E_GPIO, SEGMENT_E_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_E_GPIO, SEGMENT_E_BIT, true);
+void board_watchdog_feed(void) {
+    /* La secuencia de alimentacion no puede intercalarse con otro acceso al periferico */
+    __disable_irq();
+    Chip_WWDT_Feed(LPC_WWDT);
+    __enable_irq();
+}
 
-    Chip_SCU_PinMuxSet(SEGMENT_F_PORT, SEGMENT_F_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_F_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_F_GPIO, SEGMENT_F_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_F_GPIO, SEGMENT_F_BIT, true);
+void TIMER0_IRQHandler(void) {
+    if (Chip_TIMER_MatchPending(LPC_TIMER0, 0)) {
+        Chip_TIMER_ClearMatch(LPC_TIMER0, 0);
+        uint32_t interval = ScreenRefreshTimed(refresh_screen, Chip_TIMER_ReadCount(LPC_TIMER0));
+        Chip_TIMER_SetMatch(LPC_TIMER0, 0, LPC_TIMER0->MR[0] + interval);
+    }
+}
 
-    Chip_SCU_PinMuxSet(SEGMENT_G_PORT, SEGMENT_G_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_G_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_G_GPIO, SEGMENT_G_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_G_GPIO, SEGMENT_G_BIT, true);
+/* === Private function definitions ================================================================================ */
 
-    Chip_SCU_PinMuxSet(SEGMENT_P_PORT, SEGMENT_P_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_P_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_P_GPIO, SEGMENT_P_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_P_GPIO, SEGMENT_P_BIT, true);
-}
+static void PinsInit(bool display) {
+    uint32_t outputs[BSP_GPIO_PORTS] = {0};
+    const bsp_pin_t * entry;
+
+    for (uint8_t i = 0; i < sizeof(BOARD_PINS) / sizeof(BOARD_PINS[0]); i++) {
+        entry = &BOARD_PINS[i];
+        if (entry->class != BSP_PIN_KEY && !display) {
+            continue;
+        }
+        Chip_SCU_PinMuxSet(entry->port, entry->pin, entry->mode);
+        if (entry->class != BSP_PIN_KEY) {
+            outputs[entry->gpio] |= 1u << entry->bit;
+        }
+    }
 
-void KeysInit(void) {
-    Chip_SCU_PinMuxSet(KEY_F1_PORT, KEY_F1_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_PULLUP | KEY_F1_FUNC);
-    Chip_SCU_PinMuxSet(KEY_F2_PORT, KEY_F2_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_PULLUP | KEY_F2_FUNC);
-    Chip_SCU_PinMuxSet(KEY_F3_PORT, KEY_F3_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_PULLUP | KEY_F3_FUNC);
-    Chip_SCU_PinMuxSet(KEY_F4_PORT, KEY_F4_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_PULLUP | KEY_F4_FUNC);
-    Chip_SCU_PinMuxSet(KEY_ACCEPT_PORT, KEY_ACCEPT_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_PULLUP | KEY_ACCEPT_FUNC);
-    Chip_SCU_PinMuxSet(KEY_CANCEL_PORT, KEY_CANCEL_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_PULLUP | KEY_CANCEL_FUNC);
+    /* Las salidas se apagan antes de habilitarlas, con una escritura por puerto para todos sus pines */
+    for (uint8_t port = 0; port < BSP_GPIO_PORTS; port++) {
+        if (outputs[port] != 0) {
+            Chip_GPIO_ClearValue(LPC_GPIO_PORT, port, outputs[port]);
+            Chip_GPIO_SetPortDIROutput(LPC_GPIO_PORT, port, outputs[port]);
+        }
+    }
 }
 
 void DigitsTurnOff(void) {
     Chip_GPIO_ClearValue(LPC_GPIO_PORT, DIGITS_GPIO, DIGITS_MASK);
     Chip_GPIO_ClearValue(LPC_GPIO_PORT, SEGMENTS_GPIO, SEGMENTS_MASK);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_P_GPIO, SEGMENT_P_BIT, false);
+    SegmentPointDeactivate();
 }
 void SegmentsUpdate(uint8_t value) {
     Chip_GPIO_SetValue(LPC_GPIO_PORT, SEGMENTS_GPIO, (value & SEGMENTS_MASK));
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_P_GPIO, SEGMENT_P_BIT, (value & SEGMENT_P));
+    SegmentPointWrite((value & SEGMENT_P) != 0);
 }
 
 void DigitTurnOn(uint8_t digit) {
-    Chip_GPIO_SetValue(LPC_GPIO_PORT, DIGITS_GPIO, (1 << (3 - digit)) & DIGITS_MASK);
+    Chip_GPIO_SetValue(LPC_GPIO_PORT, DIGITS_GPIO, DIGIT_ON_MASK[digit & 0x03]);
+}
+
+void DigitsBlank(void) {
+    Chip_GPIO_ClearValue(LPC_GPIO_PORT, DIGITS_GPIO, DIGITS_MASK);
+}
+
+void DigitCommit(uint8_t digit, uint8_t segments) {
+    /* Los digitos quedan apagados solo entre la primera y la ultima escritura; las funciones de LPCOpen son en linea
+     * y cada una compila a un solo almacenamiento en SET o CLR */
+    Chip_GPIO_ClearValue(LPC_GPIO_PORT, DIGITS_GPIO, DIGITS_MASK);
+    Chip_GPIO_ClearValue(LPC_GPIO_PORT, SEGMENTS_GPIO, ~segments & SEGMENTS_MASK);
+    Chip_GPIO_SetValue(LPC_GPIO_PORT, SEGMENTS_GPIO, segments & SEGMENTS_MASK);
+    SegmentPointWrite((segments & SEGMENT_P) != 0);
+    Chip_GPIO_SetValue(LPC_GPIO_PORT, DIGITS_GPIO, DIGIT_ON_MASK[digit & 0x03]);
+}
+
+static void ScreenTimerInit(screen_t screen, uint32_t frequency) {
+    refresh_screen = screen;
+    refresh_period = BSP_SCREEN_TIMER_HZ / frequency;
+    ScreenSetRefreshPeriod(screen, refresh_period);
+
+    /* El contador corre libre y cada interrupcion adelanta el match un periodo, asi la cadencia no depende de la
+     * latencia con que se atiende la interrupcion y la lectura del contador mide directamente el jitter */
+    Chip_TIMER_Init(LPC_TIMER0);
+    Chip_TIMER_PrescaleSet(LPC_TIMER0, Chip_Clock_GetRate(CLK_MX_TIMER0) / BSP_SCREEN_TIMER_HZ - 1);
+    Chip_TIMER_SetMatch(LPC_TIMER0, 0, refresh_period);
+    Chip_TIMER_MatchEnableInt(LPC_TIMER0, 0);
+    Chip_TIMER_Reset(LPC_TIMER0);
+
+    NVIC_SetPriority(TIMER0_IRQn, 0);
+    NVIC_ClearPendingIRQ(TIMER0_IRQn);
+    NVIC_EnableIRQ(TIMER0_IRQn);
+    Chip_TIMER_Enable(LPC_TIMER0);
+}
+
+static void PatternTimerInit(pattern_player_t player) {
+    pattern_player = player;
+
+    /* El contador corre libre sin interrupciones hasta que se reproduce una secuencia */
+    Chip_TIMER_Init(LPC_TIMER1);
+    Chip_TIMER_PrescaleSet(LPC_TIMER1, Chip_Clock_GetRate(CLK_MX_TIMER1) / BSP_PATTERN_TIMER_HZ - 1);
+    Chip_TIMER_MatchEnableInt(LPC_TIMER1, 0);
+    Chip_TIMER_Reset(LPC_TIMER1);
+
+    NVIC_SetPriority(TIMER1_IRQn, 1);
+    NVIC_DisableIRQ(TIMER1_IRQn);
+    Chip_TIMER_Enable(LPC_TIMER1);
+}
+
+#if BSP_DISPLAY_MAX7219
+static void DisplayBusInit(void) {
+    Chip_SCU_PinMuxSet(MAX7219_MOSI_PORT, MAX7219_MOSI_PIN, SCU_MODE_INACT | MAX7219_MOSI_FUNC);
+    Chip_SCU_PinMuxSet(MAX7219_SCK_PORT, MAX7219_SCK_PIN, SCU_MODE_INACT | MAX7219_SCK_FUNC);
+    Chip_SCU_PinMuxSet(MAX7219_LOAD_PORT, MAX7219_LOAD_PIN, SCU_MODE_INACT | MAX7219_LOAD_FUNC);
+
+    Chip_SSP_Init(LPC_SSP1);
+    Chip_SSP_SetFormat(LPC_SSP1, SSP_BITS_16, SSP_FRAMEFORMAT_SPI, SSP_CLOCK_CPHA0_CPOL0);
+    Chip_SSP_SetBitRate(LPC_SSP1, MAX7219_BITRATE);
+    Chip_SSP_Enable(LPC_SSP1);
+    Chip_SSP_DMA_Enable(LPC_SSP1);
+
+    Chip_GPDMA_Init(LPC_GPDMA);
+    display_dma_channel = Chip_GPDMA_GetFreeChannel(LPC_GPDMA, GPDMA_CONN_SSP1_Tx);
+}
+
+static void DisplayBusWrite(const uint16_t words[], uint8_t count) {
+    static DMA_TransferDescriptor_t descriptor;
+
+    /* Un cuadro completo dura menos de 200 us a 1 Mbps, muy por debajo del periodo de la tarea de interfaz */
+    while (LPC_GPDMA->ENBLDCHNS & (1 << display_dma_channel)) {
+    }
+    memcpy(display_words, words, count * sizeof(uint16_t));
+
+    Chip_GPDMA_InitDescriptor(LPC_GPDMA, &descriptor, (uint32_t)(uintptr_t)display_words, GPDMA_CONN_SSP1_Tx, count,
+                              GPDMA_TRANSFERTYPE_M2P_CONTROLLER_DMA, NULL);
+    /* La tabla de LPCOpen usa ancho de byte para SSP, pero cada trama del MAX7219 es de 16 bits */
+    descriptor.ctrl &= ~(GPDMA_DMACCxControl_SWidth(0x07) | GPDMA_DMACCxControl_DWidth(0x07));
+    descriptor.ctrl |= GPDMA_DMACCxControl_SWidth(GPDMA_WIDTH_HALFWORD) |
+                       GPDMA_DMACCxControl_DWidth(GPDMA_WIDTH_HALFWORD);
+    Chip_GPDMA_SGTransfer(LPC_GPDMA, display_dma_channel, &descriptor, GPDMA_TRANSFERTYPE_M2P_CONTROLLER_DMA);
+}
+
+static void DisplayFrameTransfer(const uint8_t segments[], uint8_t digits, uint8_t brightness) {
+    Max7219WriteFrame(display_chip, segments, digits, brightness);
+}
+#elif BSP_DISPLAY_HD44780
+static void DisplayBusInit(void) {
+    const bsp_pin_t * entry;
+
+    for (uint8_t i = 0; i < sizeof(DISPLAY_PINS) / sizeof(DISPLAY_PINS[0]); i++) {
+        entry = &DISPLAY_PINS[i];
+        Chip_SCU_PinMuxSet(entry->port, entry->pin, entry->mode);
+        Chip_GPIO_SetPinState(LPC_GPIO_PORT, entry->gpio, entry->bit, false);
+        Chip_GPIO_SetPinDIROutput(LPC_GPIO_PORT, entry->gpio, entry->bit);
+    }
+
+    /* Secuencia de inicializacion por instrucciones de la hoja de datos: tres veces el modo de 8 bits, que lleva al
+     * controlador a un estado conocido desde cualquier modo, y despues el de 4 bits. Hd44780Create envia el resto */
+    board_counter_start();
+    DisplayWait(HD44780_POWER_UP_US);
+    DisplayBusNibble(0x3);
+    DisplayWait(4100);
+    DisplayBusNibble(0x3);
+    DisplayWait(100);
+    DisplayBusNibble(0x3);
+    DisplayWait(HD44780_COMMAND_US);
+    DisplayBusNibble(0x2);
+    DisplayWait(HD44780_COMMAND_US);
+}
+
+static void DisplayWait(uint32_t us) {
+    uint32_t start = board_counter();
+
+    while (board_counter() - start < us) {
+    }
 }
+
+static void DisplayBusNibble(uint8_t nibble) {
+    for (uint8_t i = 0; i < HD44780_PIN_RS; i++) {
+        Chip_GPIO_SetPinState(LPC_GPIO_PORT, DISPLAY_PINS[i].gpio, DISPLAY_PINS[i].bit, (nibble >> i) & 1u);
+    }
+    /* EN necesita 450 ns en alto y los datos se toman en el flanco de bajada; la espera de 1 us cubre los dos */
+    Chip_GPIO_SetPinState(LPC_GPIO_PORT, DISPLAY_PINS[HD44780_PIN_EN].gpio, DISPLAY_PINS[HD44780_PIN_EN].bit, true);
+    DisplayWait(1);
+    Chip_GPIO_SetPinState(LPC_GPIO_PORT, DISPLAY_PINS[HD44780_PIN_EN].gpio, DISPLAY_PINS[HD44780_PIN_EN].bit, false);
+    DisplayWait(1);
+}
+
+static void DisplayBusWrite(bool data, uint8_t value) {
+    Chip_GPIO_SetPinState(LPC_GPIO_PORT, DISPLAY_PINS[HD44780_PIN_RS].gpio, DISPLAY_PINS[HD44780_PIN_RS].bit, data);
+    DisplayBusNibble(value >> 4);
+    DisplayBusNibble(value & 0x0F);
+    /* Borrar y volver al inicio son las unicas instrucciones lentas */
+    DisplayWait((!data && value <= 0x03) ? HD44780_CLEAR_US : HD44780_COMMAND_US);
+}
+
+static void DisplayFrameTransfer(const uint8_t segments[], uint8_t digits, uint8_t brightness) {
+    Hd44780WriteFrame(display_chip, segments, digits, brightness);
+}
+#endif
+
 /* === End of documentation ======================================================================================== */
\ No newline at end of file
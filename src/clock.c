@@ -24,11 +24,14 @@ SPDX-License-Identifier: MIT
 /* === Headers files inclusions ==================================================================================== */
 
 #include "clock.h"
+#include "probe.h"
 #include <stddef.h>
 #include <string.h>
 
 /* === Macros definitions ========================================================================================== */
 
+#define SECONDS_PER_DAY 86400UL // Segundos de un dia
+
 /* === Private data type declarations ============================================================================== */
 
 /**
@@ -49,6 +52,38 @@ struct clock_s {
 };
 /* === Private function declarations =============================================================================== */
 
+/**
+ * @brief Dispara la alarma o la posposicion si la hora actual coincide con alguna de ellas.
+ *
+ * @param self Instancia del reloj.
+ */
+static void ClockCheckAlarm(clock_t self);
+
+/**
+ * @brief Convierte una hora BCD en segundos desde la medianoche.
+ *
+ * @param time Hora a convertir.
+ * @return uint32_t Segundos desde la medianoche.
+ */
+static uint32_t TimeToSeconds(const clock_time_t * time);
+
+/**
+ * @brief Convierte segundos desde la medianoche en una hora BCD.
+ *
+ * @param seconds Segundos desde la medianoche, menores a un dia.
+ * @param time Hora resultante.
+ */
+static void SecondsToTime(uint32_t seconds, clock_time_t * time);
+
+/**
+ * @brief Calcula cuantos segundos faltan para la proxima vez que el reloj marque una hora.
+ *
+ * @param from Hora actual en segundos desde la medianoche.
+ * @param to Hora buscada en segundos desde la medianoche.
+ * @return uint32_t Segundos hasta la hora buscada, entre 1 y un dia completo.
+ */
+static uint32_t SecondsUntil(uint32_t from, uint32_t to);
+
 /* === Private variable definitions ================================================================================ */
 
 /* === Public variable definitions ================================================================================= */
@@ -95,6 +130,7 @@ bool ClockSetTime(clock_t self, const clock_time_t * new_time) {
 }
 
 void ClockNewTick(clock_t self) {
+    PROBE_BEGIN(PROBE_CLOCK_TICK);
     self->clock_ticks++;
     if (self->clock_ticks == self->ticks_for_seconds) {
         self->clock_ticks = 0;
@@ -127,15 +163,53 @@ void ClockNewTick(clock_t self) {
         }
     }
 
-    if (self->alarm_enabled && !self->alarm_canceled && !self->snooze_enabled &&
-        memcmp(&self->current_time, &self->alarm_time, sizeof(clock_time_t)) == 0) {
-        self->alarm_triggered = true;
-    }
+    ClockCheckAlarm(self);
+    PROBE_END(PROBE_CLOCK_TICK);
+}
 
-    if (self->snooze_enabled && memcmp(&self->current_time, &self->snooze_time, sizeof(clock_time_t)) == 0) {
-        self->alarm_triggered = true;
-        self->snooze_enabled = false;
+void ClockAdvance(clock_t self, uint32_t ticks) {
+    uint32_t elapsed = ticks / self->ticks_for_seconds;
+    uint32_t rest = ticks % self->ticks_for_seconds + self->clock_ticks;
+
+    if (ticks == 0) {
+        return;
+    }
+    /* Los ticks anteriores al primer cambio de segundo verifican la alarma en la hora de partida */
+    if (self->clock_ticks + 1u < self->ticks_for_seconds) {
+        ClockCheckAlarm(self);
+    }
+    if (rest >= self->ticks_for_seconds) {
+        rest -= self->ticks_for_seconds;
+        elapsed++;
+    }
+    self->clock_ticks = (uint16_t)rest;
+
+    if (elapsed > 0) {
+        uint32_t from = TimeToSeconds(&self->current_time);
+        uint32_t midnight = SecondsUntil(from, 0);
+        bool snoozed = self->snooze_enabled;
+
+        SecondsToTime((from + elapsed % SECONDS_PER_DAY) % SECONDS_PER_DAY, &self->current_time);
+
+        /* Se dispara lo que ClockNewTick hubiera disparado en alguno de los segundos salteados: la alarma
+         * cancelada vuelve a sonar si la medianoche llego antes que ella */
+        if (self->alarm_enabled && !snoozed) {
+            uint32_t alarm = SecondsUntil(from, TimeToSeconds(&self->alarm_time));
+            if (alarm <= elapsed &&
+                (!self->alarm_canceled || midnight <= alarm || alarm + SECONDS_PER_DAY <= elapsed)) {
+                self->alarm_triggered = true;
+            }
+        }
+        if (snoozed && SecondsUntil(from, TimeToSeconds(&self->snooze_time)) <= elapsed) {
+            self->alarm_triggered = true;
+            self->snooze_enabled = false;
+        }
+        if (midnight <= elapsed) {
+            self->alarm_canceled = false;
+        }
     }
+
+    ClockCheckAlarm(self);
 }
 
 bool ClockSetAlarm(clock_t self, const clock_time_t * alarm) {
@@ -170,25 +244,8 @@ void ClockDisableAlarm(clock_t self) {
 
 void ClockSnooze(clock_t self) {
     if (self->alarm_triggered && self->snooze > 0) {
-        memcpy(&self->snooze_time, &self->current_time, sizeof(clock_time_t));
-        self->snooze_time.time.minutes[0] += self->snooze;
-
-        if (self->snooze_time.time.minutes[0] > 9) {
-            self->snooze_time.time.minutes[0] -= 10;
-            self->snooze_time.time.minutes[1]++;
-            if (self->snooze_time.time.minutes[1] > 5) {
-                self->snooze_time.time.minutes[1] = 0;
-                self->snooze_time.time.hours[0]++;
-                if (self->snooze_time.time.hours[0] > 9) {
-                    self->snooze_time.time.hours[0] = 0;
-                    self->snooze_time.time.hours[1]++;
-                    if (self->snooze_time.time.hours[1] == 2 && self->snooze_time.time.hours[0] > 3) {
-                        self->snooze_time.time.hours[0] = 0;
-                        self->snooze_time.time.hours[1] = 0;
-                    }
-                }
-            }
-        }
+        /* En segundos desde la medianoche, para que la posposicion pase bien la medianoche y admita mas de 9 minutos */
+        SecondsToTime((TimeToSeconds(&self->current_time) + self->snooze * 60UL) % SECONDS_PER_DAY, &self->snooze_time);
 
         self->alarm_triggered = false;
         self->snooze_enabled = true;
@@ -207,12 +264,50 @@ bool ClockIsAlarmEnabled(clock_t self){
 }
 
 void AlarmLedOn(digital_output_t alarm_led) {
-    DigitalOutputDeactivate(alarm_led);
+    DigitalOutputActivate(alarm_led);
 }
+
 void AlarmLedOff(digital_output_t alarm_led) {
-    DigitalOutputActivate(alarm_led);
+    DigitalOutputDeactivate(alarm_led);
 }
 
 /* === Private function definitions ================================================================================ */
 
+static void ClockCheckAlarm(clock_t self) {
+    if (self->alarm_enabled && !self->alarm_canceled && !self->snooze_enabled &&
+        memcmp(&self->current_time, &self->alarm_time, sizeof(clock_time_t)) == 0) {
+        self->alarm_triggered = true;
+    }
+
+    if (self->snooze_enabled && memcmp(&self->current_time, &self->snooze_time, sizeof(clock_time_t)) == 0) {
+        self->alarm_triggered = true;
+        self->snooze_enabled = false;
+    }
+}
+
+static uint32_t TimeToSeconds(const clock_time_t * time) {
+    uint32_t hours = time->time.hours[1] * 10 + time->time.hours[0];
+    uint32_t minutes = time->time.minutes[1] * 10 + time->time.minutes[0];
+
+    return (hours * 60 + minutes) * 60 + time->time.seconds[1] * 10 + time->time.seconds[0];
+}
+
+static void SecondsToTime(uint32_t seconds, clock_time_t * time) {
+    uint32_t minutes = seconds / 60;
+    uint32_t hours = minutes / 60;
+
+    seconds %= 60;
+    minutes %= 60;
+    time->time.seconds[0] = (uint8_t)(seconds % 10);
+    time->time.seconds[1] = (uint8_t)(seconds / 10);
+    time->time.minutes[0] = (uint8_t)(minutes % 10);
+    time->time.minutes[1] = (uint8_t)(minutes / 10);
+    time->time.hours[0] = (uint8_t)(hours % 10);
+    time->time.hours[1] = (uint8_t)(hours / 10);
+}
+
+static uint32_t SecondsUntil(uint32_t from, uint32_t to) {
+    return (to + SECONDS_PER_DAY - from - 1) % SECONDS_PER_DAY + 1;
+}
+
 /* === End of documentation ======================================================================================== */
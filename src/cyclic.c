@@ -0,0 +1,115 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Martin Nicolas Soria <soria.m.nicolas@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, disponiblestribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file cyclic.c
+ ** @brief Ejecutivo ciclico con tabla estatica de marcos menores y mayor
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "cyclic.h"
+#include "pool.h"
+#include <stdlib.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! Cantidad de ejecutivos que se pueden crear con STATIC_ALLOCATION
+#ifndef CYCLIC_POOL
+#define CYCLIC_POOL 1
+#endif
+
+/* === Private data type declarations ============================================================================== */
+
+//! Estructura que representa un ejecutivo ciclico
+struct cyclic_s {
+    const cyclic_schedule_t * schedule; //!< Tabla de marcos
+    volatile uint32_t ticks;            //!< Marcos empezados, escrito solo desde la interrupcion
+    uint32_t done;                      //!< Marcos corridos, escrito solo desde el lazo principal
+    uint32_t overruns;                  //!< Marcos que terminaron despues del comienzo del siguiente
+    uint8_t frame;                      //!< Proximo marco de la tabla a correr
+};
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+
+//! Objetos de los ejecutivos
+POOL_DECLARE(struct cyclic_s, cyclic_pool, CYCLIC_POOL)
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Public function definitions ================================================================================= */
+
+cyclic_t CyclicCreate(const cyclic_schedule_t * schedule) {
+    cyclic_t self = NULL;
+
+    if (schedule == NULL || schedule->jobs == NULL || schedule->frames == NULL || schedule->job_count == 0 ||
+        schedule->job_count > CYCLIC_MAX_JOBS || schedule->frame_count == 0) {
+        return NULL;
+    }
+    self = POOL_ALLOC(struct cyclic_s, cyclic_pool);
+    if (self != NULL) {
+        self->schedule = schedule;
+        self->ticks = 0;
+        self->done = 0;
+        self->overruns = 0;
+        self->frame = 0;
+    }
+    return self;
+}
+
+void CyclicTick(cyclic_t self) {
+    self->ticks++;
+}
+
+bool CyclicIsPending(cyclic_t self) {
+    return self->ticks != self->done;
+}
+
+bool CyclicRunPending(cyclic_t self) {
+    const cyclic_schedule_t * schedule = self->schedule;
+    uint32_t jobs;
+
+    if (self->ticks == self->done) {
+        return false;
+    }
+    jobs = schedule->frames[self->frame];
+    for (uint8_t i = 0; i < schedule->job_count && jobs != 0; i++, jobs >>= 1) {
+        if (jobs & 1u) {
+            schedule->jobs[i]();
+        }
+    }
+    if (++self->frame >= schedule->frame_count) {
+        self->frame = 0;
+    }
+    self->done++;
+    if (self->ticks != self->done) {
+        self->overruns++;
+    }
+    return true;
+}
+
+uint32_t CyclicGetOverruns(cyclic_t self) {
+    return self->overruns;
+}
+
+/* === Private function definitions ================================================================================ */
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,237 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Martin Nicolas Soria <soria.m.nicolas@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, disponiblestribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file deadline.c
+ ** @brief Monitor de plazos de las tareas periodicas
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "deadline.h"
+#include "pool.h"
+#include <stdlib.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! Cantidad de monitores que se pueden crear con STATIC_ALLOCATION
+#ifndef DEADLINE_POOL
+#define DEADLINE_POOL 1
+#endif
+
+/* === Private data type declarations ============================================================================== */
+
+//! Estado de una tarea monitoreada
+typedef struct deadline_task_s {
+    uint32_t period;                 //!< Periodo declarado
+    uint32_t deadline;               //!< Plazo declarado
+    uint32_t expected;               //!< Liberacion esperada de la vuelta en curso
+    uint32_t next;                   //!< Liberacion pedida para la vuelta siguiente con DeadlineSchedule
+    uint32_t limit;                  //!< Momento desde el que la tarea se considera colgada
+    uint32_t completed;              //!< Momento en que termino la ultima vuelta
+    uint32_t misses;                 //!< Plazos vencidos
+    uint32_t jitter[DEADLINE_BINS];  //!< Histograma de latencia de liberacion
+    bool declared;                   //!< Indica si la tarea fue declarada
+    bool active;                     //!< Indica si la tarea ya tiene una liberacion de referencia
+    bool scheduled;                  //!< Indica si la liberacion siguiente es la de next y no la periodica
+} deadline_task_t;
+
+//! Estructura que representa un monitor de plazos
+struct deadline_s {
+    deadline_miss_t handler;                   //!< Funcion de aviso de plazos vencidos
+    uint32_t seen_misses;                      //!< Total de plazos vencidos en la ultima llamada a DeadlineAllMet
+    deadline_task_t tasks[DEADLINE_MAX_TASKS]; //!< Estado de cada tarea, que solo escribe la propia tarea
+    uint32_t stalls[DEADLINE_MAX_TASKS];       //!< Vueltas colgadas de cada tarea, que cuenta DeadlineAllMet
+    uint32_t stalled[DEADLINE_MAX_TASKS];      //!< Limite de la ultima vuelta colgada contada de cada tarea
+    bool stalling[DEADLINE_MAX_TASKS];         //!< Indica si la tarea sigue colgada desde la ultima cuenta
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Devuelve el intervalo del histograma que corresponde a una latencia
+ *
+ * @param jitter Latencia de liberacion
+ * @return uint8_t Intervalo, menor a DEADLINE_BINS
+ */
+static uint8_t JitterBin(uint32_t jitter);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Objetos de los monitores de plazos
+POOL_DECLARE(struct deadline_s, deadline_pool, DEADLINE_POOL)
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Public function definitions ================================================================================= */
+
+deadline_t DeadlineCreate(deadline_miss_t handler) {
+    deadline_t self = POOL_ALLOC(struct deadline_s, deadline_pool);
+
+    if (self != NULL) {
+        self->handler = handler;
+        self->seen_misses = 0;
+        for (uint8_t task = 0; task < DEADLINE_MAX_TASKS; task++) {
+            self->tasks[task] = (deadline_task_t){0};
+            self->stalls[task] = 0;
+            self->stalling[task] = false;
+        }
+    }
+    return self;
+}
+
+bool DeadlineDeclare(deadline_t self, uint8_t task, uint32_t period, uint32_t deadline) {
+    if (!self || task >= DEADLINE_MAX_TASKS || period == 0 || deadline == 0) {
+        return false;
+    }
+    self->tasks[task].period = period;
+    self->tasks[task].deadline = deadline;
+    self->tasks[task].declared = true;
+    self->tasks[task].active = false;
+    self->tasks[task].scheduled = false;
+    return true;
+}
+
+void DeadlineRelease(deadline_t self, uint8_t task, uint32_t now) {
+    deadline_task_t * state;
+    uint32_t jitter;
+
+    if (!self || task >= DEADLINE_MAX_TASKS || !self->tasks[task].declared) {
+        return;
+    }
+    state = &self->tasks[task];
+    if (!state->active) {
+        state->active = true;
+        state->scheduled = false;
+        state->expected = now;
+        state->completed = now;
+        state->limit = now + state->period + state->deadline;
+        return;
+    }
+
+    state->expected = state->scheduled ? state->next : state->expected + state->period;
+    state->scheduled = false;
+    /* Una vuelta puede pasarse de su plazo hasta un periodo antes de que se la considere colgada */
+    state->limit = state->expected + state->period + state->deadline;
+    jitter = now - state->expected;
+    /* El contador y el tick del kernel pueden tener una fase apenas distinta: una liberacion adelantada no tiene
+     * latencia */
+    if ((int32_t)jitter < 0) {
+        jitter = 0;
+    }
+    state->jitter[JitterBin(jitter)]++;
+}
+
+bool DeadlineComplete(deadline_t self, uint8_t task, uint32_t now) {
+    deadline_task_t * state;
+    uint32_t response;
+
+    if (!self || task >= DEADLINE_MAX_TASKS || !self->tasks[task].active) {
+        return true;
+    }
+    state = &self->tasks[task];
+    state->completed = now;
+    response = now - state->expected;
+    if ((int32_t)response <= 0 || response <= state->deadline) {
+        return true;
+    }
+
+    state->misses++;
+    if (self->handler) {
+        self->handler(task, response - state->deadline);
+    }
+    return false;
+}
+
+void DeadlineSchedule(deadline_t self, uint8_t task, uint32_t release) {
+    deadline_task_t * state;
+
+    if (!self || task >= DEADLINE_MAX_TASKS || !self->tasks[task].active) {
+        return;
+    }
+    state = &self->tasks[task];
+    state->next = release;
+    state->limit = release + state->deadline;
+    state->scheduled = true;
+}
+
+void DeadlinePause(deadline_t self, uint8_t task) {
+    if (self && task < DEADLINE_MAX_TASKS) {
+        self->tasks[task].active = false;
+    }
+}
+
+bool DeadlineAllMet(deadline_t self, uint32_t now) {
+    bool met = true;
+    uint32_t misses = 0;
+
+    if (!self) {
+        return false;
+    }
+    /* Cada tarea solo cuenta sus propios plazos vencidos; sumarlos aca evita un contador compartido entre tareas de
+     * distinta prioridad */
+    for (uint8_t task = 0; task < DEADLINE_MAX_TASKS; task++) {
+        const deadline_task_t * state = &self->tasks[task];
+        uint32_t limit = state->limit;
+
+        misses += state->misses;
+        if (!state->active || (int32_t)(now - limit) <= 0) {
+            self->stalling[task] = false;
+            continue;
+        }
+        /* Una tarea colgada no llega a DeadlineComplete, asi que su plazo vencido se cuenta aca, una vez por vuelta */
+        met = false;
+        if (!self->stalling[task] || self->stalled[task] != limit) {
+            self->stalling[task] = true;
+            self->stalled[task] = limit;
+            self->stalls[task]++;
+            if (self->handler) {
+                self->handler(task, now - limit);
+            }
+        }
+    }
+    if (misses != self->seen_misses) {
+        self->seen_misses = misses;
+        met = false;
+    }
+    return met;
+}
+
+uint32_t DeadlineGetMisses(deadline_t self, uint8_t task) {
+    return (self && task < DEADLINE_MAX_TASKS) ? self->tasks[task].misses + self->stalls[task] : 0;
+}
+
+uint32_t DeadlineGetJitter(deadline_t self, uint8_t task, uint8_t bin) {
+    return (self && task < DEADLINE_MAX_TASKS && bin < DEADLINE_BINS) ? self->tasks[task].jitter[bin] : 0;
+}
+
+/* === Private function definitions ================================================================================ */
+
+static uint8_t JitterBin(uint32_t jitter) {
+    uint8_t bin = 0;
+    uint32_t limit = DEADLINE_JITTER_BASE;
+
+    while (bin < DEADLINE_BINS - 1 && jitter >= limit) {
+        bin++;
+        limit *= 2;
+    }
+    return bin;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,227 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Martin Nicolas Soria <soria.m.nicolas@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, disponiblestribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file diag.c
+ ** @brief Estadisticas de ejecucion de las tareas y su presentacion en la pantalla y en JSON
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "diag.h"
+#include "pool.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! Cantidad de estadisticas que se pueden crear con STATIC_ALLOCATION
+#ifndef DIAG_POOL
+#define DIAG_POOL 1
+#endif
+
+//! Clases de paginas que se muestran por tarea: uso de CPU, pila libre y vuelta mas larga
+#define PAGES_PER_TASK 3
+
+//! Valor mas grande que entra en los tres digitos de una pagina
+#define PAGE_MAX_VALUE 999
+
+/* === Private data type declarations ============================================================================== */
+
+//! Estadisticas de una tarea
+typedef struct diag_task_s {
+    uint32_t runtime;    //!< Tiempo de ejecucion de la muestra en curso
+    uint32_t previous;   //!< Tiempo de ejecucion de la muestra anterior
+    uint32_t stack_free; //!< Minimo de pila libre, en palabras
+    uint32_t loop_max;   //!< Vuelta mas larga del ciclo
+    uint8_t cpu;         //!< Uso de CPU de la ultima muestra, en porcentaje
+} diag_task_t;
+
+//! Estructura que representa las estadisticas
+struct diag_s {
+    const char * const * names;          //!< Nombres de las tareas
+    uint8_t count;                       //!< Cantidad de tareas
+    uint32_t previous;                   //!< Contador de ejecucion de la muestra anterior
+    uint32_t heap_free;                  //!< Minimo de heap libre, en bytes
+    diag_task_t tasks[DIAG_MAX_TASKS];   //!< Estadisticas de cada tarea
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Calcula donde seguir escribiendo un texto que pudo quedar cortado
+ *
+ * @param total Largo del texto completo escrito hasta ahora
+ * @param size Tamaño del destino
+ * @return size_t Posicion del terminador en el destino
+ */
+static size_t JsonOffset(int total, size_t size);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Objetos de las estadisticas
+POOL_DECLARE(struct diag_s, diag_pool, DIAG_POOL)
+
+//! Letra de cada clase de pagina por tarea
+static const char PAGE_LETTERS[PAGES_PER_TASK] = {'C', 'S', 'L'};
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Public function definitions ================================================================================= */
+
+diag_t DiagCreate(const char * const names[], uint8_t count) {
+    diag_t self = NULL;
+
+    if (names != NULL && count > 0 && count <= DIAG_MAX_TASKS) {
+        self = POOL_ALLOC(struct diag_s, diag_pool);
+    }
+    if (self != NULL) {
+        self->names = names;
+        self->count = count;
+        self->previous = 0;
+        self->heap_free = 0;
+        for (uint8_t task = 0; task < DIAG_MAX_TASKS; task++) {
+            self->tasks[task] = (diag_task_t){0};
+        }
+    }
+    return self;
+}
+
+void DiagLoopTime(diag_t self, uint8_t task, uint32_t elapsed) {
+    if (self && task < self->count && elapsed > self->tasks[task].loop_max) {
+        self->tasks[task].loop_max = elapsed;
+    }
+}
+
+void DiagTaskSample(diag_t self, uint8_t task, uint32_t runtime, uint32_t stack_free) {
+    if (self && task < self->count) {
+        self->tasks[task].runtime = runtime;
+        self->tasks[task].stack_free = stack_free;
+    }
+}
+
+void DiagSystemSample(diag_t self, uint32_t runtime, uint32_t heap_free_min) {
+    uint32_t total;
+
+    if (!self) {
+        return;
+    }
+    total = runtime - self->previous;
+    for (uint8_t task = 0; task < self->count; task++) {
+        diag_task_t * stats = &self->tasks[task];
+        uint32_t used = stats->runtime - stats->previous;
+
+        stats->cpu = total ? (uint8_t)(((uint64_t)used * 100 + total / 2) / total) : 0;
+        stats->previous = stats->runtime;
+    }
+    self->previous = runtime;
+    self->heap_free = heap_free_min;
+}
+
+uint8_t DiagGetCpu(diag_t self, uint8_t task) {
+    return (self && task < self->count) ? self->tasks[task].cpu : 0;
+}
+
+uint32_t DiagGetStackFree(diag_t self, uint8_t task) {
+    return (self && task < self->count) ? self->tasks[task].stack_free : 0;
+}
+
+uint32_t DiagGetLoopMax(diag_t self, uint8_t task) {
+    return (self && task < self->count) ? self->tasks[task].loop_max : 0;
+}
+
+uint32_t DiagGetHeapFree(diag_t self) {
+    return self ? self->heap_free : 0;
+}
+
+uint8_t DiagGetPages(diag_t self) {
+    return self ? (uint8_t)(self->count * PAGES_PER_TASK + 1) : 0;
+}
+
+bool DiagFormatPage(diag_t self, uint8_t page, char text[DIAG_PAGE_TEXT]) {
+    uint8_t kind;
+    uint8_t task;
+    uint32_t value;
+    char digits[4];
+    uint8_t length = 0;
+
+    if (!self || page >= DiagGetPages(self)) {
+        return false;
+    }
+    if (page == self->count * PAGES_PER_TASK) {
+        value = self->heap_free / 100;
+        if (value > PAGE_MAX_VALUE) {
+            value = PAGE_MAX_VALUE;
+        }
+        snprintf(text, DIAG_PAGE_TEXT, "H%02u.%u", (unsigned)(value / 10), (unsigned)(value % 10));
+        return true;
+    }
+
+    kind = page / self->count;
+    task = page % self->count;
+    value = (kind == 0) ? self->tasks[task].cpu
+                        : (kind == 1) ? self->tasks[task].stack_free : self->tasks[task].loop_max;
+    if (value > PAGE_MAX_VALUE) {
+        value = PAGE_MAX_VALUE;
+    }
+    snprintf(digits, sizeof(digits), "%03u", (unsigned)value);
+
+    /* El punto sigue al digito con el indice de la tarea, que puede ser la letra */
+    text[length++] = PAGE_LETTERS[kind];
+    for (uint8_t digit = 0; digit < 3; digit++) {
+        if (digit == task) {
+            text[length++] = '.';
+        }
+        text[length++] = digits[digit];
+    }
+    if (task == 3) {
+        text[length++] = '.';
+    }
+    text[length] = '\0';
+    return true;
+}
+
+int DiagWriteJson(diag_t self, char * buffer, size_t size) {
+    int total;
+
+    if (!self || !buffer || size == 0) {
+        return -1;
+    }
+    total = snprintf(buffer, size, "{\"tasks\":[");
+    for (uint8_t task = 0; task < self->count; task++) {
+        const diag_task_t * stats = &self->tasks[task];
+        size_t used = JsonOffset(total, size);
+
+        total += snprintf(buffer + used, size - used,
+                          "%s{\"name\":\"%s\",\"cpu\":%u,\"stack_free\":%lu,\"loop_max\":%lu}", task ? "," : "",
+                          self->names[task], (unsigned)stats->cpu, (unsigned long)stats->stack_free,
+                          (unsigned long)stats->loop_max);
+    }
+    size_t used = JsonOffset(total, size);
+    total += snprintf(buffer + used, size - used, "],\"heap_free_min\":%lu}", (unsigned long)self->heap_free);
+    return total;
+}
+
+/* === Private function definitions ================================================================================ */
+
+static size_t JsonOffset(int total, size_t size) {
+    return ((size_t)total < size) ? (size_t)total : size - 1;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -25,17 +25,43 @@ SPDX-License-Identifier: MIT
 
 #include "chip.h"
 #include "digital.h"
+#include "pool.h"
+#include "probe.h"
 #include <stdbool.h>
 #include <stdlib.h>
 
 /* === Macros definitions ========================================================================================== */
 
+//! Cantidad de puertos GPIO del LPC43xx
+#define DIGITAL_PORTS 8
+
+//! Cantidad de salidas, grupos y entradas que se pueden crear con STATIC_ALLOCATION
+#ifndef DIGITAL_OUTPUTS_POOL
+#define DIGITAL_OUTPUTS_POOL 1
+#endif
+#ifndef DIGITAL_GROUPS_POOL
+#define DIGITAL_GROUPS_POOL 1
+#endif
+#ifndef DIGITAL_INPUTS_POOL
+#define DIGITAL_INPUTS_POOL 6
+#endif
+
 /* === Private data type declarations ============================================================================== */
 
 //! Estructura que representa una salida digital
 struct digital_output_s {
-    uint8_t port; //!< Puerto de la salida digital
-    uint8_t pin;  //!< Pin de la salida digital
+    uint8_t port;  //!< Puerto de la salida digital
+    uint8_t pin;   //!< Pin de la salida digital
+    bool inverted; //!< Indica si la salida se activa con nivel bajo
+    bool active;   //!< Ultimo estado escrito en la salida
+};
+
+//! Estructura que representa un grupo de salidas de un mismo puerto
+struct digital_output_group_s {
+    uint8_t port;                                 //!< Puerto comun a todas las salidas
+    uint8_t count;                                //!< Cantidad de salidas del grupo
+    uint32_t inverted;                            //!< Pines del puerto que se activan con nivel bajo
+    digital_output_t outputs[DIGITAL_GROUP_MAX];  //!< Salidas del grupo, en el orden de sus bits
 };
 
 //! Estructura que representa una entrada digital
@@ -48,18 +74,41 @@ struct digital_input_s {
 
 /* === Private function declarations =============================================================================== */
 
+/**
+ * @brief Escribe el nivel del pin que corresponde a un estado de la salida y lo recuerda
+ *
+ * @param self Puntero a la salida digital
+ * @param active Estado a escribir
+ */
+static void DigitalOutputWrite(digital_output_t self, bool active);
+
+/**
+ * @brief Escribe de una vez los pines de un puerto indicados en una mascara
+ *
+ * @param port Puerto a escribir
+ * @param pins Pines a escribir
+ * @param levels Nivel de cada pin
+ */
+static void DigitalPortWrite(uint8_t port, uint32_t pins, uint32_t levels);
+
 /* === Private variable definitions ================================================================================ */
 
+//! Objetos de las salidas, los grupos y las entradas
+POOL_DECLARE(struct digital_output_s, output_pool, DIGITAL_OUTPUTS_POOL)
+POOL_DECLARE(struct digital_output_group_s, group_pool, DIGITAL_GROUPS_POOL)
+POOL_DECLARE(struct digital_input_s, input_pool, DIGITAL_INPUTS_POOL)
+
 /* === Public variable definitions ================================================================================= */
 
 /* === Public function definitions ============================================================================== */
 
-digital_output_t DigitalOutputCreate(uint8_t port, uint8_t pin) {
-    digital_output_t self = malloc(sizeof(struct digital_output_s));
+digital_output_t DigitalOutputCreate(uint8_t port, uint8_t pin, bool inverted) {
+    digital_output_t self = POOL_ALLOC(struct digital_output_s, output_pool);
     if (self != NULL) {
         self->port = port;
         self->pin = pin;
-        Chip_GPIO_SetPinState(LPC_GPIO_PORT, self->port, self->pin, false);
+        self->inverted = inverted;
+        DigitalOutputWrite(self, false);
         Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, self->port, self->pin, true);
     }
 
@@ -67,19 +116,128 @@ digital_output_t DigitalOutputCreate(uint8_t port, uint8_t pin) {
 }
 
 void DigitalOutputActivate(digital_output_t self) {
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, self->port, self->pin, true);
+    if (!self->active) {
+        DigitalOutputWrite(self, true);
+    }
 }
 
 void DigitalOutputDeactivate(digital_output_t self) {
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, self->port, self->pin, false);
+    if (self->active) {
+        DigitalOutputWrite(self, false);
+    }
 }
 
 void DigitalOutputToggle(digital_output_t self) {
-    Chip_GPIO_SetPinToggle(LPC_GPIO_PORT, self->port, self->pin);
+    DigitalOutputWrite(self, !self->active);
+}
+
+bool DigitalOutputGetIsActive(digital_output_t self) {
+    return self->active;
+}
+
+digital_output_group_t DigitalOutputGroupCreate(const digital_output_t outputs[], uint8_t count) {
+    digital_output_group_t self = NULL;
+
+    if (outputs == NULL || count == 0 || count > DIGITAL_GROUP_MAX) {
+        return NULL;
+    }
+    for (uint8_t i = 0; i < count; i++) {
+        if (outputs[i] == NULL || outputs[i]->port != outputs[0]->port) {
+            return NULL;
+        }
+    }
+    self = POOL_ALLOC(struct digital_output_group_s, group_pool);
+    if (self != NULL) {
+        self->port = outputs[0]->port;
+        self->count = count;
+        self->inverted = 0;
+        for (uint8_t i = 0; i < count; i++) {
+            self->outputs[i] = outputs[i];
+            if (outputs[i]->inverted) {
+                self->inverted |= 1u << outputs[i]->pin;
+            }
+        }
+    }
+    return self;
+}
+
+void DigitalOutputGroupWrite(digital_output_group_t self, uint32_t members, uint32_t states) {
+    uint32_t pins = 0;
+    uint32_t levels = 0;
+    digital_output_t output;
+    bool active;
+
+    for (uint8_t i = 0; i < self->count && members != 0; i++, members >>= 1, states >>= 1) {
+        output = self->outputs[i];
+        active = (states & 1u) != 0;
+        if ((members & 1u) && output->active != active) {
+            output->active = active;
+            pins |= 1u << output->pin;
+            if (active) {
+                levels |= 1u << output->pin;
+            }
+        }
+    }
+    if (pins != 0) {
+        DigitalPortWrite(self->port, pins, levels ^ self->inverted);
+    }
+}
+
+void DigitalOutputGroupActivate(digital_output_group_t self, uint32_t members) {
+    DigitalOutputGroupWrite(self, members, members);
+}
+
+void DigitalOutputGroupDeactivate(digital_output_group_t self, uint32_t members) {
+    DigitalOutputGroupWrite(self, members, 0);
+}
+
+void DigitalBatchInit(digital_batch_t * batch) {
+    batch->count = 0;
+}
+
+bool DigitalBatchWrite(digital_batch_t * batch, digital_output_t output, bool active) {
+    if (batch == NULL || output == NULL || output->port >= DIGITAL_PORTS || batch->count >= DIGITAL_BATCH_MAX) {
+        return false;
+    }
+    batch->outputs[batch->count] = output;
+    batch->states[batch->count] = active;
+    batch->count++;
+    return true;
+}
+
+uint8_t DigitalBatchCommit(digital_batch_t * batch) {
+    uint32_t pins[DIGITAL_PORTS] = {0};
+    uint32_t levels[DIGITAL_PORTS] = {0};
+    digital_output_t output;
+    uint32_t bit;
+    uint8_t written = 0;
+
+    for (uint8_t i = 0; i < batch->count; i++) {
+        output = batch->outputs[i];
+        if (output->active == batch->states[i]) {
+            continue;
+        }
+        output->active = batch->states[i];
+        bit = 1u << output->pin;
+        pins[output->port] |= bit;
+        if (output->active != output->inverted) {
+            levels[output->port] |= bit;
+        } else {
+            levels[output->port] &= ~bit;
+        }
+    }
+    for (uint8_t port = 0; port < DIGITAL_PORTS; port++) {
+        if (pins[port] != 0) {
+            DigitalPortWrite(port, pins[port], levels[port]);
+            written++;
+        }
+    }
+    batch->count = 0;
+    return written;
 }
 
 digital_input_t DigitalInputCreate(uint8_t port, uint8_t pin, bool inverted) {
-    digital_input_t self = malloc(sizeof(struct digital_input_s));
+    digital_input_t self = POOL_ALLOC(struct digital_input_s, input_pool);
     if (self != NULL) {
         self->port = port;
         self->pin = pin;
@@ -108,6 +266,7 @@ bool DigitalWasInactive(digital_input_t self) {
 }
 
 digital_states_t DigitalWasChanged(digital_input_t self) {
+    PROBE_BEGIN(PROBE_DIGITAL_CHANGED);
     digital_states_t result = DIGITAL_INPUT_NO_CHANGE;
 
     bool state = DigitalInputGetIsActive(self);
@@ -118,9 +277,26 @@ digital_states_t DigitalWasChanged(digital_input_t self) {
         result = DIGITAL_INPUT_WAS_DEACTIVATED;
     }
     self->lastState = state;
+    PROBE_END(PROBE_DIGITAL_CHANGED);
     return result;
 }
 
 /* === Private function definitions ================================================================================ */
 
+static void DigitalOutputWrite(digital_output_t self, bool active) {
+    self->active = active;
+    Chip_GPIO_SetPinState(LPC_GPIO_PORT, self->port, self->pin, active != self->inverted);
+}
+
+static void DigitalPortWrite(uint8_t port, uint32_t pins, uint32_t levels) {
+    /* Con la mascara solo los pines pedidos responden a MPIN, y todos cambian con la misma escritura. Las
+     * interrupciones que escriben el mismo puerto no pueden intercalarse mientras MASK esta programado, y al salir
+     * queda en 0 para que los otros accesos por MPIN vean todos los pines */
+    __disable_irq();
+    Chip_GPIO_SetPortMask(LPC_GPIO_PORT, port, ~pins);
+    Chip_GPIO_SetMaskedPortValue(LPC_GPIO_PORT, port, levels & pins);
+    Chip_GPIO_SetPortMask(LPC_GPIO_PORT, port, 0);
+    __enable_irq();
+}
+
 /* === End of documentation ======================================================================================== */
@@ -0,0 +1,187 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Martin Nicolas Soria <soria.m.nicolas@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, disponiblestribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file hd44780.c
+ ** @brief Adaptador de la pantalla de 7 segmentos a un LCD de caracteres HD44780
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "hd44780.h"
+#include "screen.h"
+#include "pool.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! Cantidad de pantallas LCD que se pueden crear con STATIC_ALLOCATION
+#ifndef HD44780_POOL
+#define HD44780_POOL 1
+#endif
+
+//! Instruccion que borra la pantalla y lleva el cursor al inicio
+#define COMMAND_CLEAR 0x01
+//! Instruccion de modo de entrada con incremento automatico del cursor
+#define COMMAND_ENTRY_INCREMENT 0x06
+//! Instruccion que apaga la pantalla sin perder el contenido
+#define COMMAND_DISPLAY_OFF 0x08
+//! Instruccion que enciende la pantalla sin cursor visible
+#define COMMAND_DISPLAY_ON 0x0C
+//! Instruccion de configuracion: bus de 4 bits, dos lineas, caracteres de 5x8
+#define COMMAND_FUNCTION_SET 0x28
+//! Instruccion que posiciona el cursor en una direccion de la DDRAM
+#define COMMAND_SET_ADDRESS 0x80
+
+//! Caracter que se muestra para segmentos que no corresponden a ningun caracter
+#define CHARACTER_UNKNOWN '*'
+
+//! Caracteres con prioridad cuando varios comparten el mismo glifo
+#define PREFERRED_CHARACTERS "0123456789AbCdEF-_ hnortu"
+
+/* === Private data type declarations ============================================================================== */
+
+//! Estructura que representa un adaptador
+struct hd44780_s {
+    uint8_t digits;                  //!< Cantidad de digitos de la pantalla
+    uint8_t cells;                   //!< Cantidad de celdas usadas en el LCD
+    uint8_t cursor;                  //!< Posicion actual del cursor del LCD
+    bool display_on;                 //!< Indica si la pantalla esta encendida
+    hd44780_bus_t bus;               //!< Funcion para realizar transacciones
+    uint32_t transactions;           //!< Transacciones realizadas
+    char shadow[HD44780_MAX_CELLS];  //!< Copia de lo que muestra el LCD
+    char characters[SEGMENT_P];      //!< Caracter que corresponde a cada combinacion de segmentos sin el punto
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Construye la tabla inversa de glifos a caracteres a partir de la fuente de la pantalla
+ *
+ * @param self Adaptador
+ */
+static void Hd44780BuildCharacters(hd44780_t self);
+
+/**
+ * @brief Realiza una transaccion con el LCD y la cuenta
+ *
+ * @param self Adaptador
+ * @param data true para un dato, false para una instruccion
+ * @param value Byte a escribir
+ */
+static void Hd44780Send(hd44780_t self, bool data, uint8_t value);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Objetos de las pantallas LCD
+POOL_DECLARE(struct hd44780_s, lcd_pool, HD44780_POOL)
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Public function definitions ================================================================================= */
+
+hd44780_t Hd44780Create(uint8_t digits, hd44780_bus_t bus) {
+    hd44780_t self = NULL;
+
+    if (digits == 0 || digits > HD44780_MAX_DIGITS || bus == NULL) {
+        return NULL;
+    }
+    self = POOL_ALLOC(struct hd44780_s, lcd_pool);
+    if (self != NULL) {
+        memset(self, 0, sizeof(struct hd44780_s));
+        self->digits = digits;
+        self->cells = 2 * digits;
+        self->bus = bus;
+        memset(self->shadow, ' ', sizeof(self->shadow));
+        Hd44780BuildCharacters(self);
+
+        Hd44780Send(self, false, COMMAND_FUNCTION_SET);
+        Hd44780Send(self, false, COMMAND_DISPLAY_ON);
+        Hd44780Send(self, false, COMMAND_CLEAR);
+        Hd44780Send(self, false, COMMAND_ENTRY_INCREMENT);
+        self->display_on = true;
+        self->cursor = 0;
+    }
+    return self;
+}
+
+void Hd44780WriteFrame(hd44780_t self, const uint8_t segments[], uint8_t digits, uint8_t brightness) {
+    char wanted[HD44780_MAX_CELLS];
+
+    if (digits > self->digits) {
+        digits = self->digits;
+    }
+    memcpy(wanted, self->shadow, sizeof(wanted));
+    for (uint8_t i = 0; i < digits; i++) {
+        wanted[2 * i] = self->characters[segments[i] & ~SEGMENT_P];
+        wanted[2 * i + 1] = (segments[i] & SEGMENT_P) ? '.' : ' ';
+    }
+
+    if ((brightness != 0) != self->display_on) {
+        self->display_on = (brightness != 0);
+        Hd44780Send(self, false, self->display_on ? COMMAND_DISPLAY_ON : COMMAND_DISPLAY_OFF);
+    }
+    for (uint8_t cell = 0; cell < self->cells; cell++) {
+        if (wanted[cell] == self->shadow[cell]) {
+            continue;
+        }
+        /* Las celdas consecutivas aprovechan el incremento automatico y no necesitan mover el cursor */
+        if (self->cursor != cell) {
+            Hd44780Send(self, false, COMMAND_SET_ADDRESS | cell);
+            self->cursor = cell;
+        }
+        Hd44780Send(self, true, (uint8_t)wanted[cell]);
+        self->shadow[cell] = wanted[cell];
+        self->cursor++;
+    }
+}
+
+uint32_t Hd44780GetTransactions(hd44780_t self) {
+    return self->transactions;
+}
+
+/* === Private function definitions ================================================================================ */
+
+static void Hd44780BuildCharacters(hd44780_t self) {
+    const char * preferred = PREFERRED_CHARACTERS;
+    uint8_t glyph;
+
+    memset(self->characters, 0, sizeof(self->characters));
+    for (; *preferred != '\0'; preferred++) {
+        self->characters[ScreenCharToSegments(*preferred)] = *preferred;
+    }
+    for (char character = ' '; character <= '~'; character++) {
+        glyph = ScreenCharToSegments(character);
+        if (glyph != SCREEN_GLYPH_INVALID && self->characters[glyph] == 0) {
+            self->characters[glyph] = character;
+        }
+    }
+    for (uint8_t i = 0; i < sizeof(self->characters); i++) {
+        if (self->characters[i] == 0) {
+            self->characters[i] = CHARACTER_UNKNOWN;
+        }
+    }
+}
+
+static void Hd44780Send(hd44780_t self, bool data, uint8_t value) {
+    self->bus(data, value);
+    self->transactions++;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -42,6 +42,7 @@
 
 #include "app.h"
 #include "bsp.h"
+#include "cyclic.h"
 
 #include "FreeRTOS.h"
 #include "task.h"
@@ -52,6 +53,51 @@
 
 /* === Private function declarations =============================================================================== */
 
+#if APP_CYCLIC_EXECUTIVE
+/**
+ * @brief Trabajo de la interfaz con la firma del ejecutivo; el resultado solo lo usa la tarea para bloquearse
+ */
+static void JobUIFrame(void);
+
+/**
+ * @brief Marca el comienzo de un marco menor, desde la interrupcion de TIMER2
+ */
+static void FrameTick(void);
+#endif
+
+/* === Private variable definitions ================================================================================ */
+
+#if APP_CYCLIC_EXECUTIVE
+/* Trabajos en el orden de sus bits APP_JOB_* en la tabla de app_schedule.h */
+static const cyclic_job_t JOBS[] = {JobClock, JobButtons, JobUIFrame};
+
+static const uint32_t FRAMES[APP_FRAME_COUNT] = APP_FRAMES;
+
+static const cyclic_schedule_t SCHEDULE = {
+    .jobs = JOBS,
+    .job_count = sizeof(JOBS) / sizeof(JOBS[0]),
+    .frames = FRAMES,
+    .frame_count = sizeof(FRAMES) / sizeof(FRAMES[0]),
+};
+
+static cyclic_t executive;
+#elif STATIC_ALLOCATION
+/* Pilas y bloques de control de las tareas; los nombres terminados en _stack los lista el informe de RAM */
+static StackType_t clock_stack[APP_CLOCK_STACK];
+static StackType_t buttons_stack[APP_BUTTONS_STACK];
+static StackType_t ui_stack[APP_UI_STACK];
+static StaticTask_t clock_task;
+static StaticTask_t buttons_task;
+static StaticTask_t ui_task;
+#endif
+
+#if STATIC_ALLOCATION
+/* El kernel se compila con asignacion estatica tambien en el ejecutivo ciclico y pide la tarea ociosa aunque el
+ * planificador no arranque */
+static StackType_t idle_stack[configMINIMAL_STACK_SIZE];
+static StaticTask_t idle_task;
+#endif
+
 /* === Public variable definitions ================================================================================= */
 
 /* === Public function definitions ================================================================================= */
@@ -59,18 +105,73 @@
 int main(void) {
     board_t board = AppInit();
 
+#if APP_CYCLIC_EXECUTIVE
+    (void)board;
+    executive = CyclicCreate(&SCHEDULE);
+    configASSERT(executive != NULL);
+    board_frame_timer(APP_CLOCK_PERIOD_MS * 1000, FrameTick);
+
+    for (;;) {
+        /* Con las interrupciones enmascaradas WFI despierta igual con la del marco, y una que llegue entre la
+         * consulta y WFI queda pendiente en lugar de perderse hasta el marco siguiente */
+        __disable_irq();
+        if (!CyclicIsPending(executive)) {
+            __WFI();
+        }
+        __enable_irq();
+        while (CyclicRunPending(executive)) {
+        }
+    }
+#else
     /* Crear tareas */
-    xTaskCreate(TaskClock,   "clk",   256, board, tskIDLE_PRIORITY + 3, NULL);
-    xTaskCreate(TaskButtons, "keys",  256, board, tskIDLE_PRIORITY + 2, NULL);
-    xTaskCreate(TaskUI,      "ui",    512, board, tskIDLE_PRIORITY + 1, NULL);
+#if STATIC_ALLOCATION
+    TaskHandle_t clock_handle = xTaskCreateStatic(TaskClock, "clk", APP_CLOCK_STACK, board, tskIDLE_PRIORITY + 3,
+                                                  clock_stack, &clock_task);
+    TaskHandle_t buttons_handle = xTaskCreateStatic(TaskButtons, "keys", APP_BUTTONS_STACK, board,
+                                                    tskIDLE_PRIORITY + 2, buttons_stack, &buttons_task);
+    TaskHandle_t ui_handle =
+        xTaskCreateStatic(TaskUI, "ui", APP_UI_STACK, board, tskIDLE_PRIORITY + 1, ui_stack, &ui_task);
+    configASSERT(clock_handle != NULL && buttons_handle != NULL && ui_handle != NULL);
+#else
+    BaseType_t clock_created = xTaskCreate(TaskClock, "clk", APP_CLOCK_STACK, board, tskIDLE_PRIORITY + 3, NULL);
+    BaseType_t buttons_created =
+        xTaskCreate(TaskButtons, "keys", APP_BUTTONS_STACK, board, tskIDLE_PRIORITY + 2, NULL);
+    BaseType_t ui_created = xTaskCreate(TaskUI, "ui", APP_UI_STACK, board, tskIDLE_PRIORITY + 1, NULL);
+    configASSERT(clock_created == pdPASS && buttons_created == pdPASS && ui_created == pdPASS);
+#endif
 
     vTaskStartScheduler();
 
     while (1) { /* debería no llegar aquí */ }
+#endif
+}
+
+#if STATIC_ALLOCATION
+/* Con asignacion estatica el kernel pide a la aplicacion la memoria de su tarea ociosa */
+void vApplicationGetIdleTaskMemory(StaticTask_t ** task, StackType_t ** stack, uint32_t * size) {
+    *task = &idle_task;
+    *stack = idle_stack;
+    *size = configMINIMAL_STACK_SIZE;
 }
 
+/* El heap minimo no alcanza para nada: una llamada a pvPortMalloc en este modo es un error de programacion */
+void vApplicationMallocFailedHook(void) {
+    configASSERT(0);
+}
+#endif
+
 /* === Private function definitions ================================================================================ */
 
+#if APP_CYCLIC_EXECUTIVE
+static void JobUIFrame(void) {
+    (void)JobUI();
+}
+
+static void FrameTick(void) {
+    CyclicTick(executive);
+}
+#endif
+
 /* === End of documentation ==================================================================== */
 
 /** @} End of module definition for doxygen */
@@ -0,0 +1,183 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Martin Nicolas Soria <soria.m.nicolas@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, disponiblestribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file max7219.c
+ ** @brief Codificador de cuadros para controladores de pantalla MAX7219
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "max7219.h"
+#include "screen.h"
+#include "pool.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! Cantidad de controladores que se pueden crear con STATIC_ALLOCATION
+#ifndef MAX7219_POOL
+#define MAX7219_POOL 1
+#endif
+
+//! Direccion del registro del primer digito; los siguientes son consecutivos
+#define REGISTER_DIGIT_0 0x01
+//! Registro de modo de decodificacion BCD
+#define REGISTER_DECODE_MODE 0x09
+//! Registro de intensidad, de 0 a 15
+#define REGISTER_INTENSITY 0x0A
+//! Registro con la cantidad de digitos barridos menos uno
+#define REGISTER_SCAN_LIMIT 0x0B
+//! Registro de apagado, 1 para funcionamiento normal
+#define REGISTER_SHUTDOWN 0x0C
+//! Registro de prueba de pantalla
+#define REGISTER_DISPLAY_TEST 0x0F
+
+//! Palabra del bus con la direccion en el byte alto y el dato en el bajo
+#define WORD(address, data) ((uint16_t)(((address) << 8) | (data)))
+
+//! Nivel de brillo del controlador apagado
+#define BRIGHTNESS_OFF 0
+
+/* === Private data type declarations ============================================================================== */
+
+//! Estructura que representa un codificador
+struct max7219_s {
+    uint8_t digits;                      //!< Cantidad de digitos conectados
+    max7219_bus_t bus;                   //!< Funcion para enviar palabras por el bus
+    uint8_t shown[MAX7219_MAX_DIGITS];   //!< Ultimos segmentos enviados, en el formato del controlador
+    uint8_t brightness;                  //!< Ultimo nivel de brillo enviado
+    uint32_t bytes;                      //!< Bytes enviados por el bus
+    uint16_t words[MAX7219_MAX_WORDS];   //!< Buffer de transmision
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Convierte segmentos de screen.h al orden de bits del MAX7219 sin decodificacion (DP A B C D E F G)
+ *
+ * @param segments Segmentos con las macros SEGMENT_x
+ * @return uint8_t Segmentos en el formato del controlador
+ */
+static uint8_t Max7219Encode(uint8_t segments);
+
+/**
+ * @brief Envia las palabras cargadas en el buffer y las suma al contador de bytes
+ *
+ * @param self Codificador
+ * @param count Cantidad de palabras a enviar
+ */
+static void Max7219Send(max7219_t self, uint8_t count);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Objetos de los controladores
+POOL_DECLARE(struct max7219_s, chip_pool, MAX7219_POOL)
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Public function definitions ================================================================================= */
+
+max7219_t Max7219Create(uint8_t digits, max7219_bus_t bus) {
+    max7219_t self = NULL;
+    uint8_t count = 0;
+
+    if (digits == 0 || digits > MAX7219_MAX_DIGITS || bus == NULL) {
+        return NULL;
+    }
+    self = POOL_ALLOC(struct max7219_s, chip_pool);
+    if (self != NULL) {
+        memset(self, 0, sizeof(struct max7219_s));
+        self->digits = digits;
+        self->bus = bus;
+        self->brightness = SCREEN_BRIGHTNESS_MAX;
+
+        self->words[count++] = WORD(REGISTER_DISPLAY_TEST, 0);
+        self->words[count++] = WORD(REGISTER_DECODE_MODE, 0);
+        self->words[count++] = WORD(REGISTER_SCAN_LIMIT, digits - 1);
+        self->words[count++] = WORD(REGISTER_INTENSITY, SCREEN_BRIGHTNESS_MAX);
+        self->words[count++] = WORD(REGISTER_SHUTDOWN, 1);
+        Max7219Send(self, count);
+
+        count = 0;
+        for (uint8_t i = 0; i < digits; i++) {
+            self->words[count++] = WORD(REGISTER_DIGIT_0 + i, 0);
+        }
+        Max7219Send(self, count);
+    }
+    return self;
+}
+
+void Max7219WriteFrame(max7219_t self, const uint8_t segments[], uint8_t digits, uint8_t brightness) {
+    uint8_t count = 0;
+    uint8_t encoded;
+
+    if (digits > self->digits) {
+        digits = self->digits;
+    }
+    if (brightness > SCREEN_BRIGHTNESS_MAX) {
+        brightness = SCREEN_BRIGHTNESS_MAX;
+    }
+
+    if (brightness != self->brightness) {
+        if (brightness == BRIGHTNESS_OFF) {
+            self->words[count++] = WORD(REGISTER_SHUTDOWN, 0);
+        } else {
+            if (self->brightness == BRIGHTNESS_OFF) {
+                self->words[count++] = WORD(REGISTER_SHUTDOWN, 1);
+            }
+            self->words[count++] = WORD(REGISTER_INTENSITY, brightness);
+        }
+        self->brightness = brightness;
+    }
+    for (uint8_t i = 0; i < digits; i++) {
+        encoded = Max7219Encode(segments[i]);
+        if (encoded != self->shown[i]) {
+            self->shown[i] = encoded;
+            self->words[count++] = WORD(REGISTER_DIGIT_0 + i, encoded);
+        }
+    }
+    if (count) {
+        Max7219Send(self, count);
+    }
+}
+
+uint32_t Max7219GetBytesSent(max7219_t self) {
+    return self->bytes;
+}
+
+/* === Private function definitions ================================================================================ */
+
+static uint8_t Max7219Encode(uint8_t segments) {
+    uint8_t result = segments & SEGMENT_P;
+
+    for (uint8_t bit = 0; bit < 7; bit++) {
+        if (segments & (1 << bit)) {
+            result |= (uint8_t)(1 << (6 - bit));
+        }
+    }
+    return result;
+}
+
+static void Max7219Send(max7219_t self, uint8_t count) {
+    self->bus(self->words, count);
+    self->bytes += count * sizeof(uint16_t);
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,131 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Martin Nicolas Soria <soria.m.nicolas@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, disponiblestribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file pattern.c
+ ** @brief Reproductor de secuencias de encendido para salidas digitales
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "pattern.h"
+#include "pool.h"
+#include <stdlib.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! Cantidad de reproductores que se pueden crear con STATIC_ALLOCATION
+#ifndef PATTERN_PLAYERS_POOL
+#define PATTERN_PLAYERS_POOL 1
+#endif
+
+//! Unidad del codigo Morse de la secuencia SOS, en milisegundos
+#define MORSE_UNIT 150
+
+//! Punto seguido de la separacion entre simbolos
+#define MORSE_DOT MORSE_UNIT, MORSE_UNIT
+//! Raya seguida de la separacion entre simbolos
+#define MORSE_DASH (3 * MORSE_UNIT), MORSE_UNIT
+
+/* === Private data type declarations ============================================================================== */
+
+//! Estructura que representa un reproductor
+struct pattern_player_s {
+    digital_output_t output;   //!< Salida controlada
+    const pattern_t * pattern; //!< Secuencia en reproduccion, NULL si esta detenido
+    uint8_t step;              //!< Paso actual de la secuencia
+};
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+
+//! Objetos de los reproductores
+POOL_DECLARE(struct pattern_player_s, player_pool, PATTERN_PLAYERS_POOL)
+
+static const uint16_t BLINK_DURATIONS[] = {500, 500};
+
+static const uint16_t PULSE_DURATIONS[] = {100, 900};
+
+/* La ultima separacion de cada letra se alarga a 3 unidades, y la de la palabra a 7 */
+static const uint16_t SOS_DURATIONS[] = {
+    MORSE_DOT,  MORSE_DOT,  MORSE_UNIT,       3 * MORSE_UNIT,
+    MORSE_DASH, MORSE_DASH, 3 * MORSE_UNIT,   3 * MORSE_UNIT,
+    MORSE_DOT,  MORSE_DOT,  MORSE_UNIT,       7 * MORSE_UNIT,
+};
+
+/* === Public variable definitions ================================================================================= */
+
+const pattern_t PATTERN_BLINK = {BLINK_DURATIONS, sizeof(BLINK_DURATIONS) / sizeof(BLINK_DURATIONS[0])};
+
+const pattern_t PATTERN_PULSE = {PULSE_DURATIONS, sizeof(PULSE_DURATIONS) / sizeof(PULSE_DURATIONS[0])};
+
+const pattern_t PATTERN_SOS = {SOS_DURATIONS, sizeof(SOS_DURATIONS) / sizeof(SOS_DURATIONS[0])};
+
+/* === Public function definitions ================================================================================= */
+
+pattern_player_t PatternPlayerCreate(digital_output_t output) {
+    pattern_player_t self = NULL;
+
+    if (output != NULL) {
+        self = POOL_ALLOC(struct pattern_player_s, player_pool);
+    }
+    if (self != NULL) {
+        self->output = output;
+        self->pattern = NULL;
+        self->step = 0;
+    }
+    return self;
+}
+
+uint32_t PatternPlay(pattern_player_t self, const pattern_t * pattern) {
+    if (!self) {
+        return 0;
+    }
+    self->pattern = pattern;
+    self->step = 0;
+    if (!pattern || pattern->length == 0) {
+        self->pattern = NULL;
+        DigitalOutputDeactivate(self->output);
+        return 0;
+    }
+    DigitalOutputActivate(self->output);
+    return pattern->durations[0];
+}
+
+uint32_t PatternAdvance(pattern_player_t self) {
+    if (!self || !self->pattern) {
+        return 0;
+    }
+    self->step++;
+    if (self->step >= self->pattern->length) {
+        self->step = 0;
+    }
+    /* Los pasos pares activan la salida y los impares la desactivan */
+    if (self->step & 1) {
+        DigitalOutputDeactivate(self->output);
+    } else {
+        DigitalOutputActivate(self->output);
+    }
+    return self->pattern->durations[self->step];
+}
+
+/* === Private function definitions ================================================================================ */
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,206 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Martin Nicolas Soria <soria.m.nicolas@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, disponiblestribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file probe.c
+ ** @brief Tabla de mediciones de las sondas de los caminos criticos
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+/* clock_gettime necesita POSIX en el host, y debe pedirse antes del primer encabezado del sistema */
+#if !defined(__ARM_ARCH_7EM__) && !defined(__ARM_ARCH_7M__) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 199309L
+#endif
+
+#include "probe.h"
+#include <stddef.h>
+#include <string.h>
+#if !PROBE_TARGET
+#include <time.h>
+#endif
+
+#if PROBE_ENABLED
+
+/* === Macros definitions ========================================================================================== */
+
+//! Intervalos en que se parte cada potencia de dos del histograma
+#define SUB_BINS 4
+
+#if PROBE_TARGET
+//! Registros del Cortex-M4 que habilitan el contador de ciclos: DEMCR.TRCENA y DWT_CTRL.CYCCNTENA
+#define DEMCR              (*(volatile uint32_t *)0xE000EDFCUL)
+#define DWT_CTRL           (*(volatile uint32_t *)0xE0001000UL)
+#define DWT_CYCCNT         (*(volatile uint32_t *)0xE0001004UL)
+#define DEMCR_TRCENA       (1UL << 24)
+#define DWT_CTRL_CYCCNTENA (1UL << 0)
+#endif
+
+/* === Private data type declarations ============================================================================== */
+
+//! Mediciones acumuladas de una sonda
+typedef struct probe_s {
+    uint32_t count;            //!< Mediciones registradas
+    uint32_t min;              //!< Medicion minima
+    uint32_t max;              //!< Medicion maxima
+    uint64_t total;            //!< Suma de las mediciones, para el promedio
+    uint32_t bins[PROBE_BINS]; //!< Histograma de las mediciones
+} probe_t;
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Devuelve el intervalo del histograma de una medicion
+ *
+ * Los valores menores a SUB_BINS tienen un intervalo cada uno; despues cada potencia de dos se parte en SUB_BINS
+ * intervalos iguales.
+ */
+static uint8_t ProbeBin(uint32_t elapsed);
+
+/**
+ * @brief Devuelve el valor mas grande que cae en un intervalo del histograma
+ */
+static uint32_t ProbeBinLimit(uint8_t bin);
+
+/**
+ * @brief Calcula un percentil de una sonda como el limite de su intervalo, sin pasar la medicion maxima
+ *
+ * @param probe Sonda con mediciones
+ * @param percent Percentil, de 1 a 100
+ */
+static uint32_t ProbePercentile(const probe_t * probe, uint8_t percent);
+
+/* === Private variable definitions ================================================================================ */
+
+static const char * const NAMES[PROBE_COUNT] = {"clock_tick", "screen_refresh", "ui_render", "digital_changed"};
+
+//! Tabla de mediciones de todas las sondas
+static probe_t probes[PROBE_COUNT];
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Public function definitions ================================================================================= */
+
+void ProbeCounterStart(void) {
+#if PROBE_TARGET
+    DEMCR |= DEMCR_TRCENA;
+    DWT_CYCCNT = 0;
+    DWT_CTRL |= DWT_CTRL_CYCCNTENA;
+#endif
+}
+
+uint32_t ProbeHostCounter(void) {
+#if PROBE_TARGET
+    return 0;
+#else
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)((uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec);
+#endif
+}
+
+void ProbeRecord(probe_id_t probe, uint32_t elapsed) {
+    probe_t * self;
+
+    if ((unsigned)probe >= PROBE_COUNT) {
+        return;
+    }
+    self = &probes[probe];
+    if (self->count == 0 || elapsed < self->min) {
+        self->min = elapsed;
+    }
+    if (elapsed > self->max) {
+        self->max = elapsed;
+    }
+    self->total += elapsed;
+    self->count++;
+    self->bins[ProbeBin(elapsed)]++;
+}
+
+bool ProbeGetStats(probe_id_t probe, probe_stats_t * stats) {
+    const probe_t * self;
+
+    if ((unsigned)probe >= PROBE_COUNT || !stats) {
+        return false;
+    }
+    self = &probes[probe];
+    memset(stats, 0, sizeof(*stats));
+    if (self->count == 0) {
+        return false;
+    }
+    stats->count = self->count;
+    stats->min = self->min;
+    stats->max = self->max;
+    stats->mean = (uint32_t)(self->total / self->count);
+    stats->p50 = ProbePercentile(self, 50);
+    stats->p90 = ProbePercentile(self, 90);
+    stats->p99 = ProbePercentile(self, 99);
+    return true;
+}
+
+const char * ProbeName(probe_id_t probe) {
+    return ((unsigned)probe < PROBE_COUNT) ? NAMES[probe] : NULL;
+}
+
+void ProbeReset(void) {
+    memset(probes, 0, sizeof(probes));
+}
+
+/* === Private function definitions ================================================================================ */
+
+static uint8_t ProbeBin(uint32_t elapsed) {
+    uint8_t exponent = 2;
+    uint32_t bin;
+
+    if (elapsed < SUB_BINS) {
+        return (uint8_t)elapsed;
+    }
+    while (exponent < 31 && (elapsed >> (exponent + 1)) != 0) {
+        exponent++;
+    }
+    bin = SUB_BINS * (exponent - 1U) + ((elapsed >> (exponent - 2)) & (SUB_BINS - 1));
+    return (uint8_t)(bin < PROBE_BINS ? bin : PROBE_BINS - 1);
+}
+
+static uint32_t ProbeBinLimit(uint8_t bin) {
+    if (bin < SUB_BINS) {
+        return bin;
+    }
+    return ((SUB_BINS + bin % SUB_BINS + 1UL) << (bin / SUB_BINS - 1)) - 1;
+}
+
+static uint32_t ProbePercentile(const probe_t * probe, uint8_t percent) {
+    uint32_t rank = (uint32_t)(((uint64_t)probe->count * percent + 99) / 100);
+    uint32_t seen = 0;
+    uint32_t limit = probe->max;
+
+    for (uint8_t bin = 0; bin < PROBE_BINS - 1; bin++) {
+        seen += probe->bins[bin];
+        if (seen >= rank) {
+            limit = ProbeBinLimit(bin);
+            break;
+        }
+    }
+    return limit < probe->max ? limit : probe->max;
+}
+
+#endif /* PROBE_ENABLED */
+
+/* === End of documentation ======================================================================================== */
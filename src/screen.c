@@ -24,53 +24,375 @@ SPDX-License-Identifier: MIT
 /* === Headers files inclusions ==================================================================================== */
 
 #include "screen.h"
+#include "pool.h"
+#include "probe.h"
 #include <string.h>
 #include <stdint.h>
 #include <stdlib.h>
 
 /* === Macros definitions ========================================================================================== */
 
+//! Cantidad de pantallas que se pueden crear con STATIC_ALLOCATION
+#ifndef SCREEN_POOL
+#define SCREEN_POOL 1
+#endif
+
 #ifndef SCREEN_MAX_DIGITS
 #define SCREEN_MAX_DIGITS 8
 #endif
 
+//! Fase en la que los digitos con SCREEN_ATTR_BLINK se apagan
+#define PHASE_DIGITS_OFF (1 << 0)
+
+//! Fase en la que los puntos con SCREEN_ATTR_POINT_BLINK se apagan
+#define PHASE_POINTS_OFF (1 << 1)
+
+//! Cantidad de cuadros precompuestos, uno por cada combinacion de fases de parpadeo
+#define SCREEN_PHASES 4
+
+//! Cantidad de buffers de cuadro: el que se muestra, el que se compone y el ultimo publicado
+#define SCREEN_BUFFERS 3
+
+//! Mascara del indice de buffer dentro del campo de intercambio
+#define BUFFER_INDEX 0x03
+
+//! Marca de cuadro publicado que todavia no fue tomado por el refresco
+#define BUFFER_FRESH 0x80
+
+//! Marca de entrada definida en la tabla ASCII; el punto nunca forma parte de un glifo
+#define GLYPH_DEFINED SEGMENT_P
+//! Declara una entrada definida de la tabla ASCII
+#define GLYPH(segments) ((segments) | GLYPH_DEFINED)
+
+//! Glifos compartidos entre la tabla BCD y la tabla ASCII
+#define GLYPH_0 (SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F)
+#define GLYPH_1 (SEGMENT_B | SEGMENT_C)
+#define GLYPH_2 (SEGMENT_A | SEGMENT_B | SEGMENT_D | SEGMENT_E | SEGMENT_G)
+#define GLYPH_3 (SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_G)
+#define GLYPH_4 (SEGMENT_B | SEGMENT_C | SEGMENT_F | SEGMENT_G)
+#define GLYPH_5 (SEGMENT_A | SEGMENT_C | SEGMENT_D | SEGMENT_F | SEGMENT_G)
+#define GLYPH_6 (SEGMENT_A | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G)
+#define GLYPH_7 (SEGMENT_A | SEGMENT_B | SEGMENT_C)
+#define GLYPH_8 (SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G)
+#define GLYPH_9 (SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_F | SEGMENT_G)
+#define GLYPH_A (SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_E | SEGMENT_F | SEGMENT_G)
+#define GLYPH_B (SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G)
+#define GLYPH_C (SEGMENT_A | SEGMENT_D | SEGMENT_E | SEGMENT_F)
+#define GLYPH_D (SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_G)
+#define GLYPH_E (SEGMENT_A | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G)
+#define GLYPH_F (SEGMENT_A | SEGMENT_E | SEGMENT_F | SEGMENT_G)
+
+//! Cantidad de cuadros intermedios reservados para una transicion
+#define SCREEN_TRANSITION_FRAMES 16
+
+//! Filas de un digito para la transicion de rodillo: A, F-B, G, E-C y D, alternando horizontales y verticales
+#define DIGIT_ROWS 5
+
+//! Filas de la columna que se desplaza en la transicion de rodillo: digito anterior, separacion y digito nuevo
+#define ROLL_ROWS (2 * DIGIT_ROWS + 1)
+
+//! Par de digitos decenas-unidades empaquetado en el orden en que se guardan en el cuadro
+#define PAIR(tens, units) ((uint16_t)((GLYPH_##tens) | ((GLYPH_##units) << 8)))
+//! Fila de pares con las mismas decenas y unidades de 0 a 9
+#define PAIR_ROW(tens)                                                                                                 \
+    { PAIR(tens, 0), PAIR(tens, 1), PAIR(tens, 2), PAIR(tens, 3), PAIR(tens, 4),                                       \
+      PAIR(tens, 5), PAIR(tens, 6), PAIR(tens, 7), PAIR(tens, 8), PAIR(tens, 9) }
+//! Par que se muestra para un valor de hora o minutos fuera de rango
+#define PAIR_INVALID ((uint16_t)(SCREEN_GLYPH_INVALID | (SCREEN_GLYPH_INVALID << 8)))
+
+//! Clave de la hora escrita cuando el cuadro no contiene una hora
+#define TIME_KEY_NONE 0xFFFFFFFFu
+
 /* === Private data type declarations ============================================================================== */
 
+//! Entrada de la tabla de subcuadros del refresco temporizado
+typedef struct screen_subframe_s {
+    uint8_t digit;     //!< Digito que se muestra en el subcuadro
+    uint8_t plane;     //!< Bit del nivel de brillo que decide si el subcuadro se enciende
+    uint32_t duration; //!< Duracion del subcuadro, en unidades del temporizador
+} screen_subframe_t;
+
+//! Cuadro completo de la pantalla, con todo lo necesario para mostrarlo sin consultar otro estado
+typedef struct screen_frame_s {
+    uint16_t flashing_frecuency;                       //!< Periodo del parpadeo de digitos, en barridos
+    uint16_t point_flash_frecuency;                    //!< Periodo del parpadeo de puntos, en barridos
+    uint8_t brightness;                                //!< Nivel de brillo
+    uint8_t value[SCREEN_MAX_DIGITS];                  //!< Segmentos de cada digito
+    uint8_t attributes[SCREEN_MAX_DIGITS];             //!< Atributos SCREEN_ATTR_* de cada digito
+    uint8_t phases[SCREEN_PHASES][SCREEN_MAX_DIGITS];  //!< Segmentos precompuestos para cada fase de parpadeo
+    uint32_t marquee_id;                               //!< Identificador de la marquesina, 0 si no hay ninguna
+    uint16_t marquee_length;                           //!< Posiciones usadas del buffer, incluyendo los blancos
+    uint16_t marquee_divisor;                          //!< Barridos entre cada paso del desplazamiento
+    uint8_t marquee[SCREEN_MARQUEE_LENGTH];            //!< Segmentos prerenderizados de la marquesina
+    uint8_t transition_id;                             //!< Identificador de la transicion, 0 si no hubo ninguna
+    uint8_t transition_length;                         //!< Cantidad de cuadros intermedios de la transicion
+    uint16_t transition_divisor;                       //!< Barridos que se muestra cada cuadro intermedio
+    uint8_t transition[SCREEN_TRANSITION_FRAMES][SCREEN_MAX_DIGITS]; //!< Cuadros intermedios precalculados
+} * screen_frame_t;
+
 struct screen_s {
     uint8_t digits;
     uint8_t current_digit;
+    screen_driver_t driver;
 
-    uint8_t flashing_from;
-    uint8_t flashing_to;
+    /* Estado propio del refresco, que solo lee el buffer front */
+    uint8_t front;
     uint16_t flashing_frecuency;
-    uint8_t flashing_count;
+    uint16_t flashing_count;
+    uint16_t point_flash_frecuency;
+    uint16_t point_flash_count;
+    uint8_t brightness;
+    uint8_t planes[SCREEN_BRIGHTNESS_BITS];
+    const uint8_t * window;
+    uint32_t marquee_id;
+    uint16_t marquee_offset;
+    uint16_t marquee_count;
+    uint8_t transition_id;
+    uint8_t transition_index;
+    uint16_t transition_count;
+    const screen_subframe_t * schedule;
+    uint8_t schedule_length;
+    uint8_t step;
+    uint32_t interval;
 
-    uint8_t point_flash_from;
-    uint8_t point_flash_to;
-    uint8_t point_flash_frecuency;
-    uint8_t point_flash_count;
+    /* Buffer donde componen los escritores */
+    uint8_t back;
+    uint32_t marquee_sequence;
+    uint32_t time_key;
+    screen_transition_t transition_type;
+    uint16_t transition_divisor;
+    uint8_t transition_sequence;
+    uint8_t published_view[SCREEN_MAX_DIGITS];
 
-    screen_driver_t driver;
+    /* Ultimo buffer publicado, intercambiado en forma atomica entre escritores y refresco */
+    uint8_t ready;
+
+    /* Ultimo cuadro enviado a un driver con FrameTransfer */
+    bool sent_valid;
+    uint8_t sent_brightness;
+    uint8_t sent[SCREEN_MAX_DIGITS];
 
-    uint8_t value[SCREEN_MAX_DIGITS];
-    bool point_enabled[SCREEN_MAX_DIGITS];
+    /* Ultima marquesina que el refresco termino de desplazar; el identificador es de 32 bits para que no vuelva a
+     * repetirse mientras la interfaz consulta una marquesina anterior */
+    uint32_t marquee_finished;
+
+    bool timed_started;
+    uint32_t last_timestamp;
+    screen_jitter_t jitter;
+
+    /* Tablas de subcuadros precalculadas: un subcuadro por digito con brillo maximo o modulacion binaria */
+    screen_subframe_t full_schedule[SCREEN_MAX_DIGITS];
+    screen_subframe_t bcm_schedule[SCREEN_MAX_DIGITS * SCREEN_BRIGHTNESS_BITS];
+
+    struct screen_frame_s buffers[SCREEN_BUFFERS];
 };
 
 /* === Private function declarations =============================================================================== */
 
-static const uint8_t IMAGES[10] = {
-    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F,             // 0
-    SEGMENT_B | SEGMENT_C,                                                             // 1
-    SEGMENT_A | SEGMENT_B | SEGMENT_D | SEGMENT_E | SEGMENT_G,                         // 2
-    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_G,                         // 3
-    SEGMENT_B | SEGMENT_C | SEGMENT_F | SEGMENT_G,                                     // 4
-    SEGMENT_A | SEGMENT_C | SEGMENT_D | SEGMENT_F | SEGMENT_G,                         // 5
-    SEGMENT_A | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G,             // 6
-    SEGMENT_A | SEGMENT_B | SEGMENT_C,                                                 // 7
-    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G, // 8
-    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_F | SEGMENT_G              // 9
+/* Glifos de los valores BCD, extendidos a hexadecimal para diagnosticos */
+static const uint8_t IMAGES[16] = {
+    GLYPH_0, GLYPH_1, GLYPH_2, GLYPH_3, GLYPH_4, GLYPH_5, GLYPH_6, GLYPH_7,
+    GLYPH_8, GLYPH_9, GLYPH_A, GLYPH_B, GLYPH_C, GLYPH_D, GLYPH_E, GLYPH_F,
 };
 
+/* Pares de segmentos de los minutos 00 a 59, indexados por decenas y unidades */
+static const uint16_t MINUTE_PAIRS[6][10] = {
+    PAIR_ROW(0), PAIR_ROW(1), PAIR_ROW(2), PAIR_ROW(3), PAIR_ROW(4), PAIR_ROW(5),
+};
+
+/* Pares de segmentos de las horas 00 a 23, indexados por decenas y unidades */
+static const uint16_t HOUR_PAIRS[3][10] = {
+    PAIR_ROW(0),
+    PAIR_ROW(1),
+    {PAIR(2, 0), PAIR(2, 1), PAIR(2, 2), PAIR(2, 3), PAIR_INVALID, PAIR_INVALID, PAIR_INVALID, PAIR_INVALID,
+     PAIR_INVALID, PAIR_INVALID},
+};
+
+/* Glifos de los caracteres ASCII; las entradas sin GLYPH_DEFINED no tienen representacion */
+static const uint8_t FONT[128] = {
+    [' '] = GLYPH(0),
+    ['-'] = GLYPH(SEGMENT_G),
+    ['_'] = GLYPH(SEGMENT_D),
+    ['='] = GLYPH(SEGMENT_D | SEGMENT_G),
+    ['"'] = GLYPH(SEGMENT_B | SEGMENT_F),
+    ['\''] = GLYPH(SEGMENT_F),
+    ['['] = GLYPH(GLYPH_C),
+    [']'] = GLYPH(SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D),
+    ['?'] = GLYPH(SEGMENT_A | SEGMENT_B | SEGMENT_E | SEGMENT_G),
+    ['0'] = GLYPH(GLYPH_0),
+    ['1'] = GLYPH(GLYPH_1),
+    ['2'] = GLYPH(GLYPH_2),
+    ['3'] = GLYPH(GLYPH_3),
+    ['4'] = GLYPH(GLYPH_4),
+    ['5'] = GLYPH(GLYPH_5),
+    ['6'] = GLYPH(GLYPH_6),
+    ['7'] = GLYPH(GLYPH_7),
+    ['8'] = GLYPH(GLYPH_8),
+    ['9'] = GLYPH(GLYPH_9),
+    ['A'] = GLYPH(GLYPH_A),
+    ['B'] = GLYPH(GLYPH_B),
+    ['C'] = GLYPH(GLYPH_C),
+    ['D'] = GLYPH(GLYPH_D),
+    ['E'] = GLYPH(GLYPH_E),
+    ['F'] = GLYPH(GLYPH_F),
+    ['G'] = GLYPH(SEGMENT_A | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F),
+    ['H'] = GLYPH(SEGMENT_B | SEGMENT_C | SEGMENT_E | SEGMENT_F | SEGMENT_G),
+    ['I'] = GLYPH(SEGMENT_E | SEGMENT_F),
+    ['J'] = GLYPH(SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E),
+    ['L'] = GLYPH(SEGMENT_D | SEGMENT_E | SEGMENT_F),
+    ['N'] = GLYPH(SEGMENT_C | SEGMENT_E | SEGMENT_G),
+    ['O'] = GLYPH(GLYPH_0),
+    ['P'] = GLYPH(SEGMENT_A | SEGMENT_B | SEGMENT_E | SEGMENT_F | SEGMENT_G),
+    ['Q'] = GLYPH(SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_F | SEGMENT_G),
+    ['R'] = GLYPH(SEGMENT_E | SEGMENT_G),
+    ['S'] = GLYPH(GLYPH_5),
+    ['T'] = GLYPH(SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G),
+    ['U'] = GLYPH(SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F),
+    ['Y'] = GLYPH(SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_F | SEGMENT_G),
+    ['Z'] = GLYPH(GLYPH_2),
+    ['a'] = GLYPH(SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_G),
+    ['b'] = GLYPH(GLYPH_B),
+    ['c'] = GLYPH(SEGMENT_D | SEGMENT_E | SEGMENT_G),
+    ['d'] = GLYPH(GLYPH_D),
+    ['e'] = GLYPH(SEGMENT_A | SEGMENT_B | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G),
+    ['f'] = GLYPH(GLYPH_F),
+    ['g'] = GLYPH(GLYPH_9),
+    ['h'] = GLYPH(SEGMENT_C | SEGMENT_E | SEGMENT_F | SEGMENT_G),
+    ['i'] = GLYPH(SEGMENT_E),
+    ['j'] = GLYPH(SEGMENT_C | SEGMENT_D),
+    ['l'] = GLYPH(SEGMENT_E | SEGMENT_F),
+    ['n'] = GLYPH(SEGMENT_C | SEGMENT_E | SEGMENT_G),
+    ['o'] = GLYPH(SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_G),
+    ['p'] = GLYPH(SEGMENT_A | SEGMENT_B | SEGMENT_E | SEGMENT_F | SEGMENT_G),
+    ['q'] = GLYPH(SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_F | SEGMENT_G),
+    ['r'] = GLYPH(SEGMENT_E | SEGMENT_G),
+    ['s'] = GLYPH(GLYPH_5),
+    ['t'] = GLYPH(SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G),
+    ['u'] = GLYPH(SEGMENT_C | SEGMENT_D | SEGMENT_E),
+    ['y'] = GLYPH(SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_F | SEGMENT_G),
+    ['z'] = GLYPH(GLYPH_2),
+};
+
+
+/**
+ * @brief Precompone los cuadros de todas las fases de parpadeo para un rango de digitos
+ *
+ * @param frame Cuadro a componer
+ * @param from Primer digito a componer
+ * @param to Ultimo digito a componer
+ */
+static void ScreenCompose(screen_frame_t frame, uint8_t from, uint8_t to);
+
+/**
+ * @brief Toma el ultimo cuadro publicado, si hay uno nuevo, y actualiza los contadores de parpadeo
+ *
+ * Se llama al comienzo de cada barrido, asi todos los digitos de un barrido salen del mismo cuadro.
+ *
+ * @param self Instancia de pantalla
+ */
+static void ScreenLatchFrame(screen_t self);
+
+/**
+ * @brief Apaga la pantalla, carga los segmentos y enciende un dígito
+ *
+ * Si el driver ofrece DigitCommit se usa esa unica llamada, si no se usan las tres funciones por separado.
+ *
+ * @param self Instancia de pantalla
+ * @param digit Dígito a encender
+ * @param segments Segmentos a mostrar
+ */
+static void ScreenShowDigit(screen_t self, uint8_t digit, uint8_t segments);
+
+/**
+ * @brief Envia el cuadro visible a un driver con FrameTransfer si difiere del ultimo enviado
+ *
+ * @param self Instancia de pantalla
+ */
+static void ScreenTransferFrame(screen_t self);
+
+/**
+ * @brief Convierte un texto en segmentos, agregando cada punto al digito anterior
+ *
+ * @param segments Arreglo donde se guardan los segmentos
+ * @param capacity Cantidad maxima de posiciones a escribir
+ * @param text Puntero al texto, que queda apuntando al primer caracter no convertido
+ * @return uint16_t Cantidad de posiciones escritas
+ */
+static uint16_t ScreenRenderText(uint8_t segments[], uint16_t capacity, const char ** text);
+
+/**
+ * @brief Marca el cuadro como marquesina nueva, con un identificador distinto del anterior
+ *
+ * @param self Instancia de pantalla
+ * @param frame Cuadro con el buffer de marquesina ya cargado
+ * @param length Cantidad de posiciones del contenido, sin contar los blancos
+ * @param divisor Barridos entre cada paso del desplazamiento
+ */
+static void ScreenStartMarquee(screen_t self, screen_frame_t frame, uint16_t length, uint16_t divisor);
+
+/**
+ * @brief Avanza la marquesina del cuadro tomado y apunta la ventana visible a la posicion actual
+ *
+ * @param self Instancia de pantalla
+ * @param frame Cuadro con la marquesina
+ */
+static void ScreenStepMarquee(screen_t self, screen_frame_t frame);
+
+/**
+ * @brief Avanza la transicion del cuadro tomado, reiniciandola si el cuadro trae una transicion nueva
+ *
+ * @param self Instancia de pantalla
+ * @param frame Cuadro tomado por el refresco
+ * @return true si todavia hay que mostrar un cuadro intermedio, false si la transicion termino
+ */
+static bool ScreenStepTransition(screen_t self, screen_frame_t frame);
+
+/**
+ * @brief Precalcula los cuadros intermedios entre el ultimo cuadro publicado y el que se va a publicar
+ *
+ * Solo genera una transicion nueva si cambiaron los segmentos de algun digito; los puntos se muestran siempre con
+ * su valor nuevo. Una transicion nueva reemplaza a la que estuviera en curso.
+ *
+ * @param self Instancia de pantalla
+ * @param frame Cuadro que se va a publicar
+ */
+static void ScreenBuildTransition(screen_t self, screen_frame_t frame);
+
+/**
+ * @brief Calcula un cuadro intermedio de la transicion de rodillo para un digito
+ *
+ * @param from Segmentos del valor anterior, sin el punto
+ * @param to Segmentos del valor nuevo, sin el punto
+ * @param offset Filas desplazadas, siempre par para que coincidan filas horizontales y verticales
+ * @return uint8_t Segmentos del cuadro intermedio
+ */
+static uint8_t ScreenRollDigit(uint8_t from, uint8_t to, uint8_t offset);
+
+/**
+ * @brief Separa los segmentos de un digito en filas de arriba hacia abajo
+ *
+ * @param segments Segmentos del digito
+ * @param rows Filas: bit 0 para el segmento izquierdo u horizontal y bit 1 para el derecho
+ */
+static void ScreenDigitToRows(uint8_t segments, uint8_t rows[DIGIT_ROWS]);
+
+/**
+ * @brief Selecciona la tabla de subcuadros y las mascaras de cada bit para un nivel de brillo
+ *
+ * @param self Instancia de pantalla
+ * @param level Nivel de brillo
+ */
+static void ScreenApplyBrightness(screen_t self, uint8_t level);
+
+/**
+ * @brief Reemplaza un atributo en todos los digitos, dejandolo activo solo en el rango indicado
+ *
+ * @param frame Cuadro a modificar
+ * @param from Primer digito del rango
+ * @param to Ultimo digito del rango
+ * @param attribute Atributo a reemplazar
+ */
+static void ScreenReplaceAttribute(screen_frame_t frame, uint8_t from, uint8_t to, uint8_t attribute);
 
 /**
  * @brief Inicializa los pines asociados a los dígitos de la pantalla
@@ -83,78 +405,207 @@ void DigitsInit(void);
 void SegmentsInit(void);
 /* === Private variable definitions ================================================================================ */
 
+//! Objetos de las pantallas
+POOL_DECLARE(struct screen_s, screen_pool, SCREEN_POOL)
+
 /* === Public variable definitions ================================================================================= */
 
 /* === Public function definitions ============================================================================== */
 
 screen_t ScreenCreate(uint8_t digits, screen_driver_t driver) {
 
-    screen_t self = malloc(sizeof(struct screen_s));
+    screen_t self = POOL_ALLOC(struct screen_s, screen_pool);
     if (digits > SCREEN_MAX_DIGITS) {
         digits = SCREEN_MAX_DIGITS;
     }
     if (self != NULL) {
+        memset(self, 0, sizeof(struct screen_s));
         self->digits = digits;
         self->driver = driver;
         self->current_digit = 0;
-        self->flashing_count = 0;
-        self->flashing_frecuency = 0;
-        self->point_flash_count = 0;
-        self->point_flash_frecuency = 0;
+        self->front = 0;
+        self->back = 1;
+        self->ready = 2;
+        self->time_key = TIME_KEY_NONE;
+        for (uint8_t i = 0; i < SCREEN_BUFFERS; i++) {
+            self->buffers[i].brightness = SCREEN_BRIGHTNESS_MAX;
+        }
+        self->window = self->buffers[self->front].phases[0];
+        ScreenSetRefreshPeriod(self, 0);
+        ScreenApplyBrightness(self, SCREEN_BRIGHTNESS_MAX);
     }
     return self;
 }
 
 void ScreenWriteBCD(screen_t self, uint8_t value[], uint8_t size) {
-    memset(self->value, 0, sizeof(self->value));
+    screen_frame_t frame = &self->buffers[self->back];
+
+    memset(frame->value, 0, sizeof(frame->value));
 
     if (size > self->digits) {
         size = self->digits;
     }
     for (uint8_t i = 0; i < size; i++) {
-        self->value[i] = IMAGES[value[i]];
+        frame->value[i] = (value[i] < sizeof(IMAGES)) ? IMAGES[value[i]] : SCREEN_GLYPH_INVALID;
     }
+    frame->marquee_id = 0;
+    self->time_key = TIME_KEY_NONE;
+    ScreenCompose(frame, 0, SCREEN_MAX_DIGITS - 1);
 }
 
-void ScreenRefresh(screen_t self) {
-    uint8_t segments;
+void ScreenWriteSegments(screen_t self, const uint8_t segments[], uint8_t size) {
+    screen_frame_t frame = &self->buffers[self->back];
 
-    self->driver->DigitsTurnOff();
-    self->current_digit = (self->current_digit + 1) % self->digits;
+    memset(frame->value, 0, sizeof(frame->value));
 
-    segments = self->value[self->current_digit];
+    if (size > self->digits) {
+        size = self->digits;
+    }
+    memcpy(frame->value, segments, size);
+    frame->marquee_id = 0;
+    self->time_key = TIME_KEY_NONE;
+    ScreenCompose(frame, 0, SCREEN_MAX_DIGITS - 1);
+}
 
-    if (self->current_digit == 0) {
-        if (self->flashing_frecuency) {
-            self->flashing_count = (self->flashing_count + 1) % self->flashing_frecuency;
-        }
-        if (self->point_flash_frecuency) {
-            self->point_flash_count = (self->point_flash_count + 1) % self->point_flash_frecuency;
-        }
+uint8_t ScreenWriteText(screen_t self, const char * text) {
+    screen_frame_t frame = &self->buffers[self->back];
+    uint8_t count;
+
+    memset(frame->value, 0, sizeof(frame->value));
+    frame->marquee_id = 0;
+    self->time_key = TIME_KEY_NONE;
+    count = (uint8_t)ScreenRenderText(frame->value, self->digits, &text);
+    ScreenCompose(frame, 0, SCREEN_MAX_DIGITS - 1);
+    return count;
+}
+
+uint8_t ScreenCharToSegments(char character) {
+    uint8_t code = (uint8_t)character;
+    uint8_t glyph = (code < sizeof(FONT)) ? FONT[code] : 0;
+
+    return (glyph & GLYPH_DEFINED) ? (glyph & ~GLYPH_DEFINED) : SCREEN_GLYPH_INVALID;
+}
+
+int ScreenWriteTime(screen_t self, const uint8_t hours[2], const uint8_t minutes[2]) {
+    screen_frame_t frame;
+    uint32_t key;
+    uint16_t pairs[2];
+    uint8_t last = 3;
+
+    if (!self || !hours || !minutes || self->digits < 4) {
+        return -1;
+    }
+    key = ((uint32_t)hours[1] << 24) | ((uint32_t)hours[0] << 16) | ((uint32_t)minutes[1] << 8) | minutes[0];
+    if (key == self->time_key) {
+        return 0;
     }
 
-    if (self->flashing_frecuency) {
-        if (self->flashing_count < (self->flashing_frecuency / 2)) {
-            if ((self->current_digit >= self->flashing_from) && (self->current_digit <= self->flashing_to)) {
-                segments = 0;
-            }
-        }
+    frame = &self->buffers[self->back];
+    if (self->time_key == TIME_KEY_NONE) {
+        memset(frame->value, 0, sizeof(frame->value));
+        frame->marquee_id = 0;
+        last = SCREEN_MAX_DIGITS - 1;
     }
+    pairs[0] = (hours[1] < 3 && hours[0] < 10) ? HOUR_PAIRS[hours[1]][hours[0]] : PAIR_INVALID;
+    pairs[1] = (minutes[1] < 6 && minutes[0] < 10) ? MINUTE_PAIRS[minutes[1]][minutes[0]] : PAIR_INVALID;
+    frame->value[0] = (uint8_t)pairs[0];
+    frame->value[1] = (uint8_t)(pairs[0] >> 8);
+    frame->value[2] = (uint8_t)pairs[1];
+    frame->value[3] = (uint8_t)(pairs[1] >> 8);
+    self->time_key = key;
+    ScreenCompose(frame, 0, last);
+    return 0;
+}
 
-    if (self->point_enabled[self->current_digit]) {
-        segments |= SEGMENT_P;
+int ScreenWriteMarqueeSegments(screen_t self, const uint8_t segments[], uint16_t length, uint16_t divisor) {
+    screen_frame_t frame;
+
+    if (!self || !segments || !divisor || length > SCREEN_MARQUEE_LENGTH - 2 * self->digits) {
+        return -1;
     }
+    frame = &self->buffers[self->back];
+    memset(frame->marquee, 0, sizeof(frame->marquee));
+    memcpy(&frame->marquee[self->digits], segments, length);
+    ScreenStartMarquee(self, frame, length, divisor);
+    return 0;
+}
 
-    if (self->point_flash_frecuency) {
-        if (self->point_flash_count < (self->point_flash_frecuency / 2)) {
-            if ((self->current_digit >= self->point_flash_from) && (self->current_digit <= self->point_flash_to)) {
-                segments &= ~SEGMENT_P;
-            }
+int ScreenWriteMarquee(screen_t self, const char * text, uint16_t divisor) {
+    screen_frame_t frame;
+    uint16_t length;
+
+    if (!self || !text || !divisor) {
+        return -1;
+    }
+    frame = &self->buffers[self->back];
+    memset(frame->marquee, 0, sizeof(frame->marquee));
+    length = ScreenRenderText(&frame->marquee[self->digits], SCREEN_MARQUEE_LENGTH - 2 * self->digits, &text);
+    if (*text != '\0') {
+        memset(frame->marquee, 0, sizeof(frame->marquee));
+        return -1;
+    }
+    ScreenStartMarquee(self, frame, length, divisor);
+    return 0;
+}
+
+int ScreenSetTransition(screen_t self, screen_transition_t type, uint16_t divisor) {
+    if (!self || type > SCREEN_TRANSITION_WIPE || (type != SCREEN_TRANSITION_NONE && !divisor)) {
+        return -1;
+    }
+    for (uint8_t i = 0; i < SCREEN_MAX_DIGITS; i++) {
+        self->published_view[i] = self->buffers[self->back].phases[0][i] & ~SEGMENT_P;
+    }
+    self->transition_type = type;
+    self->transition_divisor = divisor;
+    return 0;
+}
+
+bool ScreenMarqueeFinished(screen_t self) {
+    uint32_t current = self->buffers[self->back].marquee_id;
+
+    return current && (__atomic_load_n(&self->marquee_finished, __ATOMIC_ACQUIRE) == current);
+}
+
+void ScreenPublish(screen_t self) {
+    uint8_t published = self->back;
+
+    if (self->transition_type != SCREEN_TRANSITION_NONE) {
+        ScreenBuildTransition(self, &self->buffers[published]);
+    }
+
+    self->back = __atomic_exchange_n(&self->ready, published | BUFFER_FRESH, __ATOMIC_ACQ_REL) & BUFFER_INDEX;
+    memcpy(&self->buffers[self->back], &self->buffers[published], sizeof(struct screen_frame_s));
+}
+
+void ScreenRefresh(screen_t self) {
+    PROBE_BEGIN(PROBE_SCREEN_REFRESH);
+    if (self->driver->FrameTransfer) {
+        ScreenLatchFrame(self);
+        ScreenTransferFrame(self);
+    } else {
+        self->current_digit = (self->current_digit + 1) % self->digits;
+        if (self->current_digit == 0) {
+            ScreenLatchFrame(self);
         }
+        ScreenShowDigit(self, self->current_digit, self->window[self->current_digit]);
     }
+    PROBE_END(PROBE_SCREEN_REFRESH);
+}
 
-    self->driver->SegmentsUpdate(segments);
-    self->driver->DigitTurnOn(self->current_digit);
+void ScreenSleep(screen_t self) {
+    if (!self) {
+        return;
+    }
+    if (self->driver->FrameTransfer) {
+        /* Solo cambia el brillo, asi el controlador recibe el apagado sin reenviar los digitos */
+        self->sent_brightness = 0;
+        self->driver->FrameTransfer(self->sent, self->digits, self->sent_brightness);
+    } else {
+        self->driver->DigitsTurnOff();
+    }
+    self->current_digit = self->digits - 1;
+    self->step = 0;
+    self->timed_started = false;
 }
 
 int DisplayFlashDigit(screen_t self, uint8_t from, uint8_t to, uint8_t divisor) {
@@ -164,25 +615,21 @@ int DisplayFlashDigit(screen_t self, uint8_t from, uint8_t to, uint8_t divisor)
     } else if (!self) {
         result = -1;
     } else {
-        if (self) {
-            self->flashing_from = from;
-            self->flashing_to = to;
-            self->flashing_frecuency = 2 * divisor;
-            self->flashing_count = 0;
-        }
+        ScreenReplaceAttribute(&self->buffers[self->back], from, to, SCREEN_ATTR_BLINK);
+        self->buffers[self->back].flashing_frecuency = 2 * divisor;
     }
     return result;
 }
 
 void ScreenEnablePoint(screen_t self, uint8_t digit) {
     if (self && digit < self->digits) {
-        self->point_enabled[digit] = true;
+        ScreenSetAttributes(self, digit, digit, SCREEN_ATTR_POINT);
     }
 }
 
 void ScreenDisablePoint(screen_t self, uint8_t digit) {
     if (self && digit < self->digits) {
-        self->point_enabled[digit] = false;
+        ScreenClearAttributes(self, digit, digit, SCREEN_ATTR_POINT);
     }
 }
 
@@ -193,15 +640,407 @@ int DisplayFlashPoints(screen_t self, uint8_t from, uint8_t to, uint8_t divisor)
     } else if (!self) {
         result = -1;
     } else {
-        if (self) {
-            self->point_flash_from = from;
-            self->point_flash_to = to;
-            self->point_flash_frecuency = 2 * divisor;
-            self->point_flash_count = 0;
-        }
+        ScreenReplaceAttribute(&self->buffers[self->back], from, to, SCREEN_ATTR_POINT_BLINK);
+        self->buffers[self->back].point_flash_frecuency = 2 * divisor;
     }
     return result;
 }
+
+int ScreenSetAttributes(screen_t self, uint8_t from, uint8_t to, uint8_t attributes) {
+    screen_frame_t frame;
+
+    if (!self || from > to || to >= SCREEN_MAX_DIGITS) {
+        return -1;
+    }
+    frame = &self->buffers[self->back];
+    for (uint8_t i = from; i <= to; i++) {
+        frame->attributes[i] |= attributes;
+    }
+    ScreenCompose(frame, from, to);
+    return 0;
+}
+
+int ScreenClearAttributes(screen_t self, uint8_t from, uint8_t to, uint8_t attributes) {
+    screen_frame_t frame;
+
+    if (!self || from > to || to >= SCREEN_MAX_DIGITS) {
+        return -1;
+    }
+    frame = &self->buffers[self->back];
+    for (uint8_t i = from; i <= to; i++) {
+        frame->attributes[i] &= ~attributes;
+    }
+    ScreenCompose(frame, from, to);
+    return 0;
+}
+
+int ScreenSetBrightness(screen_t self, uint8_t level) {
+    if (!self || level > SCREEN_BRIGHTNESS_MAX) {
+        return -1;
+    }
+    self->buffers[self->back].brightness = level;
+    return 0;
+}
+
+uint8_t ScreenGetAttributes(screen_t self, uint8_t digit) {
+    if (!self || digit >= SCREEN_MAX_DIGITS) {
+        return 0;
+    }
+    return self->buffers[self->back].attributes[digit];
+}
+
+void ScreenSetRefreshPeriod(screen_t self, uint32_t period) {
+    uint32_t unit;
+    screen_subframe_t * subframe;
+
+    if (!self) {
+        return;
+    }
+    if (period < SCREEN_MIN_REFRESH_PERIOD) {
+        period = SCREEN_MIN_REFRESH_PERIOD;
+    }
+    unit = period / (SCREEN_BRIGHTNESS_LEVELS - 1);
+    subframe = self->bcm_schedule;
+    self->timed_started = false;
+    self->last_timestamp = 0;
+    self->interval = period;
+    memset(&self->jitter, 0, sizeof(self->jitter));
+    self->jitter.period = period;
+
+    for (uint8_t digit = 0; digit < self->digits; digit++) {
+        self->full_schedule[digit] = (screen_subframe_t){.digit = digit, .plane = 0, .duration = period};
+        for (uint8_t plane = 0; plane < SCREEN_BRIGHTNESS_BITS; plane++) {
+            subframe->digit = digit;
+            subframe->plane = plane;
+            subframe->duration = unit << plane;
+            subframe++;
+        }
+        /* El resto de la division se suma al subcuadro mas largo para que cada digito dure exactamente el periodo */
+        (subframe - 1)->duration += period - unit * (SCREEN_BRIGHTNESS_LEVELS - 1);
+    }
+}
+
+uint32_t ScreenRefreshTimed(screen_t self, uint32_t timestamp) {
+    const screen_subframe_t * subframe;
+    uint8_t mask;
+    int32_t deviation;
+    PROBE_BEGIN(PROBE_SCREEN_REFRESH);
+
+    if (self->timed_started) {
+        deviation = (int32_t)(timestamp - self->last_timestamp - self->interval);
+        if (self->jitter.count == 0 || deviation < self->jitter.min) {
+            self->jitter.min = deviation;
+        }
+        if (self->jitter.count == 0 || deviation > self->jitter.max) {
+            self->jitter.max = deviation;
+        }
+        self->jitter.last = deviation;
+        self->jitter.sum_abs += (uint32_t)(deviation < 0 ? -deviation : deviation);
+        self->jitter.count++;
+    }
+    self->timed_started = true;
+    self->last_timestamp = timestamp;
+
+    if (self->driver->FrameTransfer) {
+        ScreenLatchFrame(self);
+        ScreenTransferFrame(self);
+        self->interval = self->jitter.period * self->digits;
+        PROBE_END(PROBE_SCREEN_REFRESH);
+        return self->interval;
+    }
+    if (self->step == 0) {
+        ScreenLatchFrame(self);
+    }
+    subframe = &self->schedule[self->step];
+    mask = self->planes[subframe->plane];
+    self->current_digit = subframe->digit;
+
+    if (mask) {
+        ScreenShowDigit(self, subframe->digit, self->window[subframe->digit]);
+    } else if (self->driver->BlankingInterval) {
+        self->driver->BlankingInterval();
+    } else {
+        self->driver->DigitsTurnOff();
+    }
+
+    self->step++;
+    if (self->step >= self->schedule_length) {
+        self->step = 0;
+    }
+    self->interval = subframe->duration;
+    PROBE_END(PROBE_SCREEN_REFRESH);
+    return subframe->duration;
+}
+
+bool ScreenGetJitter(screen_t self, screen_jitter_t * stats) {
+    if (!self || !stats) {
+        return false;
+    }
+    memcpy(stats, &self->jitter, sizeof(screen_jitter_t));
+    return true;
+}
+
 /* === Private function definitions ================================================================================ */
 
+static void ScreenCompose(screen_frame_t frame, uint8_t from, uint8_t to) {
+    uint8_t segments;
+    uint8_t attributes;
+
+    for (uint8_t i = from; i <= to; i++) {
+        attributes = frame->attributes[i];
+        segments = (attributes & SCREEN_ATTR_BLANK) ? 0 : frame->value[i];
+        if (attributes & SCREEN_ATTR_POINT) {
+            segments |= SEGMENT_P;
+        }
+
+        for (uint8_t phase = 0; phase < SCREEN_PHASES; phase++) {
+            uint8_t shown = segments;
+            if ((phase & PHASE_DIGITS_OFF) && (attributes & SCREEN_ATTR_BLINK)) {
+                shown &= SEGMENT_P;
+            }
+            if ((phase & PHASE_POINTS_OFF) && (attributes & SCREEN_ATTR_POINT_BLINK)) {
+                shown &= ~SEGMENT_P;
+            }
+            frame->phases[phase][i] = shown;
+        }
+    }
+}
+
+static void ScreenLatchFrame(screen_t self) {
+    screen_frame_t frame;
+    uint8_t phase = 0;
+
+    if (__atomic_load_n(&self->ready, __ATOMIC_ACQUIRE) & BUFFER_FRESH) {
+        self->front = __atomic_exchange_n(&self->ready, self->front, __ATOMIC_ACQ_REL) & BUFFER_INDEX;
+    }
+    frame = &self->buffers[self->front];
+
+    if (frame->brightness != self->brightness) {
+        ScreenApplyBrightness(self, frame->brightness);
+    }
+    if (frame->flashing_frecuency != self->flashing_frecuency) {
+        self->flashing_frecuency = frame->flashing_frecuency;
+        self->flashing_count = 0;
+    } else if (self->flashing_frecuency) {
+        self->flashing_count = (self->flashing_count + 1) % self->flashing_frecuency;
+    }
+    if (frame->point_flash_frecuency != self->point_flash_frecuency) {
+        self->point_flash_frecuency = frame->point_flash_frecuency;
+        self->point_flash_count = 0;
+    } else if (self->point_flash_frecuency) {
+        self->point_flash_count = (self->point_flash_count + 1) % self->point_flash_frecuency;
+    }
+
+    if (self->flashing_frecuency && self->flashing_count < (self->flashing_frecuency / 2)) {
+        phase |= PHASE_DIGITS_OFF;
+    }
+    if (self->point_flash_frecuency && self->point_flash_count < (self->point_flash_frecuency / 2)) {
+        phase |= PHASE_POINTS_OFF;
+    }
+    if (frame->marquee_id) {
+        ScreenStepMarquee(self, frame);
+    } else if (ScreenStepTransition(self, frame)) {
+        self->window = frame->transition[self->transition_index];
+    } else {
+        self->window = frame->phases[phase];
+    }
+}
+
+static void ScreenShowDigit(screen_t self, uint8_t digit, uint8_t segments) {
+    if (self->driver->DigitCommit) {
+        self->driver->DigitCommit(digit, segments);
+    } else {
+        self->driver->DigitsTurnOff();
+        self->driver->SegmentsUpdate(segments);
+        self->driver->DigitTurnOn(digit);
+    }
+}
+
+static void ScreenTransferFrame(screen_t self) {
+    if (self->sent_valid && self->sent_brightness == self->brightness &&
+        memcmp(self->sent, self->window, self->digits) == 0) {
+        return;
+    }
+    memcpy(self->sent, self->window, self->digits);
+    self->sent_brightness = self->brightness;
+    self->sent_valid = true;
+    self->driver->FrameTransfer(self->sent, self->digits, self->sent_brightness);
+}
+
+static void ScreenStepMarquee(screen_t self, screen_frame_t frame) {
+    if (frame->marquee_id != self->marquee_id) {
+        self->marquee_id = frame->marquee_id;
+        self->marquee_offset = 0;
+        self->marquee_count = 0;
+    } else if (self->marquee_offset < frame->marquee_length - self->digits) {
+        self->marquee_count++;
+        if (self->marquee_count >= frame->marquee_divisor) {
+            self->marquee_count = 0;
+            self->marquee_offset++;
+        }
+    }
+    if (self->marquee_offset >= frame->marquee_length - self->digits) {
+        __atomic_store_n(&self->marquee_finished, self->marquee_id, __ATOMIC_RELEASE);
+    }
+    self->window = &frame->marquee[self->marquee_offset];
+}
+
+static bool ScreenStepTransition(screen_t self, screen_frame_t frame) {
+    if (frame->transition_id != self->transition_id) {
+        self->transition_id = frame->transition_id;
+        self->transition_index = 0;
+        self->transition_count = 0;
+    } else if (self->transition_index < frame->transition_length) {
+        self->transition_count++;
+        if (self->transition_count >= frame->transition_divisor) {
+            self->transition_count = 0;
+            self->transition_index++;
+        }
+    }
+    return self->transition_index < frame->transition_length;
+}
+
+static void ScreenBuildTransition(screen_t self, screen_frame_t frame) {
+    uint8_t target[SCREEN_MAX_DIGITS];
+    uint8_t points[SCREEN_MAX_DIGITS];
+    uint8_t length = 0;
+    uint16_t accumulator = 0;
+
+    for (uint8_t i = 0; i < SCREEN_MAX_DIGITS; i++) {
+        target[i] = frame->phases[0][i] & ~SEGMENT_P;
+        points[i] = frame->phases[0][i] & SEGMENT_P;
+    }
+    if (memcmp(target, self->published_view, sizeof(target)) == 0) {
+        return;
+    }
+
+    switch (self->transition_type) {
+    case SCREEN_TRANSITION_ROLL:
+        for (uint8_t offset = 2; offset < ROLL_ROWS - DIGIT_ROWS; offset += 2) {
+            for (uint8_t i = 0; i < SCREEN_MAX_DIGITS; i++) {
+                frame->transition[length][i] = ScreenRollDigit(self->published_view[i], target[i], offset);
+            }
+            length++;
+        }
+        break;
+    case SCREEN_TRANSITION_FADE:
+        /* Difusion de error: la proporcion de cuadros con el valor nuevo crece en forma lineal */
+        for (; length < SCREEN_TRANSITION_FRAMES; length++) {
+            accumulator += length + 1;
+            if (accumulator > SCREEN_TRANSITION_FRAMES) {
+                accumulator -= SCREEN_TRANSITION_FRAMES + 1;
+                memcpy(frame->transition[length], target, sizeof(target));
+            } else {
+                memcpy(frame->transition[length], self->published_view, sizeof(target));
+            }
+        }
+        break;
+    case SCREEN_TRANSITION_WIPE:
+        for (; length + 1 < self->digits; length++) {
+            memcpy(frame->transition[length], self->published_view, sizeof(target));
+            memcpy(frame->transition[length], target, length + 1);
+        }
+        break;
+    default:
+        break;
+    }
+    for (uint8_t step = 0; step < length; step++) {
+        for (uint8_t i = 0; i < SCREEN_MAX_DIGITS; i++) {
+            frame->transition[step][i] |= points[i];
+        }
+    }
+
+    memcpy(self->published_view, target, sizeof(target));
+    if (length) {
+        self->transition_sequence++;
+        if (self->transition_sequence == 0) {
+            self->transition_sequence = 1;
+        }
+        frame->transition_id = self->transition_sequence;
+        frame->transition_length = length;
+        frame->transition_divisor = self->transition_divisor;
+    }
+}
+
+static uint8_t ScreenRollDigit(uint8_t from, uint8_t to, uint8_t offset) {
+    uint8_t rows[ROLL_ROWS];
+    uint8_t result = 0;
+
+    /* Columna con las filas del valor anterior, una fila vertical vacia y las filas del valor nuevo */
+    ScreenDigitToRows(from, &rows[0]);
+    rows[DIGIT_ROWS] = 0;
+    ScreenDigitToRows(to, &rows[DIGIT_ROWS + 1]);
+
+    result |= (rows[offset + 0] & 1) ? SEGMENT_A : 0;
+    result |= (rows[offset + 1] & 1) ? SEGMENT_F : 0;
+    result |= (rows[offset + 1] & 2) ? SEGMENT_B : 0;
+    result |= (rows[offset + 2] & 1) ? SEGMENT_G : 0;
+    result |= (rows[offset + 3] & 1) ? SEGMENT_E : 0;
+    result |= (rows[offset + 3] & 2) ? SEGMENT_C : 0;
+    result |= (rows[offset + 4] & 1) ? SEGMENT_D : 0;
+    return result;
+}
+
+static void ScreenDigitToRows(uint8_t segments, uint8_t rows[DIGIT_ROWS]) {
+    rows[0] = (segments & SEGMENT_A) ? 1 : 0;
+    rows[1] = ((segments & SEGMENT_F) ? 1 : 0) | ((segments & SEGMENT_B) ? 2 : 0);
+    rows[2] = (segments & SEGMENT_G) ? 1 : 0;
+    rows[3] = ((segments & SEGMENT_E) ? 1 : 0) | ((segments & SEGMENT_C) ? 2 : 0);
+    rows[4] = (segments & SEGMENT_D) ? 1 : 0;
+}
+
+static void ScreenApplyBrightness(screen_t self, uint8_t level) {
+    self->brightness = level;
+    if (level == SCREEN_BRIGHTNESS_MAX) {
+        self->schedule = self->full_schedule;
+        self->schedule_length = self->digits;
+        self->planes[0] = 0xFF;
+    } else {
+        self->schedule = self->bcm_schedule;
+        self->schedule_length = self->digits * SCREEN_BRIGHTNESS_BITS;
+        for (uint8_t plane = 0; plane < SCREEN_BRIGHTNESS_BITS; plane++) {
+            self->planes[plane] = (level & (1 << plane)) ? 0xFF : 0x00;
+        }
+    }
+}
+
+static uint16_t ScreenRenderText(uint8_t segments[], uint16_t capacity, const char ** text) {
+    const char * character = *text;
+    uint16_t count = 0;
+
+    for (; *character != '\0'; character++) {
+        if ((*character == '.') && (count > 0) && !(segments[count - 1] & SEGMENT_P)) {
+            segments[count - 1] |= SEGMENT_P;
+        } else if (count < capacity) {
+            segments[count++] = (*character == '.') ? SEGMENT_P : ScreenCharToSegments(*character);
+        } else {
+            break;
+        }
+    }
+    *text = character;
+    return count;
+}
+
+static void ScreenStartMarquee(screen_t self, screen_frame_t frame, uint16_t length, uint16_t divisor) {
+    self->marquee_sequence++;
+    if (self->marquee_sequence == 0) {
+        self->marquee_sequence = 1;
+    }
+    frame->marquee_id = self->marquee_sequence;
+    frame->marquee_length = length + 2 * self->digits;
+    frame->marquee_divisor = divisor;
+    self->time_key = TIME_KEY_NONE;
+}
+
+static void ScreenReplaceAttribute(screen_frame_t frame, uint8_t from, uint8_t to, uint8_t attribute) {
+    for (uint8_t i = 0; i < SCREEN_MAX_DIGITS; i++) {
+        if (i >= from && i <= to) {
+            frame->attributes[i] |= attribute;
+        } else {
+            frame->attributes[i] &= ~attribute;
+        }
+    }
+    ScreenCompose(frame, 0, SCREEN_MAX_DIGITS - 1);
+}
+
 /* === End of documentation ======================================================================================== */
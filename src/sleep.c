@@ -0,0 +1,147 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Martin Nicolas Soria <soria.m.nicolas@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, disponiblestribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file sleep.c
+ ** @brief Politica de apagado de la pantalla por inactividad y horario nocturno
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "sleep.h"
+#include "pool.h"
+#include <stdlib.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! Cantidad de politicas de apagado que se pueden crear con STATIC_ALLOCATION
+#ifndef SLEEP_POOL
+#define SLEEP_POOL 1
+#endif
+
+//! Minutos de un dia, limite de los minutos de la ventana nocturna
+#define MINUTES_PER_DAY 1440
+
+/* === Private data type declarations ============================================================================== */
+
+//! Estructura que representa una politica de apagado
+struct sleep_s {
+    uint32_t timeout;            //!< Tiempo sin actividad hasta apagar, 0 si esta deshabilitado
+    uint16_t night_from;         //!< Primer minuto de la ventana nocturna
+    uint16_t night_to;           //!< Minuto en que termina la ventana nocturna
+    volatile uint32_t activity;  //!< Contador de actividad, el unico campo que escriben otras tareas
+    uint32_t seen;               //!< Ultimo valor del contador de actividad procesado
+    uint32_t last;               //!< Momento de la ultima actividad procesada
+    bool recent;                 //!< Indica si la ultima actividad todavia mantiene la pantalla encendida
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Indica si un minuto del dia cae dentro de la ventana nocturna
+ *
+ * @param self Politica de apagado
+ * @param minute Minuto del dia
+ * @return true Si el minuto esta dentro de la ventana
+ */
+static bool SleepIsNight(sleep_t self, uint16_t minute);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Objetos de las politicas de apagado
+POOL_DECLARE(struct sleep_s, sleep_pool, SLEEP_POOL)
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Public function definitions ================================================================================= */
+
+sleep_t SleepCreate(uint32_t timeout, uint16_t night_from, uint16_t night_to) {
+    sleep_t self = NULL;
+
+    if (night_from < MINUTES_PER_DAY && night_to < MINUTES_PER_DAY) {
+        self = POOL_ALLOC(struct sleep_s, sleep_pool);
+    }
+    if (self != NULL) {
+        self->timeout = timeout;
+        self->night_from = night_from;
+        self->night_to = night_to;
+        self->activity = 0;
+        self->seen = 0;
+        self->last = 0;
+        self->recent = false;
+        /* La pantalla arranca encendida, como si se acabara de tocar una tecla */
+        SleepActivity(self);
+    }
+    return self;
+}
+
+void SleepActivity(sleep_t self) {
+    if (self) {
+        self->activity++;
+    }
+}
+
+bool SleepIsAwake(sleep_t self, uint32_t now, uint16_t minute, bool alarm) {
+    uint32_t activity;
+    uint32_t hold;
+    bool night;
+
+    if (!self) {
+        return true;
+    }
+
+    activity = self->activity;
+    if (activity != self->seen) {
+        self->seen = activity;
+        self->last = now;
+        self->recent = true;
+    }
+
+    /* De noche una tecla enciende la pantalla a lo sumo por SLEEP_NIGHT_HOLD, aunque el apagado por inactividad sea
+     * mas largo, y la actividad del dia se corta al empezar la ventana */
+    night = SleepIsNight(self, minute);
+    hold = self->timeout ? self->timeout : SLEEP_NIGHT_HOLD;
+    if (night && hold > SLEEP_NIGHT_HOLD) {
+        hold = SLEEP_NIGHT_HOLD;
+    }
+
+    /* Una vez vencida la actividad se descarta, asi el desborde del contador de tiempo no vuelve a encenderla */
+    if (self->recent && (uint32_t)(now - self->last) >= hold) {
+        self->recent = false;
+    }
+
+    if (alarm || self->recent) {
+        return true;
+    }
+    return self->timeout == 0 && !night;
+}
+
+/* === Private function definitions ================================================================================ */
+
+static bool SleepIsNight(sleep_t self, uint16_t minute) {
+    if (minute >= MINUTES_PER_DAY || self->night_from == self->night_to) {
+        return false;
+    }
+    if (self->night_from < self->night_to) {
+        return minute >= self->night_from && minute < self->night_to;
+    }
+    return minute >= self->night_from || minute < self->night_to;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,522 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Martin Nicolas Soria <soria.m.nicolas@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, disponiblestribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file chip.c
+ ** @brief Perifericos simulados en el host, con la semantica de LPCOpen, un registro de escrituras y tiempo simulado.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "chip.h"
+#include <stddef.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+//! Cantidad de temporizadores simulados
+#define TIMERS 4
+
+//! Bit de habilitacion de TCR
+#define TIMER_ENABLE 0x01
+
+//! Bit de MCR que habilita la interrupcion de un canal de match
+#define TIMER_MATCH_INT(match) (1u << (3 * (match)))
+
+//! Bit de CR1 que habilita SSP
+#define SSP_ENABLE 0x02
+
+//! Bit de DMACR que habilita los pedidos de DMA de transmision
+#define SSP_DMA_TX 0x02
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Agrega una escritura al registro y la cuenta
+ *
+ * @param reg Registro escrito, chip_fake_register_t
+ * @param unit Puerto, grupo, temporizador o interrupcion
+ * @param index Pin o canal
+ * @param value Valor escrito
+ */
+static void LogWrite(chip_fake_register_t reg, uint8_t unit, uint8_t index, uint32_t value);
+
+/**
+ * @brief Devuelve el numero de un temporizador simulado
+ */
+static uint8_t TimerUnit(const LPC_TIMER_T * timer);
+
+/**
+ * @brief Avanza un temporizador habilitado y marca los match alcanzados con su interrupcion habilitada
+ *
+ * @param timer Temporizador a avanzar
+ * @param microseconds Tiempo transcurrido
+ */
+static void TimerAdvance(LPC_TIMER_T * timer, uint32_t microseconds);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Registros GPIO simulados
+static LPC_GPIO_T gpio_registers;
+
+//! Registros SCU simulados
+static LPC_SCU_T scu_registers;
+
+//! Temporizadores simulados
+static LPC_TIMER_T timer_registers[TIMERS];
+
+//! Perro guardian simulado
+static LPC_WWDT_T wwdt_registers;
+
+//! SSP1 simulado
+static LPC_SSP_T ssp_registers;
+
+//! DMA simulado
+static LPC_GPDMA_T gpdma_registers;
+
+//! Escrituras a registros desde el ultimo ChipFakeReset
+static uint32_t writes;
+
+//! Primeras escrituras desde el ultimo ChipFakeReset
+static chip_fake_write_t write_log[CHIP_FAKE_LOG_SIZE];
+
+//! Tiempo simulado en microsegundos
+static uint32_t now;
+
+//! Interrupciones habilitadas en el NVIC
+static bool irq_enabled[CHIP_FAKE_IRQS];
+
+//! Interrupciones enmascaradas con __disable_irq
+static bool irq_masked;
+
+//! El perro guardian llego a cero sin alimentarse
+static bool watchdog_expired;
+
+//! El perro guardian se alimento alguna vez con las interrupciones habilitadas
+static bool watchdog_fed_unmasked;
+
+//! Se escribio alguna vez MPIN con las interrupciones habilitadas
+static bool masked_write_unmasked;
+
+/* === Public variable definitions ================================================================================= */
+
+LPC_GPIO_T * LPC_GPIO_PORT = &gpio_registers;
+LPC_SCU_T * LPC_SCU = &scu_registers;
+LPC_TIMER_T * LPC_TIMER0 = &timer_registers[0];
+LPC_TIMER_T * LPC_TIMER1 = &timer_registers[1];
+LPC_TIMER_T * LPC_TIMER2 = &timer_registers[2];
+LPC_TIMER_T * LPC_TIMER3 = &timer_registers[3];
+LPC_WWDT_T * LPC_WWDT = &wwdt_registers;
+LPC_SSP_T * LPC_SSP1 = &ssp_registers;
+LPC_GPDMA_T * LPC_GPDMA = &gpdma_registers;
+
+/* === Public function definitions ================================================================================= */
+
+#if CHIP_FAKE_MODEL
+
+void Chip_GPIO_SetPinState(LPC_GPIO_T * gpio, uint8_t port, uint8_t pin, bool setting) {
+    gpio->B[port][pin] = setting;
+    if (setting) {
+        gpio->PIN[port] |= 1u << pin;
+    } else {
+        gpio->PIN[port] &= ~(1u << pin);
+    }
+    LogWrite(CHIP_FAKE_GPIO_B, port, pin, setting);
+}
+
+bool Chip_GPIO_GetPinState(LPC_GPIO_T * gpio, uint8_t port, uint8_t pin) {
+    return gpio->B[port][pin] != 0;
+}
+
+void Chip_GPIO_WritePortBit(LPC_GPIO_T * gpio, uint32_t port, uint8_t pin, bool setting) {
+    Chip_GPIO_SetPinState(gpio, (uint8_t)port, pin, setting);
+}
+
+bool Chip_GPIO_ReadPortBit(LPC_GPIO_T * gpio, uint32_t port, uint8_t pin) {
+    return gpio->B[port][pin] != 0;
+}
+
+void Chip_GPIO_SetPinDIR(LPC_GPIO_T * gpio, uint8_t port, uint8_t pin, bool output) {
+    /* LPCOpen lee, modifica y escribe el registro de direccion */
+    if (output) {
+        gpio->DIR[port] |= 1u << pin;
+    } else {
+        gpio->DIR[port] &= ~(1u << pin);
+    }
+    LogWrite(CHIP_FAKE_GPIO_DIR, port, pin, gpio->DIR[port]);
+}
+
+void Chip_GPIO_SetPinDIROutput(LPC_GPIO_T * gpio, uint8_t port, uint8_t pin) {
+    Chip_GPIO_SetPinDIR(gpio, port, pin, true);
+}
+
+void Chip_GPIO_SetPinDIRInput(LPC_GPIO_T * gpio, uint8_t port, uint8_t pin) {
+    Chip_GPIO_SetPinDIR(gpio, port, pin, false);
+}
+
+void Chip_GPIO_SetPortDIROutput(LPC_GPIO_T * gpio, uint8_t port, uint32_t pins) {
+    gpio->DIR[port] |= pins;
+    LogWrite(CHIP_FAKE_GPIO_DIR, port, 0, gpio->DIR[port]);
+}
+
+void Chip_GPIO_SetPinToggle(LPC_GPIO_T * gpio, uint8_t port, uint8_t pin) {
+    gpio->NOT[port] = 1u << pin;
+    gpio->PIN[port] ^= 1u << pin;
+    gpio->B[port][pin] = (gpio->PIN[port] >> pin) & 1u;
+    LogWrite(CHIP_FAKE_GPIO_NOT, port, pin, 1u << pin);
+}
+
+void Chip_GPIO_SetValue(LPC_GPIO_T * gpio, uint8_t port, uint32_t bitValue) {
+    gpio->SET[port] = bitValue;
+    gpio->PIN[port] |= bitValue;
+    for (uint8_t pin = 0; pin < 32; pin++) {
+        if (bitValue & (1u << pin)) {
+            gpio->B[port][pin] = 1;
+        }
+    }
+    LogWrite(CHIP_FAKE_GPIO_SET, port, 0, bitValue);
+}
+
+void Chip_GPIO_ClearValue(LPC_GPIO_T * gpio, uint8_t port, uint32_t bitValue) {
+    gpio->CLR[port] = bitValue;
+    gpio->PIN[port] &= ~bitValue;
+    for (uint8_t pin = 0; pin < 32; pin++) {
+        if (bitValue & (1u << pin)) {
+            gpio->B[port][pin] = 0;
+        }
+    }
+    LogWrite(CHIP_FAKE_GPIO_CLR, port, 0, bitValue);
+}
+
+void Chip_GPIO_SetPortMask(LPC_GPIO_T * gpio, uint8_t port, uint32_t mask) {
+    gpio->MASK[port] = mask;
+    LogWrite(CHIP_FAKE_GPIO_MASK, port, 0, mask);
+}
+
+void Chip_GPIO_SetMaskedPortValue(LPC_GPIO_T * gpio, uint8_t port, uint32_t value) {
+    /* Los bits en 1 de MASK no se modifican al escribir MPIN */
+    uint32_t pins = ~gpio->MASK[port];
+
+    if (!irq_masked) {
+        masked_write_unmasked = true;
+    }
+    gpio->MPIN[port] = value;
+    gpio->PIN[port] = (gpio->PIN[port] & ~pins) | (value & pins);
+    for (uint8_t pin = 0; pin < 32; pin++) {
+        gpio->B[port][pin] = (gpio->PIN[port] >> pin) & 1u;
+    }
+    LogWrite(CHIP_FAKE_GPIO_MPIN, port, 0, value);
+}
+
+#endif
+
+void Chip_SCU_PinMuxSet(uint8_t port, uint8_t pin, uint16_t modefunc) {
+    scu_registers.SFSP[port][pin] = modefunc;
+    LogWrite(CHIP_FAKE_SCU_SFS, port, pin, modefunc);
+}
+
+uint32_t Chip_Clock_GetRate(CHIP_CCU_CLK_T clock) {
+    (void)clock;
+    return CHIP_FAKE_CLOCK_HZ;
+}
+
+void Chip_TIMER_Init(LPC_TIMER_T * timer) {
+    /* LPCOpen solo habilita el reloj del periferico, sin escribir registros del temporizador */
+    (void)timer;
+}
+
+void Chip_TIMER_PrescaleSet(LPC_TIMER_T * timer, uint32_t prescale) {
+    timer->PR = prescale;
+    LogWrite(CHIP_FAKE_TIMER_PR, TimerUnit(timer), 0, prescale);
+}
+
+void Chip_TIMER_SetMatch(LPC_TIMER_T * timer, int8_t match, uint32_t value) {
+    timer->MR[match] = value;
+    LogWrite(CHIP_FAKE_TIMER_MR, TimerUnit(timer), (uint8_t)match, value);
+}
+
+void Chip_TIMER_MatchEnableInt(LPC_TIMER_T * timer, int8_t match) {
+    timer->MCR |= TIMER_MATCH_INT(match);
+    LogWrite(CHIP_FAKE_TIMER_MCR, TimerUnit(timer), (uint8_t)match, timer->MCR);
+}
+
+void Chip_TIMER_Reset(LPC_TIMER_T * timer) {
+    /* LPCOpen pone el bit de reinicio, espera que la cuenta llegue a cero y restaura TCR */
+    timer->TC = 0;
+    timer->PC = 0;
+    LogWrite(CHIP_FAKE_TIMER_TCR, TimerUnit(timer), 0, timer->TCR);
+}
+
+void Chip_TIMER_Enable(LPC_TIMER_T * timer) {
+    timer->TCR |= TIMER_ENABLE;
+    LogWrite(CHIP_FAKE_TIMER_TCR, TimerUnit(timer), 0, timer->TCR);
+}
+
+void Chip_TIMER_Disable(LPC_TIMER_T * timer) {
+    timer->TCR &= ~TIMER_ENABLE;
+    LogWrite(CHIP_FAKE_TIMER_TCR, TimerUnit(timer), 0, timer->TCR);
+}
+
+bool Chip_TIMER_MatchPending(LPC_TIMER_T * timer, int8_t match) {
+    return (timer->IR & (1u << match)) != 0;
+}
+
+void Chip_TIMER_ClearMatch(LPC_TIMER_T * timer, int8_t match) {
+    timer->IR &= ~(1u << match);
+    LogWrite(CHIP_FAKE_TIMER_IR, TimerUnit(timer), (uint8_t)match, 1u << match);
+}
+
+uint32_t Chip_TIMER_ReadCount(LPC_TIMER_T * timer) {
+    return timer->TC;
+}
+
+void NVIC_EnableIRQ(IRQn_Type irq) {
+    irq_enabled[irq] = true;
+    LogWrite(CHIP_FAKE_NVIC_ISER, (uint8_t)irq, 0, 1);
+}
+
+void NVIC_DisableIRQ(IRQn_Type irq) {
+    irq_enabled[irq] = false;
+    LogWrite(CHIP_FAKE_NVIC_ICER, (uint8_t)irq, 0, 1);
+}
+
+void NVIC_ClearPendingIRQ(IRQn_Type irq) {
+    LogWrite(CHIP_FAKE_NVIC_ICPR, (uint8_t)irq, 0, 1);
+}
+
+void NVIC_SetPriority(IRQn_Type irq, uint32_t priority) {
+    LogWrite(CHIP_FAKE_NVIC_IPR, (uint8_t)irq, 0, priority);
+}
+
+void __disable_irq(void) {
+    irq_masked = true;
+}
+
+void __enable_irq(void) {
+    irq_masked = false;
+}
+
+void Chip_WWDT_Init(LPC_WWDT_T * wwdt) {
+    wwdt->MOD = 0;
+    LogWrite(CHIP_FAKE_WWDT_MOD, 0, 0, wwdt->MOD);
+    wwdt->TC = 0xFF;
+    LogWrite(CHIP_FAKE_WWDT_TC, 0, 0, wwdt->TC);
+}
+
+void Chip_WWDT_SetTimeOut(LPC_WWDT_T * wwdt, uint32_t timeout) {
+    wwdt->TC = timeout;
+    LogWrite(CHIP_FAKE_WWDT_TC, 0, 0, timeout);
+}
+
+void Chip_WWDT_SetOption(LPC_WWDT_T * wwdt, uint32_t options) {
+    wwdt->MOD |= options;
+    LogWrite(CHIP_FAKE_WWDT_MOD, 0, 0, wwdt->MOD);
+}
+
+void Chip_WWDT_Start(LPC_WWDT_T * wwdt) {
+    /* El perro guardian arranca con la primera alimentacion despues de habilitarlo, que no puede interrumpir una cuenta
+     * en curso y por eso no se verifica que las interrupciones esten enmascaradas */
+    wwdt->MOD |= WWDT_WDMOD_WDEN;
+    LogWrite(CHIP_FAKE_WWDT_MOD, 0, 0, wwdt->MOD);
+    wwdt->FEED = 0x55;
+    wwdt->TV = wwdt->TC;
+    LogWrite(CHIP_FAKE_WWDT_FEED, 0, 0, wwdt->TC);
+}
+
+void Chip_WWDT_Feed(LPC_WWDT_T * wwdt) {
+    /* En el microcontrolador la secuencia 0xAA, 0x55 no debe interrumpirse entre las dos escrituras */
+    if (!irq_masked) {
+        watchdog_fed_unmasked = true;
+    }
+    wwdt->FEED = 0x55;
+    wwdt->TV = wwdt->TC;
+    LogWrite(CHIP_FAKE_WWDT_FEED, 0, 0, wwdt->TC);
+}
+
+void Chip_SSP_Init(LPC_SSP_T * ssp) {
+    (void)ssp;
+}
+
+void Chip_SSP_SetFormat(LPC_SSP_T * ssp, uint32_t bits, uint32_t format, uint32_t mode) {
+    ssp->CR0 = bits | format | mode;
+    LogWrite(CHIP_FAKE_SSP, 0, 0, ssp->CR0);
+}
+
+void Chip_SSP_SetBitRate(LPC_SSP_T * ssp, uint32_t bitrate) {
+    ssp->CPSR = CHIP_FAKE_CLOCK_HZ / bitrate;
+    LogWrite(CHIP_FAKE_SSP, 0, 2, ssp->CPSR);
+}
+
+void Chip_SSP_Enable(LPC_SSP_T * ssp) {
+    ssp->CR1 |= SSP_ENABLE;
+    LogWrite(CHIP_FAKE_SSP, 0, 1, ssp->CR1);
+}
+
+void Chip_SSP_DMA_Enable(LPC_SSP_T * ssp) {
+    ssp->DMACR |= SSP_DMA_TX;
+    LogWrite(CHIP_FAKE_SSP, 0, 3, ssp->DMACR);
+}
+
+void Chip_GPDMA_Init(LPC_GPDMA_T * dma) {
+    (void)dma;
+}
+
+uint8_t Chip_GPDMA_GetFreeChannel(LPC_GPDMA_T * dma, uint32_t peripheral) {
+    (void)dma;
+    (void)peripheral;
+    return 0;
+}
+
+int Chip_GPDMA_InitDescriptor(LPC_GPDMA_T * dma, DMA_TransferDescriptor_t * descriptor, uint32_t source,
+                              uint32_t destination, uint32_t size, GPDMA_FLOW_CONTROL_T type,
+                              const DMA_TransferDescriptor_t * next) {
+    (void)dma;
+    (void)type;
+    descriptor->src = source;
+    descriptor->dst = destination;
+    descriptor->lli = (uint32_t)(uintptr_t)next;
+    descriptor->ctrl = size & 0xFFF;
+    return 1;
+}
+
+int Chip_GPDMA_SGTransfer(LPC_GPDMA_T * dma, uint8_t channel, const DMA_TransferDescriptor_t * descriptor,
+                          GPDMA_FLOW_CONTROL_T type) {
+    /* La transferencia termina en el acto, por lo que el canal nunca queda ocupado */
+    (void)dma;
+    (void)type;
+    LogWrite(CHIP_FAKE_GPDMA, channel, 0, descriptor->ctrl & 0xFFF);
+    return 1;
+}
+
+void ChipFakeReset(void) {
+    memset(&gpio_registers, 0, sizeof(gpio_registers));
+    memset(&scu_registers, 0, sizeof(scu_registers));
+    memset(timer_registers, 0, sizeof(timer_registers));
+    memset(&wwdt_registers, 0, sizeof(wwdt_registers));
+    memset(&ssp_registers, 0, sizeof(ssp_registers));
+    memset(&gpdma_registers, 0, sizeof(gpdma_registers));
+    memset(irq_enabled, 0, sizeof(irq_enabled));
+    irq_masked = false;
+    watchdog_expired = false;
+    watchdog_fed_unmasked = false;
+    masked_write_unmasked = false;
+    writes = 0;
+    now = 0;
+}
+
+uint32_t ChipFakeGetWrites(void) {
+    return writes;
+}
+
+const chip_fake_write_t * ChipFakeGetWrite(uint32_t index) {
+    if (index >= writes || index >= CHIP_FAKE_LOG_SIZE) {
+        return NULL;
+    }
+    return &write_log[index];
+}
+
+void ChipFakeAdvance(uint32_t microseconds) {
+    now += microseconds;
+    for (uint8_t timer = 0; timer < TIMERS; timer++) {
+        TimerAdvance(&timer_registers[timer], microseconds);
+    }
+    if (wwdt_registers.MOD & WWDT_WDMOD_WDEN) {
+        uint32_t ticks = microseconds * (CHIP_FAKE_WWDT_HZ / 1000000UL);
+        if (wwdt_registers.TV <= ticks) {
+            wwdt_registers.TV = 0;
+            watchdog_expired = true;
+        } else {
+            wwdt_registers.TV -= ticks;
+        }
+    }
+}
+
+uint32_t ChipFakeGetTime(void) {
+    return now;
+}
+
+void ChipFakeSetPin(uint8_t port, uint8_t pin, bool level) {
+    if (level) {
+        gpio_registers.PIN[port] |= 1u << pin;
+    } else {
+        gpio_registers.PIN[port] &= ~(1u << pin);
+    }
+    gpio_registers.B[port][pin] = level;
+}
+
+bool ChipFakeIrqEnabled(IRQn_Type irq) {
+    return irq_enabled[irq];
+}
+
+bool ChipFakeWatchdogExpired(void) {
+    return watchdog_expired;
+}
+
+bool ChipFakeWatchdogFedUnmasked(void) {
+    return watchdog_fed_unmasked;
+}
+
+bool ChipFakeMaskedWriteUnmasked(void) {
+    return masked_write_unmasked;
+}
+
+/* === Private function definitions ================================================================================ */
+
+static void LogWrite(chip_fake_register_t reg, uint8_t unit, uint8_t index, uint32_t value) {
+    if (writes < CHIP_FAKE_LOG_SIZE) {
+        write_log[writes] = (chip_fake_write_t){
+            .time = now,
+            .reg = (uint8_t)reg,
+            .unit = unit,
+            .index = index,
+            .value = value,
+        };
+    }
+    writes++;
+}
+
+static uint8_t TimerUnit(const LPC_TIMER_T * timer) {
+    return (uint8_t)(timer - timer_registers);
+}
+
+static void TimerAdvance(LPC_TIMER_T * timer, uint32_t microseconds) {
+    uint64_t clocks;
+    uint32_t counts;
+    uint32_t start = timer->TC;
+
+    if ((timer->TCR & TIMER_ENABLE) == 0) {
+        return;
+    }
+    /* El divisor cuenta hasta PR y recien entonces incrementa TC, guardando el resto entre avances */
+    clocks = (uint64_t)microseconds * (CHIP_FAKE_CLOCK_HZ / 1000000UL) + timer->PC;
+    counts = (uint32_t)(clocks / ((uint64_t)timer->PR + 1));
+    timer->PC = (uint32_t)(clocks % ((uint64_t)timer->PR + 1));
+    timer->TC = start + counts;
+
+    for (uint8_t match = 0; match < 4; match++) {
+        /* El match se alcanza si MR esta entre la cuenta anterior, excluida, y la nueva, incluida */
+        if ((timer->MCR & TIMER_MATCH_INT(match)) && (uint32_t)(timer->MR[match] - start - 1u) < counts) {
+            timer->IR |= 1u << match;
+        }
+    }
+}
+
+/* === End of documentation ======================================================================================== */
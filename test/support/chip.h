@@ -0,0 +1,439 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Martin Nicolas Soria <soria.m.nicolas@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, disponiblestribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+#ifndef CHIP_H_
+#define CHIP_H_
+
+/** @file chip.h
+ ** @brief Reemplazo para el host de las definiciones de LPCOpen usadas por bsp.c y los modulos de entradas y salidas.
+ **
+ ** Modela los registros de los perifericos que usa la placa: los puertos GPIO (B, DIR, MASK, PIN, MPIN, SET, CLR y
+ ** NOT), la seleccion de funcion de los pines del SCU, los cuatro temporizadores, el NVIC, el perro guardian y lo
+ ** minimo de SSP1 y del DMA para la pantalla MAX7219. Cada escritura a un registro queda en un registro de escrituras
+ ** con la marca del tiempo simulado, que avanza solo con ChipFakeAdvance, asi las pruebas pueden comparar formas de
+ ** onda, cantidad de accesos y orden de configuracion. Los temporizadores cuentan con ese mismo tiempo.
+ **
+ ** Con CHIP_FAKE_MODEL en 0 los accesos GPIO son las mismas funciones en linea de LPCOpen, sin modelo ni registro de
+ ** escrituras, para contar las instrucciones que generan los modulos.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/** @brief Modela y registra los accesos GPIO (1) o los deja como almacenamientos en linea (0) */
+#ifndef CHIP_FAKE_MODEL
+#define CHIP_FAKE_MODEL 1
+#endif
+
+/** @brief Escrituras que se guardan en el registro; las siguientes solo se cuentan */
+#define CHIP_FAKE_LOG_SIZE 1024
+
+/** @brief Frecuencia de los relojes de los perifericos que informa Chip_Clock_GetRate */
+#define CHIP_FAKE_CLOCK_HZ 204000000UL
+
+/** @brief Frecuencia con que cuenta el perro guardian, el oscilador interno dividido por cuatro */
+#define CHIP_FAKE_WWDT_HZ 3000000UL
+
+#define SCU_MODE_FUNC0             0x0
+#define SCU_MODE_FUNC1             0x1
+#define SCU_MODE_FUNC2             0x2
+#define SCU_MODE_FUNC3             0x3
+#define SCU_MODE_FUNC4             0x4
+#define SCU_MODE_FUNC5             0x5
+#define SCU_MODE_FUNC6             0x6
+#define SCU_MODE_FUNC7             0x7
+#define SCU_MODE_PULLUP            (0x0 << 3)
+#define SCU_MODE_REPEATER          (0x1 << 3)
+#define SCU_MODE_INACT             (0x2 << 3)
+#define SCU_MODE_PULLDOWN          (0x3 << 3)
+#define SCU_MODE_HIGHSPEEDSLEW_EN  (0x1 << 5)
+#define SCU_MODE_INBUFF_EN         (0x1 << 6)
+#define SCU_MODE_ZIF_DIS           (0x1 << 7)
+
+#define WWDT_WDMOD_WDEN    (1 << 0)
+#define WWDT_WDMOD_WDRESET (1 << 1)
+
+#define GPDMA_CONN_SSP1_Tx                    12
+#define GPDMA_WIDTH_HALFWORD                  1
+#define GPDMA_DMACCxControl_SWidth(n)         (((n) & 0x07) << 18)
+#define GPDMA_DMACCxControl_DWidth(n)         (((n) & 0x07) << 21)
+
+/* === Public data type declarations =============================================================================== */
+
+/** @brief Bloque de registros GPIO con la misma disposicion que en el LPC43xx */
+typedef struct {
+    volatile uint8_t B[128][32];  /**< Un byte por pin */
+    volatile uint32_t W[32][32];  /**< Una palabra por pin */
+    volatile uint32_t DIR[32];    /**< Direccion de cada puerto */
+    volatile uint32_t MASK[32];   /**< Mascara de los accesos por MPIN */
+    volatile uint32_t PIN[32];    /**< Estado de cada puerto */
+    volatile uint32_t MPIN[32];   /**< Estado de cada puerto filtrado por MASK */
+    volatile uint32_t SET[32];    /**< Activa los bits escritos */
+    volatile uint32_t CLR[32];    /**< Borra los bits escritos */
+    volatile uint32_t NOT[32];    /**< Invierte los bits escritos */
+} LPC_GPIO_T;
+
+/** @brief Registros de seleccion de funcion y modo de cada pin */
+typedef struct {
+    volatile uint32_t SFSP[16][32]; /**< Un registro por pin de cada grupo */
+} LPC_SCU_T;
+
+/** @brief Registros de un temporizador */
+typedef struct {
+    volatile uint32_t IR;    /**< Interrupciones pendientes, una por match */
+    volatile uint32_t TCR;   /**< Habilitacion (bit 0) y reinicio (bit 1) */
+    volatile uint32_t TC;    /**< Cuenta */
+    volatile uint32_t PR;    /**< Divisor del reloj menos uno */
+    volatile uint32_t PC;    /**< Cuenta del divisor */
+    volatile uint32_t MCR;   /**< Acciones de cada match, tres bits por canal */
+    volatile uint32_t MR[4]; /**< Valores de match */
+} LPC_TIMER_T;
+
+/** @brief Registros del perro guardian */
+typedef struct {
+    volatile uint32_t MOD;  /**< Modo: habilitacion y reinicio */
+    volatile uint32_t TC;   /**< Cuenta de recarga */
+    volatile uint32_t FEED; /**< Secuencia de alimentacion 0xAA, 0x55 */
+    volatile uint32_t TV;   /**< Cuenta actual */
+} LPC_WWDT_T;
+
+/** @brief Registros de SSP usados por la pantalla MAX7219 */
+typedef struct {
+    volatile uint32_t CR0;  /**< Formato de las tramas */
+    volatile uint32_t CR1;  /**< Habilitacion */
+    volatile uint32_t CPSR; /**< Divisor del reloj */
+    volatile uint32_t DMACR; /**< Habilitacion del DMA */
+} LPC_SSP_T;
+
+/** @brief Registros del DMA usados por la pantalla MAX7219 */
+typedef struct {
+    volatile uint32_t ENBLDCHNS; /**< Canales con una transferencia en curso */
+} LPC_GPDMA_T;
+
+/** @brief Descriptor de una transferencia por DMA */
+typedef struct {
+    uint32_t src;  /**< Origen */
+    uint32_t dst;  /**< Destino */
+    uint32_t lli;  /**< Siguiente descriptor */
+    uint32_t ctrl; /**< Control, con la cantidad y el ancho de cada transferencia */
+} DMA_TransferDescriptor_t;
+
+typedef enum { GPDMA_TRANSFERTYPE_M2P_CONTROLLER_DMA = 1 } GPDMA_FLOW_CONTROL_T;
+typedef enum { SSP_BITS_8 = 7, SSP_BITS_16 = 15 } SSP_BITS_T;
+typedef enum { SSP_FRAMEFORMAT_SPI = 0 } SSP_FRAME_FORMAT_T;
+typedef enum { SSP_CLOCK_CPHA0_CPOL0 = 0 } SSP_CLOCK_MODE_T;
+
+/** @brief Interrupciones del LPC43xx usadas por la placa */
+typedef enum {
+    TIMER0_IRQn = 12,
+    TIMER1_IRQn = 13,
+    TIMER2_IRQn = 14,
+    TIMER3_IRQn = 15,
+    CHIP_FAKE_IRQS = 64,
+} IRQn_Type;
+
+/** @brief Relojes de los perifericos */
+typedef enum { CLK_MX_TIMER0, CLK_MX_TIMER1, CLK_MX_TIMER2, CLK_MX_TIMER3, CLK_MX_SSP1 } CHIP_CCU_CLK_T;
+
+/** @brief Registro escrito, en cada entrada del registro de escrituras */
+typedef enum {
+    CHIP_FAKE_GPIO_B,    //!< unit: puerto, index: pin, value: nivel
+    CHIP_FAKE_GPIO_DIR,  //!< unit: puerto, value: registro completo despues de la escritura
+    CHIP_FAKE_GPIO_MASK, //!< unit: puerto
+    CHIP_FAKE_GPIO_MPIN, //!< unit: puerto
+    CHIP_FAKE_GPIO_SET,  //!< unit: puerto, value: bits activados
+    CHIP_FAKE_GPIO_CLR,  //!< unit: puerto, value: bits borrados
+    CHIP_FAKE_GPIO_NOT,  //!< unit: puerto, value: bits invertidos
+    CHIP_FAKE_SCU_SFS,   //!< unit: grupo, index: pin, value: modo y funcion
+    CHIP_FAKE_TIMER_IR,  //!< unit: temporizador, value: interrupciones borradas
+    CHIP_FAKE_TIMER_TCR, //!< unit: temporizador
+    CHIP_FAKE_TIMER_PR,  //!< unit: temporizador
+    CHIP_FAKE_TIMER_MCR, //!< unit: temporizador
+    CHIP_FAKE_TIMER_MR,  //!< unit: temporizador, index: canal
+    CHIP_FAKE_NVIC_ISER, //!< unit: interrupcion habilitada
+    CHIP_FAKE_NVIC_ICER, //!< unit: interrupcion deshabilitada
+    CHIP_FAKE_NVIC_ICPR, //!< unit: interrupcion cuyo pendiente se borra
+    CHIP_FAKE_NVIC_IPR,  //!< unit: interrupcion, value: prioridad
+    CHIP_FAKE_WWDT_MOD,  //!< value: modo
+    CHIP_FAKE_WWDT_TC,   //!< value: cuenta de recarga
+    CHIP_FAKE_WWDT_FEED, //!< Secuencia de alimentacion completa
+    CHIP_FAKE_SSP,       //!< index: 0 CR0, 1 CR1, 2 CPSR, 3 DMACR
+    CHIP_FAKE_GPDMA,     //!< unit: canal, value: cantidad de transferencias iniciadas
+} chip_fake_register_t;
+
+/** @brief Entrada del registro de escrituras */
+typedef struct chip_fake_write_s {
+    uint32_t time;  //!< Tiempo simulado de la escritura, en microsegundos
+    uint8_t reg;    //!< Registro escrito, chip_fake_register_t
+    uint8_t unit;   //!< Puerto, grupo, temporizador o interrupcion
+    uint8_t index;  //!< Pin o canal, si corresponde
+    uint32_t value; //!< Valor escrito
+} chip_fake_write_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/** @brief Bloques de registros simulados */
+extern LPC_GPIO_T * LPC_GPIO_PORT;
+extern LPC_SCU_T * LPC_SCU;
+extern LPC_TIMER_T * LPC_TIMER0;
+extern LPC_TIMER_T * LPC_TIMER1;
+extern LPC_TIMER_T * LPC_TIMER2;
+extern LPC_TIMER_T * LPC_TIMER3;
+extern LPC_WWDT_T * LPC_WWDT;
+extern LPC_SSP_T * LPC_SSP1;
+extern LPC_GPDMA_T * LPC_GPDMA;
+
+/* === Public function declarations ================================================================================ */
+
+#if CHIP_FAKE_MODEL
+
+void Chip_GPIO_SetPinState(LPC_GPIO_T * gpio, uint8_t port, uint8_t pin, bool setting);
+
+bool Chip_GPIO_GetPinState(LPC_GPIO_T * gpio, uint8_t port, uint8_t pin);
+
+void Chip_GPIO_WritePortBit(LPC_GPIO_T * gpio, uint32_t port, uint8_t pin, bool setting);
+
+bool Chip_GPIO_ReadPortBit(LPC_GPIO_T * gpio, uint32_t port, uint8_t pin);
+
+void Chip_GPIO_SetPinDIR(LPC_GPIO_T * gpio, uint8_t port, uint8_t pin, bool output);
+
+void Chip_GPIO_SetPinDIROutput(LPC_GPIO_T * gpio, uint8_t port, uint8_t pin);
+
+void Chip_GPIO_SetPinDIRInput(LPC_GPIO_T * gpio, uint8_t port, uint8_t pin);
+
+void Chip_GPIO_SetPortDIROutput(LPC_GPIO_T * gpio, uint8_t port, uint32_t pins);
+
+void Chip_GPIO_SetPinToggle(LPC_GPIO_T * gpio, uint8_t port, uint8_t pin);
+
+void Chip_GPIO_SetValue(LPC_GPIO_T * gpio, uint8_t port, uint32_t bitValue);
+
+void Chip_GPIO_ClearValue(LPC_GPIO_T * gpio, uint8_t port, uint32_t bitValue);
+
+void Chip_GPIO_SetPortMask(LPC_GPIO_T * gpio, uint8_t port, uint32_t mask);
+
+void Chip_GPIO_SetMaskedPortValue(LPC_GPIO_T * gpio, uint8_t port, uint32_t value);
+
+#else
+
+/* Los mismos accesos que las funciones en linea de gpio_18xx_43xx.h de LPCOpen */
+
+static inline void Chip_GPIO_SetPinState(LPC_GPIO_T * gpio, uint8_t port, uint8_t pin, bool setting) {
+    gpio->B[port][pin] = setting;
+}
+
+static inline bool Chip_GPIO_GetPinState(LPC_GPIO_T * gpio, uint8_t port, uint8_t pin) {
+    return (bool)gpio->B[port][pin];
+}
+
+static inline void Chip_GPIO_WritePortBit(LPC_GPIO_T * gpio, uint32_t port, uint8_t pin, bool setting) {
+    gpio->B[port][pin] = setting;
+}
+
+static inline bool Chip_GPIO_ReadPortBit(LPC_GPIO_T * gpio, uint32_t port, uint8_t pin) {
+    return (bool)gpio->B[port][pin];
+}
+
+static inline void Chip_GPIO_SetPinDIR(LPC_GPIO_T * gpio, uint8_t port, uint8_t pin, bool output) {
+    if (output) {
+        gpio->DIR[port] |= 1UL << pin;
+    } else {
+        gpio->DIR[port] &= ~(1UL << pin);
+    }
+}
+
+static inline void Chip_GPIO_SetPinDIROutput(LPC_GPIO_T * gpio, uint8_t port, uint8_t pin) {
+    gpio->DIR[port] |= 1UL << pin;
+}
+
+static inline void Chip_GPIO_SetPinDIRInput(LPC_GPIO_T * gpio, uint8_t port, uint8_t pin) {
+    gpio->DIR[port] &= ~(1UL << pin);
+}
+
+static inline void Chip_GPIO_SetPortDIROutput(LPC_GPIO_T * gpio, uint8_t port, uint32_t pins) {
+    gpio->DIR[port] |= pins;
+}
+
+static inline void Chip_GPIO_SetPinToggle(LPC_GPIO_T * gpio, uint8_t port, uint8_t pin) {
+    gpio->NOT[port] = 1UL << pin;
+}
+
+static inline void Chip_GPIO_SetValue(LPC_GPIO_T * gpio, uint8_t port, uint32_t bitValue) {
+    gpio->SET[port] = bitValue;
+}
+
+static inline void Chip_GPIO_ClearValue(LPC_GPIO_T * gpio, uint8_t port, uint32_t bitValue) {
+    gpio->CLR[port] = bitValue;
+}
+
+static inline void Chip_GPIO_SetPortMask(LPC_GPIO_T * gpio, uint8_t port, uint32_t mask) {
+    gpio->MASK[port] = mask;
+}
+
+static inline void Chip_GPIO_SetMaskedPortValue(LPC_GPIO_T * gpio, uint8_t port, uint32_t value) {
+    gpio->MPIN[port] = value;
+}
+
+#endif
+
+void Chip_SCU_PinMuxSet(uint8_t port, uint8_t pin, uint16_t modefunc);
+
+uint32_t Chip_Clock_GetRate(CHIP_CCU_CLK_T clock);
+
+void Chip_TIMER_Init(LPC_TIMER_T * timer);
+
+void Chip_TIMER_PrescaleSet(LPC_TIMER_T * timer, uint32_t prescale);
+
+void Chip_TIMER_SetMatch(LPC_TIMER_T * timer, int8_t match, uint32_t value);
+
+void Chip_TIMER_MatchEnableInt(LPC_TIMER_T * timer, int8_t match);
+
+void Chip_TIMER_Reset(LPC_TIMER_T * timer);
+
+void Chip_TIMER_Enable(LPC_TIMER_T * timer);
+
+void Chip_TIMER_Disable(LPC_TIMER_T * timer);
+
+bool Chip_TIMER_MatchPending(LPC_TIMER_T * timer, int8_t match);
+
+void Chip_TIMER_ClearMatch(LPC_TIMER_T * timer, int8_t match);
+
+uint32_t Chip_TIMER_ReadCount(LPC_TIMER_T * timer);
+
+void NVIC_EnableIRQ(IRQn_Type irq);
+
+void NVIC_DisableIRQ(IRQn_Type irq);
+
+void NVIC_ClearPendingIRQ(IRQn_Type irq);
+
+void NVIC_SetPriority(IRQn_Type irq, uint32_t priority);
+
+void __disable_irq(void);
+
+void __enable_irq(void);
+
+void Chip_WWDT_Init(LPC_WWDT_T * wwdt);
+
+void Chip_WWDT_SetTimeOut(LPC_WWDT_T * wwdt, uint32_t timeout);
+
+void Chip_WWDT_SetOption(LPC_WWDT_T * wwdt, uint32_t options);
+
+void Chip_WWDT_Start(LPC_WWDT_T * wwdt);
+
+void Chip_WWDT_Feed(LPC_WWDT_T * wwdt);
+
+void Chip_SSP_Init(LPC_SSP_T * ssp);
+
+void Chip_SSP_SetFormat(LPC_SSP_T * ssp, uint32_t bits, uint32_t format, uint32_t mode);
+
+void Chip_SSP_SetBitRate(LPC_SSP_T * ssp, uint32_t bitrate);
+
+void Chip_SSP_Enable(LPC_SSP_T * ssp);
+
+void Chip_SSP_DMA_Enable(LPC_SSP_T * ssp);
+
+void Chip_GPDMA_Init(LPC_GPDMA_T * dma);
+
+uint8_t Chip_GPDMA_GetFreeChannel(LPC_GPDMA_T * dma, uint32_t peripheral);
+
+int Chip_GPDMA_InitDescriptor(LPC_GPDMA_T * dma, DMA_TransferDescriptor_t * descriptor, uint32_t source,
+                              uint32_t destination, uint32_t size, GPDMA_FLOW_CONTROL_T type,
+                              const DMA_TransferDescriptor_t * next);
+
+int Chip_GPDMA_SGTransfer(LPC_GPDMA_T * dma, uint8_t channel, const DMA_TransferDescriptor_t * descriptor,
+                          GPDMA_FLOW_CONTROL_T type);
+
+/**
+ * @brief Borra los registros simulados, el registro de escrituras y el tiempo simulado
+ */
+void ChipFakeReset(void);
+
+/**
+ * @brief Devuelve la cantidad de escrituras a registros desde el ultimo ChipFakeReset
+ *
+ * @return uint32_t Escrituras realizadas, incluidas las que ya no entran en el registro
+ */
+uint32_t ChipFakeGetWrites(void);
+
+/**
+ * @brief Devuelve una entrada del registro de escrituras
+ *
+ * @param index Numero de escritura desde el ultimo ChipFakeReset
+ * @return const chip_fake_write_t* Escritura, NULL si no existe o no entro en el registro
+ */
+const chip_fake_write_t * ChipFakeGetWrite(uint32_t index);
+
+/**
+ * @brief Avanza el tiempo simulado; los temporizadores habilitados cuentan y marcan sus match
+ *
+ * @param microseconds Tiempo a avanzar
+ */
+void ChipFakeAdvance(uint32_t microseconds);
+
+/**
+ * @brief Devuelve el tiempo simulado en microsegundos desde el ultimo ChipFakeReset
+ */
+uint32_t ChipFakeGetTime(void);
+
+/**
+ * @brief Fija el nivel de un pin como si lo manejara un circuito externo, sin registrar una escritura
+ *
+ * @param port Puerto del pin
+ * @param pin Numero de pin dentro del puerto
+ * @param level Nivel del pin
+ */
+void ChipFakeSetPin(uint8_t port, uint8_t pin, bool level);
+
+/**
+ * @brief Indica si una interrupcion esta habilitada en el NVIC
+ */
+bool ChipFakeIrqEnabled(IRQn_Type irq);
+
+/**
+ * @brief Indica si el perro guardian habilitado llego a cero sin alimentarse, lo que reiniciaria la placa
+ */
+bool ChipFakeWatchdogExpired(void);
+
+/**
+ * @brief Indica si alguna alimentacion del perro guardian se hizo con las interrupciones habilitadas
+ */
+bool ChipFakeWatchdogFedUnmasked(void);
+
+/**
+ * @brief Indica si alguna escritura por MPIN se hizo con las interrupciones habilitadas
+ */
+bool ChipFakeMaskedWriteUnmasked(void);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CHIP_H_ */
@@ -0,0 +1,263 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Martin Nicolas Soria <soria.m.nicolas@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, disponiblestribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file test_bsp.c
+ ** @brief Pruebas unitarias de la configuracion de la placa y de sus interrupciones sobre el modelo de registros.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "unity.h"
+#include "bsp.h"
+#include "chip.h"
+#include "digital.h"
+#include "pattern.h"
+#include "screen.h"
+
+/* === Macros definitions ========================================================================================== */
+
+#define REFRESH_PERIOD_US (1000000 / BSP_SCREEN_REFRESH_HZ) // Periodo del barrido de la pantalla
+#define DIGITS_PORT       0  // Puerto GPIO de los digitos
+#define SEGMENTS_PORT     2  // Puerto GPIO de los segmentos
+#define POINT_PORT        5  // Puerto GPIO del punto decimal
+#define POINT_BIT         16 // Bit GPIO del punto decimal
+#define KEYS_PORT         5  // Puerto GPIO de las teclas
+#define KEYS_MASK         ((0xFu << 12) | (0x3u << 8)) // Bits GPIO de las seis teclas
+#define WRITES_PER_DIGIT  7  // Escrituras de cada interrupcion del barrido
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+void TIMER0_IRQHandler(void);
+
+void TIMER1_IRQHandler(void);
+
+void TIMER2_IRQHandler(void);
+
+/**
+ * @brief Verifica una escritura del registro del modelo
+ */
+static void AssertWrite(uint32_t index, chip_fake_register_t reg, uint8_t unit, uint32_t value);
+
+/**
+ * @brief Cuenta las llamadas desde la interrupcion de los marcos
+ */
+static void FrameHandler(void);
+
+/* === Private variable definitions ================================================================================ */
+
+static board_t board;
+
+static uint32_t frames;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Public function definitions ============================================================================== */
+
+void setUp(void) {
+    ChipFakeReset();
+    board = board_create();
+    frames = 0;
+}
+
+/**
+ * @test Verifica que todos los pines se conectan en el SCU antes de la primera escritura a un puerto GPIO.
+ */
+void test_pins_are_muxed_before_gpio_setup(void) {
+    const chip_fake_write_t * write;
+    uint32_t muxed = 0;
+    bool gpio_started = false;
+
+    TEST_ASSERT_NOT_NULL(board);
+    for (uint32_t index = 0; (write = ChipFakeGetWrite(index)) != NULL; index++) {
+        if (write->reg == CHIP_FAKE_SCU_SFS) {
+            TEST_ASSERT_FALSE(gpio_started);
+            muxed++;
+        } else if (write->reg <= CHIP_FAKE_GPIO_NOT) {
+            gpio_started = true;
+        }
+    }
+    TEST_ASSERT_EQUAL_UINT32(18, muxed);
+    TEST_ASSERT_EQUAL_HEX32(SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SCU_MODE_FUNC0, LPC_SCU->SFSP[4][0]);
+    TEST_ASSERT_EQUAL_HEX32(SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SCU_MODE_FUNC4, LPC_SCU->SFSP[6][8]);
+}
+
+/**
+ * @test Verifica que las teclas quedan como entradas con resistencia de pull-up y buffer de entrada.
+ */
+void test_keys_are_pulled_up_inputs(void) {
+    TEST_ASSERT_EQUAL_HEX32(SCU_MODE_INBUFF_EN | SCU_MODE_PULLUP | SCU_MODE_FUNC4, LPC_SCU->SFSP[4][8]);
+    TEST_ASSERT_EQUAL_HEX32(SCU_MODE_INBUFF_EN | SCU_MODE_PULLUP | SCU_MODE_FUNC4, LPC_SCU->SFSP[6][7]);
+    TEST_ASSERT_EQUAL_HEX32(SCU_MODE_INBUFF_EN | SCU_MODE_PULLUP | SCU_MODE_FUNC4, LPC_SCU->SFSP[3][1]);
+    TEST_ASSERT_BITS_LOW(KEYS_MASK, LPC_GPIO_PORT->DIR[KEYS_PORT]);
+}
+
+/**
+ * @test Verifica que cada puerto de la pantalla se apaga con una escritura antes de habilitar sus salidas con otra.
+ */
+void test_display_outputs_are_cleared_before_enabled(void) {
+    const chip_fake_write_t * write;
+    uint32_t cleared[8] = {0};
+    uint32_t enabled[8] = {0};
+
+    for (uint32_t index = 0; (write = ChipFakeGetWrite(index)) != NULL; index++) {
+        if (write->reg == CHIP_FAKE_GPIO_CLR && enabled[write->unit] == 0) {
+            cleared[write->unit] |= write->value;
+        } else if (write->reg == CHIP_FAKE_GPIO_DIR && enabled[write->unit] == 0) {
+            /* Solo la primera escritura de cada puerto, las siguientes son de las salidas creadas despues */
+            TEST_ASSERT_EQUAL_HEX32(cleared[write->unit], write->value);
+            enabled[write->unit] = write->value;
+        }
+    }
+    TEST_ASSERT_EQUAL_HEX32(DIGITS_MASK, enabled[DIGITS_PORT]);
+    TEST_ASSERT_EQUAL_HEX32(SEGMENTS_MASK, enabled[SEGMENTS_PORT]);
+    TEST_ASSERT_EQUAL_HEX32(1u << POINT_BIT, enabled[POINT_PORT]);
+    TEST_ASSERT_BITS_LOW(DIGITS_MASK, LPC_GPIO_PORT->PIN[DIGITS_PORT]);
+}
+
+/**
+ * @test Verifica la forma de onda del barrido: en cada periodo se apagan los digitos, se cambian los segmentos y el
+ * punto, y se enciende un solo digito, sin otras escrituras en la interrupcion.
+ */
+void test_refresh_interrupt_multiplexes_one_digit_per_period(void) {
+    static const uint8_t SEGMENTS[] = {SEGMENT_A, SEGMENT_B | SEGMENT_P, SEGMENT_G, SEGMENT_D | SEGMENT_E};
+    static const uint32_t DIGIT_ON[] = {1u << 3, 1u << 2, 1u << 1, 1u << 0};
+    uint32_t start;
+
+    ScreenWriteSegments(board->screen, SEGMENTS, sizeof(SEGMENTS));
+    ScreenPublish(board->screen);
+    for (uint8_t digit = 0; digit < 4; digit++) {
+        ChipFakeAdvance(REFRESH_PERIOD_US);
+        TEST_ASSERT_TRUE(Chip_TIMER_MatchPending(LPC_TIMER0, 0));
+
+        start = ChipFakeGetWrites();
+        TIMER0_IRQHandler();
+        TEST_ASSERT_EQUAL_UINT32(WRITES_PER_DIGIT, ChipFakeGetWrites() - start);
+        AssertWrite(start, CHIP_FAKE_TIMER_IR, 0, 1);
+        AssertWrite(start + 1, CHIP_FAKE_GPIO_CLR, DIGITS_PORT, DIGITS_MASK);
+        AssertWrite(start + 2, CHIP_FAKE_GPIO_CLR, SEGMENTS_PORT, ~SEGMENTS[digit] & SEGMENTS_MASK);
+        AssertWrite(start + 3, CHIP_FAKE_GPIO_SET, SEGMENTS_PORT, SEGMENTS[digit] & SEGMENTS_MASK);
+        AssertWrite(start + 4, CHIP_FAKE_GPIO_B, POINT_PORT, (SEGMENTS[digit] & SEGMENT_P) != 0);
+        AssertWrite(start + 5, CHIP_FAKE_GPIO_SET, DIGITS_PORT, DIGIT_ON[digit]);
+        AssertWrite(start + 6, CHIP_FAKE_TIMER_MR, 0, (digit + 2u) * REFRESH_PERIOD_US);
+        TEST_ASSERT_EQUAL_UINT32((digit + 1u) * REFRESH_PERIOD_US, ChipFakeGetWrite(start + 5)->time);
+        TEST_ASSERT_EQUAL_HEX32(DIGIT_ON[digit], LPC_GPIO_PORT->PIN[DIGITS_PORT] & DIGITS_MASK);
+    }
+}
+
+/**
+ * @test Verifica que con la pantalla dormida no hay interrupciones del barrido y que al despertar vuelve a un periodo.
+ */
+void test_screen_sleep_stops_refresh_interrupt(void) {
+    uint32_t start;
+
+    board_screen_sleep(board);
+    TEST_ASSERT_FALSE(ChipFakeIrqEnabled(TIMER0_IRQn));
+    TEST_ASSERT_BITS_LOW(DIGITS_MASK, LPC_GPIO_PORT->PIN[DIGITS_PORT]);
+
+    start = ChipFakeGetWrites();
+    ChipFakeAdvance(10 * REFRESH_PERIOD_US);
+    TEST_ASSERT_FALSE(Chip_TIMER_MatchPending(LPC_TIMER0, 0));
+    TEST_ASSERT_EQUAL_UINT32(start, ChipFakeGetWrites());
+
+    board_screen_wake(board);
+    TEST_ASSERT_TRUE(ChipFakeIrqEnabled(TIMER0_IRQn));
+    ChipFakeAdvance(REFRESH_PERIOD_US - 1);
+    TEST_ASSERT_FALSE(Chip_TIMER_MatchPending(LPC_TIMER0, 0));
+    ChipFakeAdvance(1);
+    TEST_ASSERT_TRUE(Chip_TIMER_MatchPending(LPC_TIMER0, 0));
+}
+
+/**
+ * @test Verifica que el indicador de la alarma cambia desde la interrupcion de TIMER1 al ritmo de la secuencia.
+ */
+void test_alarm_pattern_toggles_led_from_interrupt(void) {
+    board_alarm_pattern(board, &PATTERN_BLINK);
+    TEST_ASSERT_TRUE(ChipFakeIrqEnabled(TIMER1_IRQn));
+    TEST_ASSERT_EQUAL_UINT8(0, LPC_GPIO_PORT->B[PONCHO_RGB_RED_GPIO][PONCHO_RGB_RED_BIT]);
+
+    ChipFakeAdvance(499000);
+    TEST_ASSERT_FALSE(Chip_TIMER_MatchPending(LPC_TIMER1, 0));
+    ChipFakeAdvance(1000);
+    TIMER1_IRQHandler();
+    TEST_ASSERT_EQUAL_UINT8(1, LPC_GPIO_PORT->B[PONCHO_RGB_RED_GPIO][PONCHO_RGB_RED_BIT]);
+
+    board_alarm_pattern(board, NULL);
+    TEST_ASSERT_FALSE(ChipFakeIrqEnabled(TIMER1_IRQn));
+    TEST_ASSERT_EQUAL_UINT8(1, LPC_GPIO_PORT->B[PONCHO_RGB_RED_GPIO][PONCHO_RGB_RED_BIT]);
+}
+
+/**
+ * @test Verifica que la interrupcion de los marcos llama a la funcion una vez por periodo, sin deriva.
+ */
+void test_frame_timer_calls_handler_each_period(void) {
+    board_frame_timer(1000, FrameHandler);
+    for (int i = 0; i < 10; i++) {
+        ChipFakeAdvance(1000);
+        TIMER2_IRQHandler();
+        TIMER2_IRQHandler();
+    }
+    TEST_ASSERT_EQUAL_UINT32(10, frames);
+    TEST_ASSERT_EQUAL_UINT32(11000, LPC_TIMER2->MR[0]);
+}
+
+/**
+ * @test Verifica que el contador libre cuenta microsegundos.
+ */
+void test_counter_counts_microseconds(void) {
+    board_counter_start();
+    uint32_t start = board_counter();
+    ChipFakeAdvance(1234);
+    TEST_ASSERT_EQUAL_UINT32(1234, board_counter() - start);
+}
+
+/**
+ * @test Verifica que el perro guardian reinicia solo si pasa el tiempo configurado sin alimentarlo, y que se alimenta
+ * con las interrupciones enmascaradas.
+ */
+void test_watchdog_resets_only_without_feed(void) {
+    board_watchdog_start(100);
+    ChipFakeAdvance(90000);
+    board_watchdog_feed();
+    ChipFakeAdvance(90000);
+    TEST_ASSERT_FALSE(ChipFakeWatchdogExpired());
+    TEST_ASSERT_FALSE(ChipFakeWatchdogFedUnmasked());
+
+    ChipFakeAdvance(10000);
+    TEST_ASSERT_TRUE(ChipFakeWatchdogExpired());
+}
+
+/* === Private function definitions ================================================================================ */
+
+static void AssertWrite(uint32_t index, chip_fake_register_t reg, uint8_t unit, uint32_t value) {
+    const chip_fake_write_t * write = ChipFakeGetWrite(index);
+
+    TEST_ASSERT_NOT_NULL(write);
+    TEST_ASSERT_EQUAL_UINT8(reg, write->reg);
+    TEST_ASSERT_EQUAL_UINT8(unit, write->unit);
+    TEST_ASSERT_EQUAL_HEX32(value, write->value);
+}
+
+static void FrameHandler(void) {
+    frames++;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -25,6 +25,8 @@ SPDX-License-Identifier: MIT
 
 #include "unity.h"
 #include "clock.h"
+#include "digital.h"
+#include "chip.h"
 
 /* === Macros definitions ========================================================================================== */
 
@@ -382,6 +384,120 @@ void test_is_alarm_enabled_or_disabled(void) {
     TEST_ASSERT_FALSE(ClockIsAlarmEnabled(clock));
 }
 
+/**
+ * @test Verifica que el indicador de alarma se enciende con AlarmLedOn aunque el LED sea activo en bajo.
+ */
+void test_alarm_led_follows_polarity(void) {
+    digital_output_t led = DigitalOutputCreate(0, 11, true);
+
+    AlarmLedOn(led);
+    TEST_ASSERT_TRUE(DigitalOutputGetIsActive(led));
+    TEST_ASSERT_EQUAL_UINT8(0, LPC_GPIO_PORT->B[0][11]);
+    AlarmLedOff(led);
+    TEST_ASSERT_FALSE(DigitalOutputGetIsActive(led));
+    TEST_ASSERT_EQUAL_UINT8(1, LPC_GPIO_PORT->B[0][11]);
+}
+
+/**
+ * @test Verifica que avanzar varios ticks de una vez arrastra los ticks sobrantes y pasa la medianoche.
+ */
+void test_advance_carries_ticks_across_midnight(void) {
+    ClockSetTime(clock, &(clock_time_t){.time = {.seconds = {0, 5}, .minutes = {9, 5}, .hours = {3, 2}}});
+    ClockAdvance(clock, CLOCK_TICKS_FOR_SECOND * 14 + 3);
+    ClockAdvance(clock, CLOCK_TICKS_FOR_SECOND - 3);
+    TEST_ASSERT_TIME(5, 0, 0, 0, 0, 0);
+}
+
+/**
+ * @test Verifica que avanzar una semana y un segundo de una vez deja la hora un segundo despues.
+ */
+void test_advance_one_week(void) {
+    ClockSetTime(clock, &(clock_time_t){.time = {.seconds = {0, 3}, .minutes = {4, 1}, .hours = {6, 0}}});
+    ClockAdvance(clock, CLOCK_TICKS_FOR_SECOND * (7UL * 24 * 60 * 60 + 1));
+    TEST_ASSERT_TIME(1, 3, 4, 1, 6, 0);
+}
+
+/**
+ * @test Verifica que la alarma suena aunque su hora quede en medio de un avance sin ticks.
+ */
+void test_advance_over_alarm_triggers_it(void) {
+    static const clock_time_t alarm_time = {.time = {.seconds = {0, 0}, .minutes = {1, 0}, .hours = {8, 0}}};
+    TEST_ASSERT_TRUE(ClockSetAlarm(clock, &alarm_time));
+
+    ClockSetTime(clock, &(clock_time_t){.time = {.seconds = {0, 0}, .minutes = {0, 0}, .hours = {8, 0}}});
+    ClockAdvance(clock, CLOCK_TICKS_FOR_SECOND * 59);
+    TEST_ASSERT_FALSE(ClockIsAlarmTriggered(clock));
+    ClockAdvance(clock, CLOCK_TICKS_FOR_SECOND * 60);
+    TEST_ASSERT_TRUE(ClockIsAlarmTriggered(clock));
+}
+
+/**
+ * @test Verifica que la posposicion se respeta cuando su hora queda en medio de un avance sin ticks.
+ */
+void test_advance_over_snooze_triggers_it(void) {
+    static const clock_time_t alarm_time = {.time = {.seconds = {0, 0}, .minutes = {1, 0}, .hours = {8, 0}}};
+    TEST_ASSERT_TRUE(ClockSetAlarm(clock, &alarm_time));
+
+    ClockSetTime(clock, &(clock_time_t){.time = {.seconds = {0, 0}, .minutes = {0, 0}, .hours = {8, 0}}});
+    ClockAdvance(clock, CLOCK_TICKS_FOR_SECOND * 60);
+    ClockSnooze(clock);
+    ClockAdvance(clock, CLOCK_TICKS_FOR_SECOND * 4 * 60);
+    TEST_ASSERT_FALSE(ClockIsAlarmTriggered(clock));
+    ClockAdvance(clock, CLOCK_TICKS_FOR_SECOND * 2 * 60);
+    TEST_ASSERT_TRUE(ClockIsAlarmTriggered(clock));
+}
+
+/**
+ * @test Verifica que una alarma cancelada vuelve a sonar si un avance sin ticks pasa la medianoche antes de su
+ * hora, y no si su hora llega antes de la medianoche.
+ */
+void test_advance_rearms_cancelled_alarm_after_midnight(void) {
+    static const clock_time_t alarm_time = {.time = {.seconds = {0, 0}, .minutes = {1, 0}, .hours = {8, 0}}};
+    TEST_ASSERT_TRUE(ClockSetAlarm(clock, &alarm_time));
+
+    ClockSetTime(clock, &(clock_time_t){.time = {.seconds = {0, 0}, .minutes = {0, 0}, .hours = {8, 0}}});
+    ClockAdvance(clock, CLOCK_TICKS_FOR_SECOND * 60);
+    ClockCancelAlarm(clock);
+    ClockAdvance(clock, CLOCK_TICKS_FOR_SECOND * 16UL * 60 * 60);
+    TEST_ASSERT_FALSE(ClockIsAlarmTriggered(clock));
+    ClockAdvance(clock, CLOCK_TICKS_FOR_SECOND * 8UL * 60 * 60);
+    TEST_ASSERT_TRUE(ClockIsAlarmTriggered(clock));
+}
+
+/**
+ * @test Verifica que una posposicion que pasa la medianoche suena al dia siguiente, aun si dura mas de nueve minutos.
+ */
+void test_snooze_across_midnight(void) {
+    static const clock_time_t alarm_time = {.time = {.seconds = {0, 0}, .minutes = {5, 5}, .hours = {3, 2}}};
+    clock = ClockCreate(CLOCK_TICKS_FOR_SECOND, 15);
+    TEST_ASSERT_TRUE(ClockSetAlarm(clock, &alarm_time));
+
+    ClockSetTime(clock, &(clock_time_t){.time = {.seconds = {9, 5}, .minutes = {4, 5}, .hours = {3, 2}}});
+    ClockAdvance(clock, CLOCK_TICKS_FOR_SECOND);
+    TEST_ASSERT_TRUE(ClockIsAlarmTriggered(clock));
+    ClockSnooze(clock);
+    ClockAdvance(clock, CLOCK_TICKS_FOR_SECOND * (15 * 60 - 1));
+    TEST_ASSERT_FALSE(ClockIsAlarmTriggered(clock));
+    ClockAdvance(clock, CLOCK_TICKS_FOR_SECOND);
+    TEST_ASSERT_TRUE(ClockIsAlarmTriggered(clock));
+    TEST_ASSERT_TIME(0, 0, 0, 1, 0, 0);
+}
+
+/**
+ * @test Verifica que un avance sin ticks dispara la alarma en la hora de partida como lo harian sus ticks, y que un
+ * avance nulo no hace nada.
+ */
+void test_advance_checks_alarm_at_starting_second(void) {
+    static const clock_time_t alarm_time = {.time = {.seconds = {0, 0}, .minutes = {0, 0}, .hours = {8, 0}}};
+
+    ClockSetTime(clock, &alarm_time);
+    TEST_ASSERT_TRUE(ClockSetAlarm(clock, &alarm_time));
+    ClockAdvance(clock, 0);
+    TEST_ASSERT_FALSE(ClockIsAlarmTriggered(clock));
+    ClockAdvance(clock, CLOCK_TICKS_FOR_SECOND * 60);
+    TEST_ASSERT_TRUE(ClockIsAlarmTriggered(clock));
+}
+
 /* === Private function definitions ================================================================================ */
 static void SimulateSeconds(clock_t clock, uint8_t seconds) {
     for (uint16_t i = 0; i < CLOCK_TICKS_FOR_SECOND * seconds; i++) {
@@ -0,0 +1,627 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Martin Nicolas Soria <soria.m.nicolas@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, disponiblestribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file test_clock_model.c
+ ** @brief Pruebas diferenciales del reloj contra un modelo de referencia, sobre secuencias aleatorias de operaciones.
+ **
+ ** El modelo guarda la hora como segundos desde la medianoche, sin BCD, y aplica las reglas de la alarma, la
+ ** posposicion y la cancelacion segundo a segundo, salteando juntos solo los segundos en que nada puede dispararse.
+ ** Cada secuencia se aplica a la vez al modelo y a clock.c, que avanza con ClockNewTick en los tramos cortos y con
+ ** ClockAdvance en los largos, y el estado visible se compara despues de cada operacion. Una secuencia que difiere se
+ ** reduce quitando operaciones, juntando y acortando avances mientras siga fallando, y se informa la secuencia minima.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "unity.h"
+#include "clock.h"
+#include "digital.h"
+#include "chip.h"
+#include <stdio.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define SECONDS_PER_DAY 86400UL // Segundos de un dia
+
+#ifndef MODEL_SIMULATED_DAYS
+#define MODEL_SIMULATED_DAYS 3653 // Tiempo simulado por corrida, una decada
+#endif
+
+#ifndef MODEL_SEED
+#define MODEL_SEED 0x2545F491u // Semilla de las secuencias, fija para que una falla se repita
+#endif
+
+#define MODEL_MAX_OPS    64   // Operaciones por secuencia
+#define MODEL_REPORT     1024 // Tamaño del informe de una secuencia
+#define MODEL_LONG_DAYS  7    // Mayor avance sin ticks, en dias
+#define MODEL_NO_FAILURE -1   // Resultado de una secuencia sin diferencias
+
+/* === Private data type declarations ============================================================================== */
+
+//! Operaciones de una secuencia
+typedef enum {
+    OP_SET_TIME,  //!< ClockSetTime, value: hora como HHMMSS decimal, posiblemente invalida
+    OP_SET_ALARM, //!< ClockSetAlarm, value: hora como HHMMSS decimal, posiblemente invalida
+    OP_DISABLE,   //!< ClockDisableAlarm
+    OP_SNOOZE,    //!< ClockSnooze
+    OP_CANCEL,    //!< ClockCancelAlarm
+    OP_TICKS,     //!< value llamadas a ClockNewTick
+    OP_ADVANCE,   //!< ClockAdvance de value ticks
+} op_kind_t;
+
+//! Operacion de una secuencia
+typedef struct op_s {
+    uint8_t kind;   //!< Operacion, op_kind_t
+    uint32_t value; //!< Argumento de la operacion
+} op_t;
+
+//! Secuencia de operaciones sobre un reloj recien creado
+typedef struct sequence_s {
+    uint16_t ticks_per_second; //!< Ticks por segundo del reloj
+    uint8_t snooze;            //!< Minutos de posposicion
+    uint8_t count;             //!< Operaciones de la secuencia
+    op_t ops[MODEL_MAX_OPS];   //!< Operaciones, en orden
+} sequence_t;
+
+//! Modelo de referencia del reloj
+typedef struct model_s {
+    uint32_t ticks_per_second; //!< Ticks por segundo
+    uint32_t snooze;           //!< Minutos de posposicion
+    uint32_t tick;             //!< Ticks transcurridos del segundo en curso
+    uint32_t now;              //!< Hora en segundos desde la medianoche
+    bool valid;                //!< La ultima hora configurada es valida
+    uint32_t alarm;            //!< Hora de la alarma en segundos desde la medianoche
+    bool alarm_enabled;        //!< La alarma esta habilitada
+    bool triggered;            //!< La alarma esta sonando
+    bool canceled;             //!< La alarma se cancelo hasta la proxima medianoche
+    bool snoozed;              //!< Hay una posposicion pendiente
+    uint32_t snooze_at;        //!< Hora de la posposicion en segundos desde la medianoche
+} model_t;
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Devuelve el siguiente numero pseudoaleatorio
+ */
+static uint32_t Random(void);
+
+/**
+ * @brief Convierte una hora HHMMSS decimal en segundos desde la medianoche
+ *
+ * @return uint32_t Segundos, o SECONDS_PER_DAY si la hora no es valida
+ */
+static uint32_t HhmmssToSeconds(uint32_t hhmmss);
+
+/**
+ * @brief Convierte segundos desde la medianoche en una hora HHMMSS decimal
+ */
+static uint32_t SecondsToHhmmss(uint32_t seconds);
+
+/**
+ * @brief Convierte una hora HHMMSS decimal en BCD no compactado, digito a digito
+ */
+static clock_time_t HhmmssToBcd(uint32_t hhmmss);
+
+/**
+ * @brief Avanza el modelo un segundo, reactivando la alarma cancelada en la medianoche
+ */
+static void ModelSecond(model_t * model);
+
+/**
+ * @brief Dispara la alarma o la posposicion del modelo si la hora coincide
+ */
+static void ModelCheck(model_t * model);
+
+/**
+ * @brief Devuelve cuantos segundos pueden pasar sin llegar a la hora de la alarma, de la posposicion ni a la
+ * medianoche
+ */
+static uint32_t ModelQuietSeconds(const model_t * model);
+
+/**
+ * @brief Avanza el modelo una cantidad de ticks
+ */
+static void ModelTicks(model_t * model, uint32_t ticks);
+
+/**
+ * @brief Aplica una operacion al modelo y al reloj
+ *
+ * @return bool Las dos implementaciones devolvieron lo mismo
+ */
+static bool Apply(model_t * model, clock_t clock, const op_t * op);
+
+/**
+ * @brief Compara el estado visible del reloj con el del modelo
+ *
+ * @param mismatch Descripcion de la primera diferencia, si la hay
+ * @return bool El estado es el mismo
+ */
+static bool Compare(const model_t * model, clock_t clock, char mismatch[], size_t size);
+
+/**
+ * @brief Aplica una secuencia desde un reloj y un modelo nuevos
+ *
+ * @param mismatch Descripcion de la primera diferencia, si la hay
+ * @return int Operacion despues de la cual el estado difiere, o MODEL_NO_FAILURE
+ */
+static int Replay(const sequence_t * sequence, char mismatch[], size_t size);
+
+/**
+ * @brief Elige una operacion aleatoria, sesgada hacia la hora de la alarma, la medianoche y la posposicion
+ */
+static op_t Generate(const model_t * model);
+
+/**
+ * @brief Reduce una secuencia que falla quitando operaciones y acortando avances mientras siga fallando
+ */
+static void Shrink(sequence_t * sequence);
+
+/**
+ * @brief Describe una secuencia y su primera diferencia para el mensaje de la prueba
+ */
+static void Describe(const sequence_t * sequence, char report[], size_t size);
+
+/**
+ * @brief Genera y compara secuencias hasta cubrir el tiempo simulado pedido
+ *
+ * @param days Dias simulados a cubrir
+ * @param failure Secuencia reducida de la primera falla
+ * @return bool Alguna secuencia fallo
+ */
+static bool Explore(uint32_t days, sequence_t * failure);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Estado del generador pseudoaleatorio
+static uint32_t random_state;
+
+//! Repite en el modelo el error de las posposiciones que pasaban la medianoche, para probar la reduccion
+static bool model_snooze_past_midnight;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Public function definitions ============================================================================== */
+
+void setUp(void) {
+    random_state = MODEL_SEED;
+    model_snooze_past_midnight = false;
+}
+
+/**
+ * @test Verifica el modelo de referencia con una posposicion que cruza la medianoche.
+ */
+void test_model_snoozes_across_midnight(void) {
+    model_t model = {.ticks_per_second = 10, .snooze = 5};
+
+    model.now = 23 * 3600 + 58 * 60;
+    model.alarm = model.now + 60;
+    model.alarm_enabled = true;
+    ModelTicks(&model, 10 * 60);
+    TEST_ASSERT_TRUE(model.triggered);
+    model.triggered = false;
+    model.snoozed = true;
+    model.snooze_at = (model.now + 5 * 60) % SECONDS_PER_DAY;
+    ModelTicks(&model, 10 * 5 * 60 - 1);
+    TEST_ASSERT_FALSE(model.triggered);
+    ModelTicks(&model, 1);
+    TEST_ASSERT_TRUE(model.triggered);
+    TEST_ASSERT_EQUAL_UINT32(4 * 60, model.now);
+}
+
+/**
+ * @test Verifica que el reloj coincide con el modelo en secuencias aleatorias que cubren una decada simulada.
+ */
+void test_clock_matches_model_for_a_decade(void) {
+    static sequence_t failure;
+    char report[MODEL_REPORT];
+
+    if (Explore(MODEL_SIMULATED_DAYS, &failure)) {
+        Describe(&failure, report, sizeof(report));
+        TEST_FAIL_MESSAGE(report);
+    }
+}
+
+/**
+ * @test Verifica que la exploracion encuentra el error de las posposiciones que pasaban la medianoche y lo reduce a
+ * pocas operaciones.
+ */
+void test_known_snooze_defect_is_found_and_shrunk(void) {
+    static sequence_t failure;
+    bool snoozed = false;
+
+    model_snooze_past_midnight = true;
+    TEST_ASSERT_TRUE(Explore(MODEL_SIMULATED_DAYS, &failure));
+    TEST_ASSERT_LESS_OR_EQUAL_UINT8(6, failure.count);
+    for (uint8_t index = 0; index < failure.count; index++) {
+        snoozed = snoozed || failure.ops[index].kind == OP_SNOOZE;
+    }
+    TEST_ASSERT_TRUE(snoozed);
+}
+
+/* === Private function definitions ================================================================================ */
+
+static uint32_t Random(void) {
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+    return random_state;
+}
+
+static uint32_t HhmmssToSeconds(uint32_t hhmmss) {
+    uint32_t hours = hhmmss / 10000;
+    uint32_t minutes = hhmmss / 100 % 100;
+    uint32_t seconds = hhmmss % 100;
+
+    if (hours > 23 || minutes > 59 || seconds > 59) {
+        return SECONDS_PER_DAY;
+    }
+    return hours * 3600 + minutes * 60 + seconds;
+}
+
+static uint32_t SecondsToHhmmss(uint32_t seconds) {
+    return seconds / 3600 * 10000 + seconds / 60 % 60 * 100 + seconds % 60;
+}
+
+static clock_time_t HhmmssToBcd(uint32_t hhmmss) {
+    clock_time_t time;
+
+    for (uint8_t digit = 0; digit < 6; digit++) {
+        time.bcd[digit] = (uint8_t)(hhmmss % 10);
+        hhmmss /= 10;
+    }
+    return time;
+}
+
+static void ModelSecond(model_t * model) {
+    model->now++;
+    if (model->now == SECONDS_PER_DAY) {
+        model->now = 0;
+        model->canceled = false;
+    }
+}
+
+static void ModelCheck(model_t * model) {
+    if (model->alarm_enabled && !model->canceled && !model->snoozed && model->now == model->alarm) {
+        model->triggered = true;
+    }
+    if (model->snoozed && model->now == model->snooze_at) {
+        model->triggered = true;
+        model->snoozed = false;
+    }
+}
+
+static uint32_t ModelQuietSeconds(const model_t * model) {
+    uint32_t quiet = SECONDS_PER_DAY - 1 - model->now;
+
+    if (model->alarm_enabled && (model->alarm + SECONDS_PER_DAY - model->now - 1) % SECONDS_PER_DAY < quiet) {
+        quiet = (model->alarm + SECONDS_PER_DAY - model->now - 1) % SECONDS_PER_DAY;
+    }
+    if (model->snoozed && (model->snooze_at + SECONDS_PER_DAY - model->now - 1) % SECONDS_PER_DAY < quiet) {
+        quiet = (model->snooze_at + SECONDS_PER_DAY - model->now - 1) % SECONDS_PER_DAY;
+    }
+    return quiet;
+}
+
+static void ModelTicks(model_t * model, uint32_t ticks) {
+    /* Cada tick verifica la alarma, pero repetir la verificacion en el mismo segundo no cambia nada, asi que basta
+     * con verificar una vez por tramo de ticks dentro de un segundo y una vez en cada segundo nuevo */
+    while (ticks > 0) {
+        uint32_t same_second = model->ticks_per_second - 1 - model->tick;
+
+        if (same_second > 0) {
+            uint32_t step = ticks < same_second ? ticks : same_second;
+            model->tick += step;
+            ticks -= step;
+        } else if (ticks / model->ticks_per_second > 1 && ModelQuietSeconds(model) > 0) {
+            /* Los segundos anteriores a la proxima hora de la alarma, de la posposicion o de la medianoche solo
+             * mueven la hora, asi que se saltean juntos; el ultimo segundo siempre se recorre de a uno */
+            uint32_t seconds = ticks / model->ticks_per_second - 1;
+            if (seconds > ModelQuietSeconds(model)) {
+                seconds = ModelQuietSeconds(model);
+            }
+            model->now += seconds;
+            ticks -= seconds * model->ticks_per_second;
+            continue;
+        } else {
+            model->tick = 0;
+            ticks--;
+            ModelSecond(model);
+        }
+        ModelCheck(model);
+    }
+}
+
+static bool Apply(model_t * model, clock_t clock, const op_t * op) {
+    clock_time_t time = HhmmssToBcd(op->value);
+    uint32_t seconds = HhmmssToSeconds(op->value);
+    bool result = true;
+
+    switch (op->kind) {
+    case OP_SET_TIME:
+        model->valid = seconds < SECONDS_PER_DAY;
+        if (model->valid) {
+            model->now = seconds;
+        }
+        result = ClockSetTime(clock, &time) == model->valid;
+        break;
+    case OP_SET_ALARM:
+        if (seconds < SECONDS_PER_DAY) {
+            model->alarm = seconds;
+            model->alarm_enabled = true;
+            model->canceled = false;
+        }
+        result = ClockSetAlarm(clock, &time) == (seconds < SECONDS_PER_DAY);
+        break;
+    case OP_DISABLE:
+        model->alarm_enabled = false;
+        ClockDisableAlarm(clock);
+        break;
+    case OP_SNOOZE:
+        if (model->triggered && model->snooze > 0) {
+            model->snooze_at = model->now + model->snooze * 60;
+            if (!model_snooze_past_midnight) {
+                model->snooze_at %= SECONDS_PER_DAY;
+            }
+            model->triggered = false;
+            model->snoozed = true;
+        }
+        ClockSnooze(clock);
+        break;
+    case OP_CANCEL:
+        if (model->triggered) {
+            model->triggered = false;
+            model->canceled = true;
+        }
+        ClockCancelAlarm(clock);
+        break;
+    case OP_TICKS:
+        ModelTicks(model, op->value);
+        for (uint32_t tick = 0; tick < op->value; tick++) {
+            ClockNewTick(clock);
+        }
+        break;
+    default:
+        ModelTicks(model, op->value);
+        ClockAdvance(clock, op->value);
+        break;
+    }
+    return result;
+}
+
+static bool Compare(const model_t * model, clock_t clock, char mismatch[], size_t size) {
+    clock_time_t expected = HhmmssToBcd(SecondsToHhmmss(model->now));
+    clock_time_t actual;
+    bool valid = ClockGetTime(clock, &actual);
+
+    if (valid != model->valid || memcmp(expected.bcd, actual.bcd, sizeof(actual.bcd)) != 0) {
+        snprintf(mismatch, size, "time %u%u:%u%u:%u%u%s, model %06lu%s", actual.bcd[5], actual.bcd[4], actual.bcd[3],
+                 actual.bcd[2], actual.bcd[1], actual.bcd[0], valid ? "" : " invalid",
+                 (unsigned long)SecondsToHhmmss(model->now), model->valid ? "" : " invalid");
+        return false;
+    }
+    expected = HhmmssToBcd(SecondsToHhmmss(model->alarm));
+    if (ClockGetAlarm(clock, &actual) != model->alarm_enabled || ClockIsAlarmEnabled(clock) != model->alarm_enabled ||
+        memcmp(expected.bcd, actual.bcd, sizeof(actual.bcd)) != 0) {
+        snprintf(mismatch, size, "alarm %u%u:%u%u:%u%u, model %06lu %s", actual.bcd[5], actual.bcd[4],
+                 actual.bcd[3], actual.bcd[2], actual.bcd[1], actual.bcd[0],
+                 (unsigned long)SecondsToHhmmss(model->alarm), model->alarm_enabled ? "enabled" : "disabled");
+        return false;
+    }
+    if (ClockIsAlarmTriggered(clock) != model->triggered) {
+        snprintf(mismatch, size, "triggered %d, model %d", !model->triggered, model->triggered);
+        return false;
+    }
+    return true;
+}
+
+static int Replay(const sequence_t * sequence, char mismatch[], size_t size) {
+    model_t model = {.ticks_per_second = sequence->ticks_per_second, .snooze = sequence->snooze};
+    clock_t clock = ClockCreate(sequence->ticks_per_second, sequence->snooze);
+
+    for (uint8_t index = 0; index < sequence->count; index++) {
+        if (!Apply(&model, clock, &sequence->ops[index])) {
+            snprintf(mismatch, size, "different result");
+            return index;
+        }
+        if (!Compare(&model, clock, mismatch, size)) {
+            return index;
+        }
+    }
+    return MODEL_NO_FAILURE;
+}
+
+static op_t Generate(const model_t * model) {
+    static const uint32_t INVALID[] = {240000, 250000, 296000, 126000, 129900, 120060, 120099};
+    uint32_t choice = Random() % 100;
+    uint32_t day_ticks = model->ticks_per_second * SECONDS_PER_DAY;
+    op_t op = {.kind = OP_ADVANCE};
+
+    if (choice < 10) {
+        /* Horas aleatorias, cerca de la medianoche, justo antes de la alarma o invalidas */
+        uint32_t pick = Random() % 8;
+        op.kind = OP_SET_TIME;
+        if (pick == 0) {
+            op.value = INVALID[Random() % (sizeof(INVALID) / sizeof(INVALID[0]))];
+        } else if (pick < 3) {
+            op.value = SecondsToHhmmss(SECONDS_PER_DAY - 1 - Random() % 900);
+        } else if (pick < 5) {
+            op.value = SecondsToHhmmss((model->alarm + SECONDS_PER_DAY - Random() % 120) % SECONDS_PER_DAY);
+        } else {
+            op.value = SecondsToHhmmss(Random() % SECONDS_PER_DAY);
+        }
+    } else if (choice < 20) {
+        /* Alarmas poco despues de la hora actual, incluida la hora actual, en la medianoche, aleatorias o invalidas */
+        uint32_t pick = Random() % 8;
+        op.kind = OP_SET_ALARM;
+        if (pick == 0) {
+            op.value = INVALID[Random() % (sizeof(INVALID) / sizeof(INVALID[0]))];
+        } else if (pick == 1) {
+            op.value = 0;
+        } else if (pick == 2) {
+            op.value = SecondsToHhmmss(model->now);
+        } else if (pick < 6) {
+            op.value = SecondsToHhmmss((model->now + Random() % 300) % SECONDS_PER_DAY);
+        } else {
+            op.value = SecondsToHhmmss(Random() % SECONDS_PER_DAY);
+        }
+    } else if (choice < 23) {
+        op.kind = OP_DISABLE;
+    } else if (choice < 35) {
+        op.kind = OP_SNOOZE;
+    } else if (choice < 42) {
+        op.kind = OP_CANCEL;
+    } else if (choice < 62) {
+        op.kind = OP_TICKS;
+        op.value = Random() % (3 * model->ticks_per_second + 1);
+    } else if (choice < 82) {
+        /* Avances hasta la alarma, la posposicion o la medianoche, con o sin algunos ticks de mas */
+        uint32_t targets[3] = {model->alarm, model->snooze_at, 0};
+        uint32_t target = targets[Random() % 3];
+        uint32_t seconds = (target + SECONDS_PER_DAY - model->now) % SECONDS_PER_DAY;
+        op.value = seconds * model->ticks_per_second + Random() % (2 * model->ticks_per_second + 1);
+        op.value -= op.value > model->tick ? model->tick : 0;
+    } else if (choice < 85) {
+        /* Avances de menos de un segundo, con el avance nulo en la mitad de los casos */
+        op.value = Random() % 2 ? 0 : Random() % model->ticks_per_second;
+    } else if (choice < 95) {
+        op.value = Random() % day_ticks;
+    } else {
+        op.value = day_ticks + Random() % (MODEL_LONG_DAYS * day_ticks);
+    }
+    return op;
+}
+
+static void Shrink(sequence_t * sequence) {
+    static sequence_t candidate;
+    char mismatch[MODEL_REPORT];
+    bool progress = true;
+
+    while (progress) {
+        progress = false;
+        for (int index = sequence->count - 1; index >= 0; index--) {
+            candidate = *sequence;
+            memmove(&candidate.ops[index], &candidate.ops[index + 1], (candidate.count - index - 1) * sizeof(op_t));
+            candidate.count--;
+            if (Replay(&candidate, mismatch, sizeof(mismatch)) != MODEL_NO_FAILURE) {
+                *sequence = candidate;
+                progress = true;
+            }
+        }
+        for (int index = sequence->count - 2; index >= 0; index--) {
+            /* Dos avances seguidos se prueban como uno solo, que puede llegar al mismo punto con otra division */
+            uint64_t joined = (uint64_t)sequence->ops[index].value + sequence->ops[index + 1].value;
+            if (sequence->ops[index].kind != OP_ADVANCE || sequence->ops[index + 1].kind != OP_ADVANCE ||
+                joined > UINT32_MAX) {
+                continue;
+            }
+            candidate = *sequence;
+            candidate.ops[index].value = (uint32_t)joined;
+            memmove(&candidate.ops[index + 1], &candidate.ops[index + 2], (candidate.count - index - 2) * sizeof(op_t));
+            candidate.count--;
+            if (Replay(&candidate, mismatch, sizeof(mismatch)) != MODEL_NO_FAILURE) {
+                *sequence = candidate;
+                progress = true;
+            }
+        }
+        for (int index = 0; index < sequence->count; index++) {
+            uint32_t passing = 0;
+            uint32_t failing = sequence->ops[index].value;
+
+            if (sequence->ops[index].kind != OP_TICKS && sequence->ops[index].kind != OP_ADVANCE) {
+                continue;
+            }
+            /* Busqueda binaria del avance mas corto que todavia falla, suponiendo que sin avance no falla */
+            candidate = *sequence;
+            while (failing - passing > 1) {
+                candidate.ops[index].value = passing + (failing - passing) / 2;
+                if (Replay(&candidate, mismatch, sizeof(mismatch)) != MODEL_NO_FAILURE) {
+                    failing = candidate.ops[index].value;
+                } else {
+                    passing = candidate.ops[index].value;
+                }
+            }
+            candidate.ops[index].value = passing;
+            if (passing == 0 && Replay(&candidate, mismatch, sizeof(mismatch)) != MODEL_NO_FAILURE) {
+                failing = 0;
+            }
+            if (failing < sequence->ops[index].value) {
+                sequence->ops[index].value = failing;
+                progress = true;
+            }
+        }
+        /* Las operaciones despues de la primera diferencia sobran */
+        sequence->count = (uint8_t)(Replay(sequence, mismatch, sizeof(mismatch)) + 1);
+    }
+}
+
+static void Describe(const sequence_t * sequence, char report[], size_t size) {
+    static const char * const NAMES[] = {"set time", "set alarm", "disable", "snooze", "cancel", "ticks", "advance"};
+    char mismatch[MODEL_REPORT / 4] = "";
+    int failed = Replay(sequence, mismatch, sizeof(mismatch));
+    int used = snprintf(report, size, "%u ticks/s, snooze %u min:", sequence->ticks_per_second, sequence->snooze);
+
+    for (uint8_t index = 0; index < sequence->count && used > 0 && (size_t)used < size; index++) {
+        const op_t * op = &sequence->ops[index];
+        used += snprintf(&report[used], size - used, " %s", NAMES[op->kind]);
+        if (op->kind == OP_SET_TIME || op->kind == OP_SET_ALARM) {
+            used += snprintf(&report[used], size - used, " %06lu;", (unsigned long)op->value);
+        } else if (op->kind == OP_TICKS || op->kind == OP_ADVANCE) {
+            used += snprintf(&report[used], size - used, " %lu;", (unsigned long)op->value);
+        } else {
+            used += snprintf(&report[used], size - used, ";");
+        }
+    }
+    if (used > 0 && (size_t)used < size) {
+        snprintf(&report[used], size - used, " differs after operation %d: %s", failed + 1, mismatch);
+    }
+}
+
+static bool Explore(uint32_t days, sequence_t * failure) {
+    static const uint16_t TICKS_PER_SECOND[] = {1, 2, 5, 10, 50, 1000};
+    static model_t model;
+    uint64_t simulated = 0;
+    char mismatch[MODEL_REPORT];
+
+    while (simulated < (uint64_t)days * SECONDS_PER_DAY) {
+        clock_t clock;
+
+        failure->ticks_per_second = TICKS_PER_SECOND[Random() % (sizeof(TICKS_PER_SECOND) / sizeof(uint16_t))];
+        failure->snooze = (uint8_t)(Random() % 4 == 0 ? 0 : 1 + Random() % 60);
+        failure->count = 0;
+        model = (model_t){.ticks_per_second = failure->ticks_per_second, .snooze = failure->snooze};
+        clock = ClockCreate(failure->ticks_per_second, failure->snooze);
+
+        while (failure->count < MODEL_MAX_OPS) {
+            op_t * op = &failure->ops[failure->count++];
+            *op = Generate(&model);
+            if (op->kind == OP_TICKS || op->kind == OP_ADVANCE) {
+                simulated += (model.tick + (uint64_t)op->value) / model.ticks_per_second;
+            }
+            if (!Apply(&model, clock, op) || !Compare(&model, clock, mismatch, sizeof(mismatch))) {
+                Shrink(failure);
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+/* === End of documentation ======================================================================================== */
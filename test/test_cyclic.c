@@ -0,0 +1,148 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Martin Nicolas Soria <soria.m.nicolas@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, disponiblestribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file test_cyclic.c
+ ** @brief Pruebas unitarias del ejecutivo ciclico.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "unity.h"
+#include "cyclic.h"
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define JOB_A (1u << 0) // Trabajo que corre en todos los marcos
+#define JOB_B (1u << 1) // Trabajo que corre en el primer marco
+#define JOB_C (1u << 2) // Trabajo que corre en el tercer marco
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+static void JobA(void);
+static void JobB(void);
+static void JobC(void);
+
+/* === Private variable definitions ================================================================================ */
+
+static const cyclic_job_t JOBS[] = {JobA, JobB, JobC};
+
+static const uint32_t FRAMES[] = {JOB_A | JOB_B, JOB_A, JOB_A | JOB_C, JOB_A};
+
+static const cyclic_schedule_t SCHEDULE = {
+    .jobs = JOBS,
+    .job_count = sizeof(JOBS) / sizeof(JOBS[0]),
+    .frames = FRAMES,
+    .frame_count = sizeof(FRAMES) / sizeof(FRAMES[0]),
+};
+
+//! Trabajos corridos, una letra por trabajo
+static char trace[32];
+
+//! Ejecutivo de la prueba, para que un trabajo pueda simular la interrupcion del marco siguiente
+static cyclic_t executive;
+
+//! Indica si JobC simula que tarda mas que un marco
+static bool slow_job;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Public function definitions ============================================================================== */
+
+void setUp(void) {
+    memset(trace, 0, sizeof(trace));
+    slow_job = false;
+    executive = CyclicCreate(&SCHEDULE);
+}
+
+/**
+ * @test Verifica que sin interrupcion del marco no corre ningun trabajo.
+ */
+void test_nothing_runs_without_tick(void) {
+    TEST_ASSERT_NOT_NULL(executive);
+    TEST_ASSERT_FALSE(CyclicIsPending(executive));
+    TEST_ASSERT_FALSE(CyclicRunPending(executive));
+    TEST_ASSERT_EQUAL_STRING("", trace);
+}
+
+/**
+ * @test Verifica que cada marco corre sus trabajos en el orden de la lista y que la tabla vuelve a empezar despues
+ * del marco mayor.
+ */
+void test_frames_follow_table_and_wrap(void) {
+    for (uint8_t i = 0; i < 6; i++) {
+        CyclicTick(executive);
+        TEST_ASSERT_TRUE(CyclicRunPending(executive));
+        strcat(trace, "|");
+    }
+    TEST_ASSERT_EQUAL_STRING("AB|A|AC|A|AB|A|", trace);
+    TEST_ASSERT_EQUAL_UINT32(0, CyclicGetOverruns(executive));
+}
+
+/**
+ * @test Verifica que un marco que termina despues de la siguiente interrupcion cuenta un desborde y que el marco
+ * atrasado corre igual.
+ */
+void test_late_frame_counts_overrun_and_is_not_skipped(void) {
+    slow_job = true;
+    for (uint8_t i = 0; i < 3; i++) {
+        CyclicTick(executive);
+        CyclicRunPending(executive);
+    }
+    TEST_ASSERT_EQUAL_UINT32(1, CyclicGetOverruns(executive));
+    TEST_ASSERT_TRUE(CyclicRunPending(executive));
+    TEST_ASSERT_FALSE(CyclicRunPending(executive));
+    TEST_ASSERT_EQUAL_STRING("ABAACA", trace);
+}
+
+/**
+ * @test Verifica que una tabla sin trabajos o sin marcos no crea el ejecutivo.
+ */
+void test_invalid_schedule_is_rejected(void) {
+    cyclic_schedule_t empty = SCHEDULE;
+
+    empty.frame_count = 0;
+    TEST_ASSERT_NULL(CyclicCreate(&empty));
+    empty = SCHEDULE;
+    empty.job_count = 0;
+    TEST_ASSERT_NULL(CyclicCreate(&empty));
+    TEST_ASSERT_NULL(CyclicCreate(NULL));
+}
+
+/* === Private function definitions ================================================================================ */
+
+static void JobA(void) {
+    strcat(trace, "A");
+}
+
+static void JobB(void) {
+    strcat(trace, "B");
+}
+
+static void JobC(void) {
+    strcat(trace, "C");
+    if (slow_job) {
+        CyclicTick(executive);
+    }
+}
+
+/* === End of documentation ======================================================================================== */
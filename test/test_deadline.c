@@ -0,0 +1,188 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Martin Nicolas Soria <soria.m.nicolas@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, disponiblestribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file test_deadline.c
+ ** @brief Pruebas unitarias del monitor de plazos de las tareas periodicas.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "unity.h"
+#include "deadline.h"
+
+/* === Macros definitions ========================================================================================== */
+
+#define PERIOD   1000 // Periodo de la tarea de prueba
+#define DEADLINE 500  // Plazo de la tarea de prueba
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Funcion de aviso que registra el ultimo plazo vencido
+ */
+static void MissHandler(uint8_t task, uint32_t lateness);
+
+/* === Private variable definitions ================================================================================ */
+
+static deadline_t monitor;
+static int missed_task;
+static uint32_t missed_lateness;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Public function definitions ================================================================================= */
+
+void setUp(void) {
+    monitor = DeadlineCreate(MissHandler);
+    missed_task = -1;
+    missed_lateness = 0;
+    DeadlineDeclare(monitor, 1, PERIOD, DEADLINE);
+}
+
+/**
+ * @test La latencia se mide contra la liberacion esperada y no se acumula entre vueltas.
+ */
+void test_jitter_is_measured_against_expected_release(void) {
+    DeadlineRelease(monitor, 1, 10000);
+    DeadlineRelease(monitor, 1, 11003);
+    DeadlineRelease(monitor, 1, 12020);
+    DeadlineRelease(monitor, 1, 13000);
+
+    TEST_ASSERT_EQUAL_UINT32(2, DeadlineGetJitter(monitor, 1, 0));
+    TEST_ASSERT_EQUAL_UINT32(1, DeadlineGetJitter(monitor, 1, 2));
+}
+
+/**
+ * @test Las latencias mayores que el ultimo limite caen en el ultimo intervalo.
+ */
+void test_large_jitter_goes_to_last_bin(void) {
+    DeadlineRelease(monitor, 1, 0);
+    DeadlineRelease(monitor, 1, PERIOD + 100000);
+
+    TEST_ASSERT_EQUAL_UINT32(1, DeadlineGetJitter(monitor, 1, DEADLINE_BINS - 1));
+}
+
+/**
+ * @test Una vuelta que termina despues del plazo cuenta como vencida y avisa la demora.
+ */
+void test_late_completion_is_a_miss(void) {
+    DeadlineRelease(monitor, 1, 0);
+    TEST_ASSERT_TRUE(DeadlineComplete(monitor, 1, DEADLINE));
+    DeadlineRelease(monitor, 1, PERIOD + 50);
+    TEST_ASSERT_FALSE(DeadlineComplete(monitor, 1, PERIOD + DEADLINE + 30));
+
+    TEST_ASSERT_EQUAL_UINT32(1, DeadlineGetMisses(monitor, 1));
+    TEST_ASSERT_EQUAL(1, missed_task);
+    TEST_ASSERT_EQUAL_UINT32(30, missed_lateness);
+}
+
+/**
+ * @test El monitor funciona aunque el contador desborde.
+ */
+void test_counter_overflow(void) {
+    DeadlineRelease(monitor, 1, 0xFFFFFF00u);
+    DeadlineRelease(monitor, 1, 0xFFFFFF00u + PERIOD);
+    TEST_ASSERT_TRUE(DeadlineComplete(monitor, 1, 0xFFFFFF00u + PERIOD + DEADLINE - 1));
+    TEST_ASSERT_EQUAL_UINT32(0, DeadlineGetMisses(monitor, 1));
+}
+
+/**
+ * @test El permiso para alimentar el perro guardian se pierde con un plazo vencido y vuelve en la ventana siguiente.
+ */
+void test_all_met_fails_once_after_a_miss(void) {
+    DeadlineRelease(monitor, 1, 0);
+    DeadlineComplete(monitor, 1, 2 * DEADLINE);
+
+    TEST_ASSERT_FALSE(DeadlineAllMet(monitor, 2 * DEADLINE));
+    DeadlineRelease(monitor, 1, PERIOD);
+    DeadlineComplete(monitor, 1, PERIOD + 1);
+    TEST_ASSERT_TRUE(DeadlineAllMet(monitor, PERIOD + 1));
+}
+
+/**
+ * @test Una tarea que deja de ejecutarse hace perder el permiso, salvo que se haya pausado.
+ */
+void test_all_met_detects_stalled_task(void) {
+    DeadlineRelease(monitor, 1, 0);
+    DeadlineComplete(monitor, 1, 1);
+
+    TEST_ASSERT_TRUE(DeadlineAllMet(monitor, PERIOD + DEADLINE));
+    TEST_ASSERT_FALSE(DeadlineAllMet(monitor, PERIOD + DEADLINE + 2));
+    DeadlinePause(monitor, 1);
+    TEST_ASSERT_TRUE(DeadlineAllMet(monitor, 10 * PERIOD));
+}
+
+/**
+ * @test Una tarea colgada cuenta como un plazo vencido de esa tarea y se avisa una sola vez por vuelta.
+ */
+void test_stalled_task_is_reported_once(void) {
+    DeadlineRelease(monitor, 1, 0);
+    DeadlineComplete(monitor, 1, 1);
+
+    TEST_ASSERT_FALSE(DeadlineAllMet(monitor, PERIOD + DEADLINE + 2));
+    TEST_ASSERT_EQUAL_INT(1, missed_task);
+    TEST_ASSERT_EQUAL_UINT32(2, missed_lateness);
+    TEST_ASSERT_FALSE(DeadlineAllMet(monitor, 5 * PERIOD));
+    TEST_ASSERT_EQUAL_UINT32(1, DeadlineGetMisses(monitor, 1));
+}
+
+/**
+ * @test La liberacion fijada reemplaza a la periodica para la latencia y para detectar a la tarea colgada.
+ */
+void test_schedule_sets_next_release_and_limit(void) {
+    DeadlineRelease(monitor, 1, 0);
+    DeadlineComplete(monitor, 1, 10);
+    DeadlineSchedule(monitor, 1, 50 * PERIOD);
+
+    TEST_ASSERT_TRUE(DeadlineAllMet(monitor, 40 * PERIOD));
+    DeadlineRelease(monitor, 1, 50 * PERIOD + 3);
+    TEST_ASSERT_TRUE(DeadlineComplete(monitor, 1, 50 * PERIOD + 10));
+    TEST_ASSERT_EQUAL_UINT32(1, DeadlineGetJitter(monitor, 1, 0));
+
+    DeadlineSchedule(monitor, 1, 60 * PERIOD);
+    TEST_ASSERT_TRUE(DeadlineAllMet(monitor, 60 * PERIOD + DEADLINE));
+    TEST_ASSERT_FALSE(DeadlineAllMet(monitor, 60 * PERIOD + DEADLINE + 1));
+    TEST_ASSERT_EQUAL_INT(1, missed_task);
+    TEST_ASSERT_EQUAL_UINT32(1, DeadlineGetMisses(monitor, 1));
+}
+
+/**
+ * @test Redeclarar el periodo toma la siguiente liberacion como referencia.
+ */
+void test_redeclare_rebases_release(void) {
+    DeadlineRelease(monitor, 1, 0);
+    TEST_ASSERT_TRUE(DeadlineDeclare(monitor, 1, 4 * PERIOD, DEADLINE));
+    DeadlineRelease(monitor, 1, 1234);
+    DeadlineRelease(monitor, 1, 1234 + 4 * PERIOD);
+
+    TEST_ASSERT_EQUAL_UINT32(1, DeadlineGetJitter(monitor, 1, 0));
+    TEST_ASSERT_FALSE(DeadlineDeclare(monitor, DEADLINE_MAX_TASKS, PERIOD, DEADLINE));
+}
+
+/* === Private function definitions ================================================================================ */
+
+static void MissHandler(uint8_t task, uint32_t lateness) {
+    missed_task = task;
+    missed_lateness = lateness;
+}
+
+/* === End of documentation ======================================================================================== */
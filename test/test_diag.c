@@ -0,0 +1,138 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Martin Nicolas Soria <soria.m.nicolas@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, disponiblestribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file test_diag.c
+ ** @brief Pruebas unitarias de las estadisticas de ejecucion de las tareas.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "unity.h"
+#include "diag.h"
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+
+static const char * const NAMES[] = {"clk", "keys", "ui", "IDLE"};
+
+static diag_t diag;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Public function definitions ================================================================================= */
+
+void setUp(void) {
+    diag = DiagCreate(NAMES, 4);
+}
+
+/**
+ * @test No se pueden seguir mas tareas que DIAG_MAX_TASKS.
+ */
+void test_create_rejects_too_many_tasks(void) {
+    TEST_ASSERT_NULL(DiagCreate(NAMES, DIAG_MAX_TASKS + 1));
+    TEST_ASSERT_NULL(DiagCreate(NAMES, 0));
+}
+
+/**
+ * @test El uso de CPU se calcula entre dos muestras, no desde el arranque.
+ */
+void test_cpu_is_measured_between_samples(void) {
+    DiagTaskSample(diag, 0, 500, 100);
+    DiagTaskSample(diag, 3, 9500, 100);
+    DiagSystemSample(diag, 10000, 0);
+    TEST_ASSERT_EQUAL_UINT8(5, DiagGetCpu(diag, 0));
+    TEST_ASSERT_EQUAL_UINT8(95, DiagGetCpu(diag, 3));
+
+    DiagTaskSample(diag, 0, 2500, 100);
+    DiagTaskSample(diag, 3, 17500, 100);
+    DiagSystemSample(diag, 20000, 0);
+    TEST_ASSERT_EQUAL_UINT8(20, DiagGetCpu(diag, 0));
+    TEST_ASSERT_EQUAL_UINT8(80, DiagGetCpu(diag, 3));
+}
+
+/**
+ * @test El uso de CPU se mantiene correcto cuando el contador de ejecucion desborda entre dos muestras.
+ */
+void test_cpu_survives_counter_overflow(void) {
+    DiagTaskSample(diag, 1, 0xFFFFFF00u, 0);
+    DiagSystemSample(diag, 0xFFFFF000u, 0);
+    DiagTaskSample(diag, 1, 0x00000500u, 0);
+    DiagSystemSample(diag, 0x00000800u, 0);
+    TEST_ASSERT_EQUAL_UINT8(25, DiagGetCpu(diag, 1));
+}
+
+/**
+ * @test Solo se conserva la vuelta mas larga de cada tarea.
+ */
+void test_loop_time_keeps_maximum(void) {
+    DiagLoopTime(diag, 2, 40);
+    DiagLoopTime(diag, 2, 120);
+    DiagLoopTime(diag, 2, 80);
+    TEST_ASSERT_EQUAL_UINT32(120, DiagGetLoopMax(diag, 2));
+    TEST_ASSERT_EQUAL_UINT32(0, DiagGetLoopMax(diag, 1));
+}
+
+/**
+ * @test Las paginas marcan la tarea con el punto, saturan en 999 y terminan con el heap en kilobytes.
+ */
+void test_format_pages(void) {
+    char text[DIAG_PAGE_TEXT];
+
+    DiagTaskSample(diag, 1, 0, 1234);
+    DiagLoopTime(diag, 3, 42);
+    DiagSystemSample(diag, 1000, 12345);
+
+    TEST_ASSERT_EQUAL_UINT8(13, DiagGetPages(diag));
+    TEST_ASSERT_TRUE(DiagFormatPage(diag, 5, text));
+    TEST_ASSERT_EQUAL_STRING("S9.99", text);
+    TEST_ASSERT_TRUE(DiagFormatPage(diag, 11, text));
+    TEST_ASSERT_EQUAL_STRING("L042.", text);
+    TEST_ASSERT_TRUE(DiagFormatPage(diag, 12, text));
+    TEST_ASSERT_EQUAL_STRING("H12.3", text);
+    TEST_ASSERT_FALSE(DiagFormatPage(diag, 13, text));
+}
+
+/**
+ * @test El volcado JSON incluye todas las tareas y avisa cuando el destino es chico.
+ */
+void test_write_json(void) {
+    static const char * const ONE[] = {"clk"};
+    diag_t single = DiagCreate(ONE, 1);
+    char json[96];
+
+    DiagTaskSample(single, 0, 30, 64);
+    DiagLoopTime(single, 0, 7);
+    DiagSystemSample(single, 100, 2048);
+    TEST_ASSERT_EQUAL(85, DiagWriteJson(single, json, sizeof(json)));
+    TEST_ASSERT_EQUAL_STRING("{\"tasks\":[{\"name\":\"clk\",\"cpu\":30,\"stack_free\":64,\"loop_max\":7}],"
+                             "\"heap_free_min\":2048}",
+                             json);
+    TEST_ASSERT_EQUAL(85, DiagWriteJson(single, json, 16));
+    TEST_ASSERT_EQUAL_STRING("{\"tasks\":[{\"nam", json);
+}
+
+/* === Private function definitions ================================================================================ */
+
+/* === End of documentation ======================================================================================== */
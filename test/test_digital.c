@@ -0,0 +1,212 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Martin Nicolas Soria <soria.m.nicolas@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, disponiblestribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file test_digital.c
+ ** @brief Pruebas unitarias del modulo de entradas y salidas digitales sobre registros simulados.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "unity.h"
+#include "digital.h"
+#include "chip.h"
+
+/* === Macros definitions ========================================================================================== */
+
+#define OUTPUT_PORT 2  // Puerto de la salida de prueba
+#define OUTPUT_PIN  11 // Pin de la salida de prueba
+#define INPUT_PORT  1  // Puerto de la entrada de prueba
+#define INPUT_PIN   4  // Pin de la entrada de prueba
+#define TICKS       1000 // Llamadas repetidas, como las de la tarea del reloj durante un segundo
+#define GROUP_PORT  5    // Puerto de las salidas agrupadas
+#define OTHER_PORT  3    // Puerto de una salida ajena al grupo
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Public function definitions ============================================================================== */
+
+void setUp(void) {
+    ChipFakeReset();
+}
+
+/**
+ * @test Verifica que una salida se crea desactivada y configurada como salida.
+ */
+void test_output_starts_inactive(void) {
+    digital_output_t output = DigitalOutputCreate(OUTPUT_PORT, OUTPUT_PIN, false);
+
+    TEST_ASSERT_NOT_NULL(output);
+    TEST_ASSERT_FALSE(DigitalOutputGetIsActive(output));
+    TEST_ASSERT_EQUAL_UINT8(0, LPC_GPIO_PORT->B[OUTPUT_PORT][OUTPUT_PIN]);
+    TEST_ASSERT_BIT_HIGH(OUTPUT_PIN, LPC_GPIO_PORT->DIR[OUTPUT_PORT]);
+}
+
+/**
+ * @test Verifica que una salida invertida se activa con nivel bajo.
+ */
+void test_inverted_output_is_active_low(void) {
+    digital_output_t output = DigitalOutputCreate(OUTPUT_PORT, OUTPUT_PIN, true);
+
+    TEST_ASSERT_EQUAL_UINT8(1, LPC_GPIO_PORT->B[OUTPUT_PORT][OUTPUT_PIN]);
+    DigitalOutputActivate(output);
+    TEST_ASSERT_TRUE(DigitalOutputGetIsActive(output));
+    TEST_ASSERT_EQUAL_UINT8(0, LPC_GPIO_PORT->B[OUTPUT_PORT][OUTPUT_PIN]);
+    DigitalOutputToggle(output);
+    TEST_ASSERT_FALSE(DigitalOutputGetIsActive(output));
+    TEST_ASSERT_EQUAL_UINT8(1, LPC_GPIO_PORT->B[OUTPUT_PORT][OUTPUT_PIN]);
+}
+
+/**
+ * @test Verifica que escribir repetidamente el mismo estado solo escribe el registro en los cambios.
+ */
+void test_repeated_writes_only_touch_register_on_change(void) {
+    digital_output_t output = DigitalOutputCreate(OUTPUT_PORT, OUTPUT_PIN, true);
+    uint32_t writes;
+
+    writes = ChipFakeGetWrites();
+    for (int tick = 0; tick < TICKS; tick++) {
+        DigitalOutputDeactivate(output);
+    }
+    TEST_ASSERT_EQUAL_UINT32(writes, ChipFakeGetWrites());
+
+    for (int tick = 0; tick < TICKS; tick++) {
+        DigitalOutputActivate(output);
+    }
+    TEST_ASSERT_EQUAL_UINT32(writes + 1, ChipFakeGetWrites());
+
+    DigitalOutputToggle(output);
+    DigitalOutputDeactivate(output);
+    TEST_ASSERT_EQUAL_UINT32(writes + 2, ChipFakeGetWrites());
+}
+
+/**
+ * @test Verifica la deteccion de flancos de una entrada invertida.
+ */
+void test_input_detects_edges(void) {
+    digital_input_t input;
+
+    ChipFakeSetPin(INPUT_PORT, INPUT_PIN, true);
+    input = DigitalInputCreate(INPUT_PORT, INPUT_PIN, true);
+    TEST_ASSERT_FALSE(DigitalInputGetIsActive(input));
+    TEST_ASSERT_EQUAL(DIGITAL_INPUT_NO_CHANGE, DigitalWasChanged(input));
+
+    ChipFakeSetPin(INPUT_PORT, INPUT_PIN, false);
+    TEST_ASSERT_TRUE(DigitalWasActive(input));
+    TEST_ASSERT_FALSE(DigitalWasActive(input));
+
+    ChipFakeSetPin(INPUT_PORT, INPUT_PIN, true);
+    TEST_ASSERT_TRUE(DigitalWasInactive(input));
+}
+
+/**
+ * @test Verifica que un grupo cambia cualquier subconjunto con una sola escritura enmascarada, respetando la
+ * polaridad de cada salida, sin tocar los pines que no pertenecen al subconjunto y dejando MASK en 0.
+ */
+void test_group_writes_subset_with_one_masked_write(void) {
+    digital_output_t outputs[3] = {
+        DigitalOutputCreate(GROUP_PORT, 0, false),
+        DigitalOutputCreate(GROUP_PORT, 1, true),
+        DigitalOutputCreate(GROUP_PORT, 2, false),
+    };
+    digital_output_t other = DigitalOutputCreate(GROUP_PORT, 7, false);
+    digital_output_group_t group = DigitalOutputGroupCreate(outputs, 3);
+    uint32_t writes;
+
+    TEST_ASSERT_NOT_NULL(group);
+    DigitalOutputActivate(other);
+    writes = ChipFakeGetWrites();
+
+    DigitalOutputGroupActivate(group, 0x3);
+    TEST_ASSERT_EQUAL_UINT32(writes + 3, ChipFakeGetWrites());
+    TEST_ASSERT_EQUAL(CHIP_FAKE_GPIO_MASK, ChipFakeGetWrite(writes)->reg);
+    TEST_ASSERT_EQUAL_HEX32(~0x3u, ChipFakeGetWrite(writes)->value);
+    TEST_ASSERT_EQUAL(CHIP_FAKE_GPIO_MPIN, ChipFakeGetWrite(writes + 1)->reg);
+    TEST_ASSERT_EQUAL_HEX32(0x1, ChipFakeGetWrite(writes + 1)->value);
+    TEST_ASSERT_EQUAL_HEX32(0, LPC_GPIO_PORT->MASK[GROUP_PORT]);
+    TEST_ASSERT_FALSE(ChipFakeMaskedWriteUnmasked());
+    TEST_ASSERT_BITS(0x87, 0x81, LPC_GPIO_PORT->PIN[GROUP_PORT]);
+    TEST_ASSERT_TRUE(DigitalOutputGetIsActive(outputs[0]));
+    TEST_ASSERT_TRUE(DigitalOutputGetIsActive(outputs[1]));
+    TEST_ASSERT_FALSE(DigitalOutputGetIsActive(outputs[2]));
+
+    DigitalOutputGroupWrite(group, 0x7, 0x4);
+    TEST_ASSERT_BITS(0x87, 0x86, LPC_GPIO_PORT->PIN[GROUP_PORT]);
+    TEST_ASSERT_EQUAL_UINT32(writes + 6, ChipFakeGetWrites());
+
+    DigitalOutputGroupWrite(group, 0x7, 0x4);
+    DigitalOutputDeactivate(outputs[0]);
+    TEST_ASSERT_EQUAL_UINT32(writes + 6, ChipFakeGetWrites());
+}
+
+/**
+ * @test Verifica que no se pueden agrupar salidas de puertos distintos.
+ */
+void test_group_requires_single_port(void) {
+    digital_output_t outputs[2] = {
+        DigitalOutputCreate(GROUP_PORT, 0, false),
+        DigitalOutputCreate(OTHER_PORT, 0, false),
+    };
+
+    TEST_ASSERT_NULL(DigitalOutputGroupCreate(outputs, 2));
+    TEST_ASSERT_NULL(DigitalOutputGroupCreate(outputs, 0));
+    TEST_ASSERT_NULL(DigitalOutputGroupCreate(NULL, 1));
+    TEST_ASSERT_NOT_NULL(DigitalOutputGroupCreate(outputs, 1));
+}
+
+/**
+ * @test Verifica que un lote escribe una vez por puerto que cambia y que la ultima escritura de una salida gana.
+ */
+void test_batch_writes_once_per_changed_port(void) {
+    digital_output_t first = DigitalOutputCreate(GROUP_PORT, 3, false);
+    digital_output_t second = DigitalOutputCreate(GROUP_PORT, 4, true);
+    digital_output_t third = DigitalOutputCreate(OTHER_PORT, 9, false);
+    digital_batch_t batch;
+    uint32_t writes = ChipFakeGetWrites();
+
+    DigitalBatchInit(&batch);
+    TEST_ASSERT_TRUE(DigitalBatchWrite(&batch, first, true));
+    TEST_ASSERT_TRUE(DigitalBatchWrite(&batch, second, true));
+    TEST_ASSERT_TRUE(DigitalBatchWrite(&batch, third, false));
+    TEST_ASSERT_TRUE(DigitalBatchWrite(&batch, third, true));
+    TEST_ASSERT_EQUAL_UINT32(writes, ChipFakeGetWrites());
+
+    TEST_ASSERT_EQUAL_UINT8(2, DigitalBatchCommit(&batch));
+    TEST_ASSERT_EQUAL_UINT32(writes + 6, ChipFakeGetWrites());
+    TEST_ASSERT_BITS(0x18, 0x08, LPC_GPIO_PORT->PIN[GROUP_PORT]);
+    TEST_ASSERT_BIT_HIGH(9, LPC_GPIO_PORT->PIN[OTHER_PORT]);
+    TEST_ASSERT_TRUE(DigitalOutputGetIsActive(second));
+
+    TEST_ASSERT_TRUE(DigitalBatchWrite(&batch, first, true));
+    TEST_ASSERT_EQUAL_UINT8(0, DigitalBatchCommit(&batch));
+    for (int i = 0; i < DIGITAL_BATCH_MAX; i++) {
+        TEST_ASSERT_TRUE(DigitalBatchWrite(&batch, first, false));
+    }
+    TEST_ASSERT_FALSE(DigitalBatchWrite(&batch, first, false));
+}
+
+/* === Private function definitions ================================================================================ */
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,147 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Martin Nicolas Soria <soria.m.nicolas@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, disponiblestribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file test_digital_pin.c
+ ** @brief Pruebas de los pines resueltos en tiempo de compilacion contra la interfaz digital en tiempo de ejecucion.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "unity.h"
+#include "digital.h"
+#include "digital_pin.h"
+#include "chip.h"
+
+/* === Macros definitions ========================================================================================== */
+
+#define FIXED_PORT   2  // Puerto de los pines fijos
+#define FIXED_PIN    11 // Pin de la salida fija
+#define FIXED_LOW    12 // Pin de la salida fija invertida
+#define RUNTIME_PORT 3  // Puerto de las salidas creadas en tiempo de ejecucion, con la misma polaridad
+#define RUNTIME_PIN  11 // Pin de la salida creada en tiempo de ejecucion
+#define RUNTIME_LOW  12 // Pin de la salida invertida creada en tiempo de ejecucion
+#define INPUT_PORT   1  // Puerto de la entrada
+#define INPUT_PIN    4  // Pin de la entrada
+
+/* === Private data type declarations ============================================================================== */
+
+DIGITAL_PIN_OUTPUT(FixedOutput, FIXED_PORT, FIXED_PIN, false)
+DIGITAL_PIN_OUTPUT(FixedOutputLow, FIXED_PORT, FIXED_LOW, true)
+DIGITAL_PIN_INPUT(FixedInput, INPUT_PORT, INPUT_PIN, false)
+DIGITAL_PIN_INPUT(FixedInputLow, INPUT_PORT, INPUT_PIN, true)
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Verifica que una salida fija y una creada en tiempo de ejecucion tienen el mismo estado y nivel de pin
+ */
+static void AssertSameOutputs(digital_output_t runtime, bool fixed_active, uint8_t runtime_pin, uint8_t fixed_pin);
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Public function definitions ============================================================================== */
+
+void setUp(void) {
+    ChipFakeReset();
+}
+
+/**
+ * @test Verifica que una salida fija se inicia desactivada y como salida, igual que DigitalOutputCreate.
+ */
+void test_fixed_output_starts_like_runtime_output(void) {
+    digital_output_t runtime = DigitalOutputCreate(RUNTIME_PORT, RUNTIME_PIN, false);
+    digital_output_t runtime_low = DigitalOutputCreate(RUNTIME_PORT, RUNTIME_LOW, true);
+
+    FixedOutputInit();
+    FixedOutputLowInit();
+
+    AssertSameOutputs(runtime, FixedOutputGetIsActive(), RUNTIME_PIN, FIXED_PIN);
+    AssertSameOutputs(runtime_low, FixedOutputLowGetIsActive(), RUNTIME_LOW, FIXED_LOW);
+    TEST_ASSERT_BIT_HIGH(FIXED_PIN, LPC_GPIO_PORT->DIR[FIXED_PORT]);
+    TEST_ASSERT_BIT_HIGH(FIXED_LOW, LPC_GPIO_PORT->DIR[FIXED_PORT]);
+}
+
+/**
+ * @test Verifica que la misma secuencia de operaciones deja los mismos niveles en ambas interfaces, con las dos
+ * polaridades.
+ */
+void test_fixed_output_follows_runtime_output(void) {
+    digital_output_t runtime = DigitalOutputCreate(RUNTIME_PORT, RUNTIME_PIN, false);
+    digital_output_t runtime_low = DigitalOutputCreate(RUNTIME_PORT, RUNTIME_LOW, true);
+
+    FixedOutputInit();
+    FixedOutputLowInit();
+
+    DigitalOutputActivate(runtime);
+    DigitalOutputActivate(runtime_low);
+    FixedOutputActivate();
+    FixedOutputLowActivate();
+    AssertSameOutputs(runtime, FixedOutputGetIsActive(), RUNTIME_PIN, FIXED_PIN);
+    AssertSameOutputs(runtime_low, FixedOutputLowGetIsActive(), RUNTIME_LOW, FIXED_LOW);
+
+    DigitalOutputToggle(runtime);
+    DigitalOutputToggle(runtime_low);
+    FixedOutputToggle();
+    FixedOutputLowToggle();
+    AssertSameOutputs(runtime, FixedOutputGetIsActive(), RUNTIME_PIN, FIXED_PIN);
+    AssertSameOutputs(runtime_low, FixedOutputLowGetIsActive(), RUNTIME_LOW, FIXED_LOW);
+
+    DigitalOutputToggle(runtime);
+    DigitalOutputToggle(runtime_low);
+    FixedOutputWrite(true);
+    FixedOutputLowWrite(true);
+    AssertSameOutputs(runtime, FixedOutputGetIsActive(), RUNTIME_PIN, FIXED_PIN);
+    AssertSameOutputs(runtime_low, FixedOutputLowGetIsActive(), RUNTIME_LOW, FIXED_LOW);
+
+    DigitalOutputDeactivate(runtime);
+    DigitalOutputDeactivate(runtime_low);
+    FixedOutputDeactivate();
+    FixedOutputLowDeactivate();
+    AssertSameOutputs(runtime, FixedOutputGetIsActive(), RUNTIME_PIN, FIXED_PIN);
+    AssertSameOutputs(runtime_low, FixedOutputLowGetIsActive(), RUNTIME_LOW, FIXED_LOW);
+}
+
+/**
+ * @test Verifica que una entrada fija lee el mismo estado que DigitalInputGetIsActive, con las dos polaridades.
+ */
+void test_fixed_input_reads_like_runtime_input(void) {
+    digital_input_t runtime = DigitalInputCreate(INPUT_PORT, INPUT_PIN, false);
+    digital_input_t runtime_low = DigitalInputCreate(INPUT_PORT, INPUT_PIN, true);
+
+    FixedInputInit();
+    TEST_ASSERT_BIT_LOW(INPUT_PIN, LPC_GPIO_PORT->DIR[INPUT_PORT]);
+
+    for (uint8_t level = 0; level < 2; level++) {
+        ChipFakeSetPin(INPUT_PORT, INPUT_PIN, level != 0);
+        TEST_ASSERT_EQUAL(DigitalInputGetIsActive(runtime), FixedInputGetIsActive());
+        TEST_ASSERT_EQUAL(DigitalInputGetIsActive(runtime_low), FixedInputLowGetIsActive());
+    }
+}
+
+/* === Private function definitions ================================================================================ */
+
+static void AssertSameOutputs(digital_output_t runtime, bool fixed_active, uint8_t runtime_pin, uint8_t fixed_pin) {
+    TEST_ASSERT_EQUAL(DigitalOutputGetIsActive(runtime), fixed_active);
+    TEST_ASSERT_EQUAL_UINT8(LPC_GPIO_PORT->B[RUNTIME_PORT][runtime_pin], LPC_GPIO_PORT->B[FIXED_PORT][fixed_pin]);
+}
+
+/* === End of documentation ======================================================================================== */
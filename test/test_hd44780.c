@@ -0,0 +1,207 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Martin Nicolas Soria <soria.m.nicolas@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, disponiblestribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_hd44780.c
+ ** @brief Pruebas unitarias del adaptador de la pantalla a un LCD de caracteres HD44780.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "unity.h"
+#include "hd44780.h"
+#include "screen.h"
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define SCREEN_DIGITS 4   // Cantidad de digitos de la pantalla de prueba
+#define REFRESH_HZ    200 // Frecuencia con la que la tarea de interfaz refresca la pantalla, una vez cada 5 ms
+#define LCD_COLUMNS   40  // Columnas de la DDRAM de una linea del LCD simulado
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Bus simulado que ejecuta las instrucciones sobre la DDRAM de un LCD de prueba
+ *
+ * @param data true para un dato, false para una instruccion
+ * @param value Byte escrito
+ */
+static void FakeBus(bool data, uint8_t value);
+
+/**
+ * @brief Envia un cuadro de la pantalla al adaptador de prueba
+ *
+ * @param segments Segmentos de cada digito
+ * @param digits Cantidad de digitos
+ * @param brightness Nivel de brillo
+ */
+static void FakeFrameTransfer(const uint8_t segments[], uint8_t digits, uint8_t brightness);
+
+/* === Private variable definitions ================================================================================ */
+
+static const struct screen_driver_s lcd_driver = {
+    .FrameTransfer = FakeFrameTransfer,
+};
+
+static char ddram[LCD_COLUMNS + 1];
+static uint8_t address;
+static bool display_on;
+static uint32_t commands;
+static uint32_t writes;
+static hd44780_t lcd;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Public function definitions ============================================================================== */
+
+void setUp(void) {
+    memset(ddram, '?', LCD_COLUMNS);
+    ddram[LCD_COLUMNS] = '\0';
+    address = 0;
+    display_on = false;
+    lcd = Hd44780Create(SCREEN_DIGITS, FakeBus);
+    commands = 0;
+    writes = 0;
+}
+
+/**
+ * @test Verifica que al crear el adaptador se enciende y borra el LCD.
+ */
+void test_create_clears_and_turns_on_display(void) {
+    TEST_ASSERT_NOT_NULL(lcd);
+    TEST_ASSERT_TRUE(display_on);
+    TEST_ASSERT_EQUAL_STRING_LEN("        ", ddram, 2 * SCREEN_DIGITS);
+    TEST_ASSERT_EQUAL_UINT32(4, Hd44780GetTransactions(lcd));
+    TEST_ASSERT_NULL(Hd44780Create(HD44780_MAX_DIGITS + 1, FakeBus));
+}
+
+/**
+ * @test Verifica que los valores y puntos escritos con la API de la pantalla se muestran como texto.
+ */
+void test_screen_writes_are_shown_as_characters(void) {
+    uint8_t value[SCREEN_DIGITS] = {1, 2, 0x0A, 0x0E};
+    screen_t screen = ScreenCreate(SCREEN_DIGITS, &lcd_driver);
+
+    ScreenWriteBCD(screen, value, SCREEN_DIGITS);
+    ScreenEnablePoint(screen, 1);
+    ScreenPublish(screen);
+    ScreenRefresh(screen);
+    TEST_ASSERT_EQUAL_STRING_LEN("1 2.A E ", ddram, 2 * SCREEN_DIGITS);
+
+    ScreenWriteText(screen, "Err");
+    ScreenPublish(screen);
+    ScreenRefresh(screen);
+    TEST_ASSERT_EQUAL_STRING_LEN("E r.r   ", ddram, 2 * SCREEN_DIGITS);
+}
+
+/**
+ * @test Verifica que solo se envian las celdas que cambian y que las consecutivas comparten el movimiento del cursor.
+ */
+void test_only_changed_cells_are_sent_with_batched_cursor_moves(void) {
+    const uint8_t first[SCREEN_DIGITS] = {SEGMENT_B | SEGMENT_C, SEGMENT_B | SEGMENT_C, 0, 0};
+    const uint8_t second[SCREEN_DIGITS] = {SEGMENT_B | SEGMENT_C, SEGMENT_G | SEGMENT_P, SEGMENT_G, 0};
+
+    Hd44780WriteFrame(lcd, first, SCREEN_DIGITS, SCREEN_BRIGHTNESS_MAX);
+    TEST_ASSERT_EQUAL_STRING_LEN("1 1     ", ddram, 2 * SCREEN_DIGITS);
+    TEST_ASSERT_EQUAL_UINT32(1, commands);
+    TEST_ASSERT_EQUAL_UINT32(2, writes);
+
+    commands = 0;
+    writes = 0;
+    Hd44780WriteFrame(lcd, second, SCREEN_DIGITS, SCREEN_BRIGHTNESS_MAX);
+    TEST_ASSERT_EQUAL_STRING_LEN("1 -.-   ", ddram, 2 * SCREEN_DIGITS);
+    TEST_ASSERT_EQUAL_UINT32(1, commands);
+    TEST_ASSERT_EQUAL_UINT32(3, writes);
+
+    commands = 0;
+    writes = 0;
+    Hd44780WriteFrame(lcd, second, SCREEN_DIGITS, 0);
+    TEST_ASSERT_FALSE(display_on);
+    TEST_ASSERT_EQUAL_UINT32(1, commands);
+    TEST_ASSERT_EQUAL_UINT32(0, writes);
+}
+
+/**
+ * @test Verifica la cantidad de transacciones del bus durante un minuto de reloj refrescado cada 5 ms, con el punto
+ * de los segundos parpadeando y un cambio de minuto.
+ */
+void test_transactions_per_minute_of_clock_operation(void) {
+    const uint8_t hours[2] = {9, 0};
+    uint8_t minutes[2] = {9, 5};
+    screen_t screen = ScreenCreate(SCREEN_DIGITS, &lcd_driver);
+    const uint32_t full_redraw = 60 * REFRESH_HZ * (1 + 2 * SCREEN_DIGITS);
+    uint32_t start;
+
+    ScreenWriteTime(screen, hours, minutes);
+    ScreenPublish(screen);
+    ScreenRefresh(screen);
+    TEST_ASSERT_EQUAL_STRING_LEN("0 9 5 9 ", ddram, 2 * SCREEN_DIGITS);
+
+    start = Hd44780GetTransactions(lcd);
+    for (uint32_t tick = 1; tick <= 60 * REFRESH_HZ; tick++) {
+        if (tick == 30 * REFRESH_HZ) {
+            minutes[0] = 0;
+            minutes[1] = 0;
+        }
+        ScreenWriteTime(screen, hours, minutes);
+        if ((tick / REFRESH_HZ) % 2) {
+            ScreenEnablePoint(screen, 1);
+        } else {
+            ScreenDisablePoint(screen, 1);
+        }
+        ScreenPublish(screen);
+        ScreenRefresh(screen);
+    }
+    TEST_ASSERT_EQUAL_STRING_LEN("0 9 0 0 ", ddram, 2 * SCREEN_DIGITS);
+
+    /* 60 cambios del punto con su movimiento de cursor y dos digitos del cambio de minuto, el primero a
+     * continuacion del punto sin mover el cursor */
+    TEST_ASSERT_EQUAL_UINT32(2 * 60 + 3, Hd44780GetTransactions(lcd) - start);
+    /* Reescribir todo en cada refresco seria un posicionamiento del cursor y dos celdas por digito, 108000 por
+     * minuto con 4 digitos a 200 Hz */
+    TEST_ASSERT_LESS_THAN_UINT32(full_redraw / 100, Hd44780GetTransactions(lcd) - start);
+}
+
+/* === Private function definitions ================================================================================ */
+
+static void FakeBus(bool data, uint8_t value) {
+    if (data) {
+        ddram[address % LCD_COLUMNS] = (char)value;
+        address++;
+        writes++;
+        return;
+    }
+    commands++;
+    if (value & 0x80) {
+        address = value & 0x7F;
+    } else if (value == 0x01) {
+        memset(ddram, ' ', LCD_COLUMNS);
+        address = 0;
+    } else if ((value & 0xF8) == 0x08) {
+        display_on = (value & 0x04) != 0;
+    }
+}
+
+static void FakeFrameTransfer(const uint8_t segments[], uint8_t digits, uint8_t brightness) {
+    Hd44780WriteFrame(lcd, segments, digits, brightness);
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,207 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Martin Nicolas Soria <soria.m.nicolas@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, disponiblestribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_max7219.c
+ ** @brief Pruebas unitarias del codificador MAX7219 y del driver de pantalla por cuadros.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "unity.h"
+#include "max7219.h"
+#include "screen.h"
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define SCREEN_DIGITS   4   // Cantidad de digitos de la pantalla de prueba
+#define REFRESH_HZ      200 // Frecuencia con la que la tarea de interfaz refresca la pantalla, una vez cada 5 ms
+#define SIMULATED_SECS  60  // Segundos de funcionamiento del reloj simulados para medir el trafico del bus
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Bus simulado que decodifica cada palabra en el banco de registros de un MAX7219 de prueba
+ *
+ * @param words Palabras enviadas
+ * @param count Cantidad de palabras
+ */
+static void LoopbackBus(const uint16_t words[], uint8_t count);
+
+/**
+ * @brief Envia un cuadro de la pantalla al codificador de prueba
+ *
+ * @param segments Segmentos de cada digito
+ * @param digits Cantidad de digitos
+ * @param brightness Nivel de brillo
+ */
+static void LoopbackFrameTransfer(const uint8_t segments[], uint8_t digits, uint8_t brightness);
+
+/* === Private variable definitions ================================================================================ */
+
+static const struct screen_driver_s frame_driver = {
+    .FrameTransfer = LoopbackFrameTransfer,
+};
+
+static uint8_t registers[16];
+static uint32_t transactions;
+static max7219_t display;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Public function definitions ============================================================================== */
+
+void setUp(void) {
+    memset(registers, 0xAA, sizeof(registers));
+    transactions = 0;
+    display = Max7219Create(SCREEN_DIGITS, LoopbackBus);
+}
+
+/**
+ * @test Verifica que al crear el codificador se configura el controlador y se borran los digitos.
+ */
+void test_create_initializes_controller(void) {
+    TEST_ASSERT_NOT_NULL(display);
+    TEST_ASSERT_EQUAL_HEX8(0x00, registers[0x0F]);
+    TEST_ASSERT_EQUAL_HEX8(0x00, registers[0x09]);
+    TEST_ASSERT_EQUAL_HEX8(SCREEN_DIGITS - 1, registers[0x0B]);
+    TEST_ASSERT_EQUAL_HEX8(0x0F, registers[0x0A]);
+    TEST_ASSERT_EQUAL_HEX8(0x01, registers[0x0C]);
+    TEST_ASSERT_EACH_EQUAL_HEX8(0x00, &registers[1], SCREEN_DIGITS);
+    TEST_ASSERT_EQUAL_UINT32(2 * (5 + SCREEN_DIGITS), Max7219GetBytesSent(display));
+    TEST_ASSERT_NULL(Max7219Create(MAX7219_MAX_DIGITS + 1, LoopbackBus));
+    TEST_ASSERT_NULL(Max7219Create(SCREEN_DIGITS, NULL));
+}
+
+/**
+ * @test Verifica la conversion al orden de bits del controlador y que solo se envian los digitos que cambian.
+ */
+void test_write_frame_sends_only_changed_digits(void) {
+    const uint8_t first[SCREEN_DIGITS] = {SEGMENT_A, SEGMENT_G, SEGMENT_P, 0};
+    const uint8_t second[SCREEN_DIGITS] = {SEGMENT_A, SEGMENT_G, SEGMENT_P, SEGMENT_B | SEGMENT_C};
+    uint32_t bytes = Max7219GetBytesSent(display);
+
+    Max7219WriteFrame(display, first, SCREEN_DIGITS, SCREEN_BRIGHTNESS_MAX);
+    TEST_ASSERT_EQUAL_HEX8(0x40, registers[1]);
+    TEST_ASSERT_EQUAL_HEX8(0x01, registers[2]);
+    TEST_ASSERT_EQUAL_HEX8(0x80, registers[3]);
+    TEST_ASSERT_EQUAL_UINT32(bytes + 2 * 3, Max7219GetBytesSent(display));
+
+    transactions = 0;
+    Max7219WriteFrame(display, second, SCREEN_DIGITS, SCREEN_BRIGHTNESS_MAX);
+    TEST_ASSERT_EQUAL_HEX8(0x30, registers[4]);
+    TEST_ASSERT_EQUAL_UINT32(1, transactions);
+    TEST_ASSERT_EQUAL_UINT32(bytes + 2 * 4, Max7219GetBytesSent(display));
+
+    transactions = 0;
+    Max7219WriteFrame(display, second, SCREEN_DIGITS, SCREEN_BRIGHTNESS_MAX);
+    TEST_ASSERT_EQUAL_UINT32(0, transactions);
+}
+
+/**
+ * @test Verifica que el brillo usa el registro de intensidad y que el nivel 0 apaga el controlador.
+ */
+void test_brightness_maps_to_intensity_and_shutdown(void) {
+    const uint8_t blank[SCREEN_DIGITS] = {0};
+
+    Max7219WriteFrame(display, blank, SCREEN_DIGITS, 6);
+    TEST_ASSERT_EQUAL_HEX8(6, registers[0x0A]);
+    Max7219WriteFrame(display, blank, SCREEN_DIGITS, 0);
+    TEST_ASSERT_EQUAL_HEX8(0, registers[0x0C]);
+    Max7219WriteFrame(display, blank, SCREEN_DIGITS, 3);
+    TEST_ASSERT_EQUAL_HEX8(1, registers[0x0C]);
+    TEST_ASSERT_EQUAL_HEX8(3, registers[0x0A]);
+}
+
+/**
+ * @test Verifica que la pantalla con driver por cuadros solo envia los cuadros que cambian, midiendo los bytes por
+ * segundo del bus durante un minuto de reloj con el punto de los segundos parpadeando.
+ */
+void test_screen_transfers_only_changed_frames(void) {
+    const uint8_t hours[2] = {2, 1};
+    uint8_t minutes[2] = {4, 3};
+    screen_t screen = ScreenCreate(SCREEN_DIGITS, &frame_driver);
+    uint32_t bytes;
+
+    ScreenWriteTime(screen, hours, minutes);
+    ScreenPublish(screen);
+    ScreenRefresh(screen);
+    TEST_ASSERT_EQUAL_HEX8(0x30, registers[1]);
+    TEST_ASSERT_EQUAL_HEX8(0x6D, registers[2]);
+
+    bytes = Max7219GetBytesSent(display);
+    for (uint32_t tick = 1; tick <= SIMULATED_SECS * REFRESH_HZ; tick++) {
+        if (tick == SIMULATED_SECS * REFRESH_HZ / 2) {
+            minutes[0] = 5;
+        }
+        ScreenWriteTime(screen, hours, minutes);
+        if ((tick / REFRESH_HZ) % 2) {
+            ScreenEnablePoint(screen, 1);
+        } else {
+            ScreenDisablePoint(screen, 1);
+        }
+        ScreenPublish(screen);
+        ScreenRefresh(screen);
+    }
+    bytes = Max7219GetBytesSent(display) - bytes;
+
+    /* Un cambio del punto por segundo y un cambio de minuto, contra 1600 B/s de reenviar cada cuadro */
+    TEST_ASSERT_EQUAL_UINT32(2 * (SIMULATED_SECS + 1), bytes);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(3, bytes / SIMULATED_SECS);
+}
+
+/**
+ * @test Verifica que dormir la pantalla solo envia el apagado y que el siguiente refresco la enciende de nuevo.
+ */
+void test_screen_sleep_sends_only_shutdown(void) {
+    uint8_t value[SCREEN_DIGITS] = {1, 2, 3, 4};
+    screen_t screen = ScreenCreate(SCREEN_DIGITS, &frame_driver);
+    uint32_t bytes;
+
+    ScreenWriteBCD(screen, value, SCREEN_DIGITS);
+    ScreenPublish(screen);
+    ScreenRefresh(screen);
+
+    bytes = Max7219GetBytesSent(display);
+    ScreenSleep(screen);
+    TEST_ASSERT_EQUAL_HEX8(0, registers[0x0C]);
+    TEST_ASSERT_EQUAL_UINT32(bytes + 2, Max7219GetBytesSent(display));
+
+    ScreenRefresh(screen);
+    TEST_ASSERT_EQUAL_HEX8(1, registers[0x0C]);
+    TEST_ASSERT_EQUAL_HEX8(0x30, registers[1]);
+    TEST_ASSERT_EQUAL_UINT32(bytes + 2 * 3, Max7219GetBytesSent(display));
+}
+
+/* === Private function definitions ================================================================================ */
+
+static void LoopbackBus(const uint16_t words[], uint8_t count) {
+    for (uint8_t i = 0; i < count; i++) {
+        registers[(words[i] >> 8) & 0x0F] = (uint8_t)words[i];
+    }
+    transactions++;
+}
+
+static void LoopbackFrameTransfer(const uint8_t segments[], uint8_t digits, uint8_t brightness) {
+    Max7219WriteFrame(display, segments, digits, brightness);
+}
+
+/* === End of documentation ======================================================================================== */
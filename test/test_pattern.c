@@ -0,0 +1,154 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Martin Nicolas Soria <soria.m.nicolas@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, disponiblestribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file test_pattern.c
+ ** @brief Pruebas unitarias del reproductor de secuencias de encendido.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "unity.h"
+#include "pattern.h"
+#include "digital.h"
+#include "chip.h"
+
+/* === Macros definitions ========================================================================================== */
+
+#define LED_PORT       0     // Puerto del indicador de prueba
+#define LED_PIN        11    // Pin del indicador de prueba
+#define SIMULATED_MS   60000 // Milisegundos de alarma simulados para contar las escrituras
+#define MORSE_UNIT     150   // Unidad del codigo Morse de la secuencia SOS
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Simula el temporizador que llama a PatternAdvance cada vez que vence el intervalo programado
+ *
+ * @param interval Intervalo programado al comenzar
+ * @param duration Milisegundos a simular
+ * @return uint32_t Cantidad de pasos ejecutados
+ */
+static uint32_t RunTimer(uint32_t interval, uint32_t duration);
+
+/* === Private variable definitions ================================================================================ */
+
+static digital_output_t led;
+static pattern_player_t player;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Public function definitions ============================================================================== */
+
+void setUp(void) {
+    ChipFakeReset();
+    led = DigitalOutputCreate(LED_PORT, LED_PIN, true);
+    player = PatternPlayerCreate(led);
+}
+
+/**
+ * @test Verifica que el parpadeo alterna la salida cada medio segundo empezando encendido.
+ */
+void test_blink_alternates_every_half_second(void) {
+    TEST_ASSERT_EQUAL_UINT32(500, PatternPlay(player, &PATTERN_BLINK));
+    TEST_ASSERT_TRUE(DigitalOutputGetIsActive(led));
+    TEST_ASSERT_EQUAL_UINT8(0, LPC_GPIO_PORT->B[LED_PORT][LED_PIN]);
+
+    TEST_ASSERT_EQUAL_UINT32(500, PatternAdvance(player));
+    TEST_ASSERT_FALSE(DigitalOutputGetIsActive(led));
+    TEST_ASSERT_EQUAL_UINT32(500, PatternAdvance(player));
+    TEST_ASSERT_TRUE(DigitalOutputGetIsActive(led));
+}
+
+/**
+ * @test Verifica que un minuto de alarma solo escribe el registro en los cambios del indicador, contra una escritura
+ * por milisegundo de la tarea del reloj.
+ */
+void test_alarm_minute_writes_only_on_transitions(void) {
+    uint32_t writes = ChipFakeGetWrites();
+    uint32_t steps;
+
+    steps = RunTimer(PatternPlay(player, &PATTERN_BLINK), SIMULATED_MS);
+    TEST_ASSERT_EQUAL_UINT32(SIMULATED_MS / 500, steps);
+    TEST_ASSERT_EQUAL_UINT32(1 + steps, ChipFakeGetWrites() - writes);
+
+    writes = ChipFakeGetWrites();
+    steps = RunTimer(PatternPlay(player, &PATTERN_PULSE), SIMULATED_MS);
+    TEST_ASSERT_EQUAL_UINT32(2 * SIMULATED_MS / 1000, steps);
+    TEST_ASSERT_EQUAL_UINT32(steps, ChipFakeGetWrites() - writes);
+}
+
+/**
+ * @test Verifica la forma de la secuencia SOS: nueve destellos y 34 unidades de periodo.
+ */
+void test_sos_pattern_shape(void) {
+    uint32_t period = 0;
+    uint8_t flashes = 0;
+    uint8_t long_flashes = 0;
+
+    TEST_ASSERT_EQUAL_UINT8(18, PATTERN_SOS.length);
+    for (uint8_t step = 0; step < PATTERN_SOS.length; step++) {
+        period += PATTERN_SOS.durations[step];
+        if ((step & 1) == 0) {
+            flashes++;
+            if (PATTERN_SOS.durations[step] == 3 * MORSE_UNIT) {
+                long_flashes++;
+            }
+        }
+    }
+    TEST_ASSERT_EQUAL_UINT32(34 * MORSE_UNIT, period);
+    TEST_ASSERT_EQUAL_UINT8(9, flashes);
+    TEST_ASSERT_EQUAL_UINT8(3, long_flashes);
+}
+
+/**
+ * @test Verifica que detener el reproductor apaga el indicador y que despues no quedan pasos pendientes.
+ */
+void test_stop_turns_output_off(void) {
+    PatternPlay(player, &PATTERN_SOS);
+    PatternAdvance(player);
+    PatternAdvance(player);
+    TEST_ASSERT_TRUE(DigitalOutputGetIsActive(led));
+
+    TEST_ASSERT_EQUAL_UINT32(0, PatternPlay(player, NULL));
+    TEST_ASSERT_FALSE(DigitalOutputGetIsActive(led));
+    TEST_ASSERT_EQUAL_UINT32(0, PatternAdvance(player));
+    TEST_ASSERT_FALSE(DigitalOutputGetIsActive(led));
+
+    TEST_ASSERT_NULL(PatternPlayerCreate(NULL));
+    TEST_ASSERT_EQUAL_UINT32(0, PatternAdvance(NULL));
+}
+
+/* === Private function definitions ================================================================================ */
+
+static uint32_t RunTimer(uint32_t interval, uint32_t duration) {
+    uint32_t steps = 0;
+    uint32_t elapsed = interval;
+
+    while (interval != 0 && elapsed <= duration) {
+        interval = PatternAdvance(player);
+        elapsed += interval;
+        steps++;
+    }
+    return steps;
+}
+
+/* === End of documentation ======================================================================================== */
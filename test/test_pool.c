@@ -0,0 +1,71 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Martin Nicolas Soria <soria.m.nicolas@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, disponiblestribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file test_pool.c
+ ** @brief Pruebas de la reserva desde arreglos estaticos que usan los modulos con STATIC_ALLOCATION.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#define STATIC_ALLOCATION 1
+
+#include "unity.h"
+#include "pool.h"
+
+/* === Macros definitions ========================================================================================== */
+
+#define POOL_SIZE 3 // Cantidad de objetos del arreglo de prueba
+
+/* === Private data type declarations ============================================================================== */
+
+//! Objeto de prueba
+struct item_s {
+    uint32_t value; //!< Dato cualquiera
+};
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+
+POOL_DECLARE(struct item_s, item_pool, POOL_SIZE)
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Public function definitions ============================================================================== */
+
+/**
+ * @test Verifica que el arreglo entrega objetos distintos hasta agotarse y despues devuelve NULL, como malloc sin
+ * memoria.
+ */
+void test_pool_hands_out_each_object_once(void) {
+    struct item_s * items[POOL_SIZE];
+
+    for (uint8_t i = 0; i < POOL_SIZE; i++) {
+        items[i] = POOL_ALLOC(struct item_s, item_pool);
+        TEST_ASSERT_NOT_NULL(items[i]);
+        for (uint8_t j = 0; j < i; j++) {
+            TEST_ASSERT_TRUE(items[i] != items[j]);
+        }
+    }
+    TEST_ASSERT_NULL(POOL_ALLOC(struct item_s, item_pool));
+    TEST_ASSERT_NULL(POOL_ALLOC(struct item_s, item_pool));
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,137 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Martin Nicolas Soria <soria.m.nicolas@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, disponiblestribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file test_probe.c
+ ** @brief Pruebas unitarias de las sondas de los caminos criticos.
+ **
+ ** Se compilan con PROBE_ENABLED en 1, que project.yml define solo para esta prueba.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "unity.h"
+#include "probe.h"
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+
+static probe_stats_t stats;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Public function definitions ================================================================================= */
+
+void setUp(void) {
+    ProbeReset();
+}
+
+/**
+ * @test Una sonda sin mediciones no tiene resumen.
+ */
+void test_probe_without_samples_has_no_stats(void) {
+    TEST_ASSERT_FALSE(ProbeGetStats(PROBE_CLOCK_TICK, &stats));
+    TEST_ASSERT_EQUAL_UINT32(0, stats.count);
+}
+
+/**
+ * @test Con una sola medicion todos los valores del resumen son esa medicion.
+ */
+void test_single_sample(void) {
+    ProbeRecord(PROBE_UI_RENDER, 1234);
+    TEST_ASSERT_TRUE(ProbeGetStats(PROBE_UI_RENDER, &stats));
+    TEST_ASSERT_EQUAL_UINT32(1, stats.count);
+    TEST_ASSERT_EQUAL_UINT32(1234, stats.min);
+    TEST_ASSERT_EQUAL_UINT32(1234, stats.max);
+    TEST_ASSERT_EQUAL_UINT32(1234, stats.mean);
+    TEST_ASSERT_EQUAL_UINT32(1234, stats.p50);
+    TEST_ASSERT_EQUAL_UINT32(1234, stats.p99);
+}
+
+/**
+ * @test Cada sonda acumula por separado su minimo, maximo y promedio.
+ */
+void test_min_max_mean_per_probe(void) {
+    ProbeRecord(PROBE_SCREEN_REFRESH, 30);
+    ProbeRecord(PROBE_SCREEN_REFRESH, 10);
+    ProbeRecord(PROBE_SCREEN_REFRESH, 50);
+    ProbeRecord(PROBE_DIGITAL_CHANGED, 7);
+
+    TEST_ASSERT_TRUE(ProbeGetStats(PROBE_SCREEN_REFRESH, &stats));
+    TEST_ASSERT_EQUAL_UINT32(3, stats.count);
+    TEST_ASSERT_EQUAL_UINT32(10, stats.min);
+    TEST_ASSERT_EQUAL_UINT32(50, stats.max);
+    TEST_ASSERT_EQUAL_UINT32(30, stats.mean);
+    TEST_ASSERT_TRUE(ProbeGetStats(PROBE_DIGITAL_CHANGED, &stats));
+    TEST_ASSERT_EQUAL_UINT32(1, stats.count);
+}
+
+/**
+ * @test Los percentiles son el limite superior del intervalo del histograma, sin pasar el maximo.
+ */
+void test_percentiles_from_histogram(void) {
+    for (uint32_t value = 1; value <= 100; value++) {
+        ProbeRecord(PROBE_CLOCK_TICK, value);
+    }
+    TEST_ASSERT_TRUE(ProbeGetStats(PROBE_CLOCK_TICK, &stats));
+    TEST_ASSERT_EQUAL_UINT32(55, stats.p50);
+    TEST_ASSERT_EQUAL_UINT32(95, stats.p90);
+    TEST_ASSERT_EQUAL_UINT32(100, stats.p99);
+}
+
+/**
+ * @test Las mediciones que pasan el ultimo intervalo se informan con el maximo.
+ */
+void test_percentiles_beyond_histogram_use_maximum(void) {
+    ProbeRecord(PROBE_CLOCK_TICK, 10);
+    ProbeRecord(PROBE_CLOCK_TICK, 500000);
+    ProbeRecord(PROBE_CLOCK_TICK, 900000);
+    TEST_ASSERT_TRUE(ProbeGetStats(PROBE_CLOCK_TICK, &stats));
+    TEST_ASSERT_EQUAL_UINT32(900000, stats.p50);
+    TEST_ASSERT_EQUAL_UINT32(900000, stats.p99);
+}
+
+/**
+ * @test Las sondas que no existen se ignoran.
+ */
+void test_invalid_probe_is_ignored(void) {
+    ProbeRecord(PROBE_COUNT, 10);
+    TEST_ASSERT_FALSE(ProbeGetStats(PROBE_COUNT, &stats));
+    TEST_ASSERT_NULL(ProbeName(PROBE_COUNT));
+    TEST_ASSERT_EQUAL_STRING("ui_render", ProbeName(PROBE_UI_RENDER));
+}
+
+/**
+ * @test Las macros miden el tramo que encierran y lo registran en su sonda.
+ */
+void test_begin_end_records_one_sample(void) {
+    PROBE_BEGIN(PROBE_DIGITAL_CHANGED);
+    PROBE_END(PROBE_DIGITAL_CHANGED);
+    TEST_ASSERT_TRUE(ProbeGetStats(PROBE_DIGITAL_CHANGED, &stats));
+    TEST_ASSERT_EQUAL_UINT32(1, stats.count);
+}
+
+/* === Private function definitions ================================================================================ */
+
+/* === End of documentation ======================================================================================== */
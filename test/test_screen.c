@@ -0,0 +1,854 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Martin Nicolas Soria <soria.m.nicolas@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, disponiblestribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_screen.c
+ ** @brief Pruebas unitarias para el modulo de pantalla de 7 segmentos.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "unity.h"
+#include "screen.h"
+#include <pthread.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define SCREEN_DIGITS  4   // Cantidad de digitos de la pantalla de prueba
+#define REFRESH_PERIOD 1250 // Periodo del barrido en cuentas del temporizador simulado (800 Hz a 1 MHz)
+#define EVENTS_MAX     256  // Cantidad maxima de llamadas registradas al driver
+#define PUBLISH_COUNT  20000 // Cuadros publicados por el escritor en la prueba de concurrencia
+
+#define GLYPH_OF(character) ScreenCharToSegments(character) // Segmentos esperados para un caracter
+
+/* === Private data type declarations ============================================================================== */
+
+/** @brief Llamada registrada al driver simulado */
+typedef struct driver_event_s {
+    char action;   /**< 'O' apagar digitos, 'S' actualizar segmentos, 'D' encender digito, 'C' digito completo */
+    uint8_t value; /**< Segmentos o digito involucrado */
+    uint8_t extra; /**< Segmentos de un digito completo */
+} driver_event_t;
+
+/* === Private function declarations =============================================================================== */
+
+static void FakeDigitsTurnOff(void);
+static void FakeSegmentsUpdate(uint8_t segments);
+static void FakeDigitTurnOn(uint8_t digit);
+static void FakeDigitCommit(uint8_t digit, uint8_t segments);
+
+/**
+ * @brief Simula la interrupcion del temporizador de barrido, que adelanta el match con el intervalo devuelto
+ *
+ * @param latency Demora en cuentas con la que se atiende la interrupcion
+ * @return uint32_t Intervalo programado hasta la proxima interrupcion
+ */
+static uint32_t FakeTimerFire(uint32_t latency);
+
+/**
+ * @brief Realiza un barrido completo de la pantalla y devuelve los segmentos mostrados en cada digito
+ *
+ * @param shown Arreglo donde se guardan los segmentos de cada digito
+ */
+static void ScanOnce(uint8_t shown[SCREEN_DIGITS]);
+
+/**
+ * @brief Hilo escritor que compone y publica cuadros con todos los digitos iguales
+ *
+ * @param arguments No utilizado
+ * @return void* Siempre NULL
+ */
+static void * WriterThread(void * arguments);
+
+/* === Private variable definitions ================================================================================ */
+
+static const struct screen_driver_s fake_driver = {
+    .DigitsTurnOff = FakeDigitsTurnOff,
+    .SegmentsUpdate = FakeSegmentsUpdate,
+    .DigitTurnOn = FakeDigitTurnOn,
+};
+
+static const struct screen_driver_s commit_driver = {
+    .DigitsTurnOff = FakeDigitsTurnOff,
+    .SegmentsUpdate = FakeSegmentsUpdate,
+    .DigitTurnOn = FakeDigitTurnOn,
+    .DigitCommit = FakeDigitCommit,
+};
+
+static driver_event_t events[EVENTS_MAX];
+static uint16_t events_count;
+static uint32_t timer_match;
+static uint32_t timer_interval;
+static screen_t screen;
+static int writer_done;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Public function definitions ============================================================================== */
+
+void setUp(void) {
+    memset(events, 0, sizeof(events));
+    events_count = 0;
+    timer_match = 0;
+    timer_interval = REFRESH_PERIOD;
+    screen = ScreenCreate(SCREEN_DIGITS, &fake_driver);
+    ScreenSetRefreshPeriod(screen, REFRESH_PERIOD);
+    for (int i = 1; i < SCREEN_DIGITS; i++) {
+        ScreenRefresh(screen);
+    }
+    events_count = 0;
+}
+
+/**
+ * @test Verifica que cada interrupcion del temporizador barre un solo digito, en orden y de forma ciclica.
+ */
+void test_timed_refresh_scans_one_digit_per_interrupt(void) {
+    for (int i = 0; i < 2 * SCREEN_DIGITS; i++) {
+        FakeTimerFire(0);
+    }
+    TEST_ASSERT_EQUAL(3 * 2 * SCREEN_DIGITS, events_count);
+    for (int i = 0; i < 2 * SCREEN_DIGITS; i++) {
+        TEST_ASSERT_EQUAL_CHAR('O', events[3 * i].action);
+        TEST_ASSERT_EQUAL_CHAR('S', events[3 * i + 1].action);
+        TEST_ASSERT_EQUAL_CHAR('D', events[3 * i + 2].action);
+        TEST_ASSERT_EQUAL_UINT8(i % SCREEN_DIGITS, events[3 * i + 2].value);
+    }
+}
+
+/**
+ * @test Verifica que con un temporizador sin demoras el jitter medido es nulo.
+ */
+void test_timed_refresh_without_latency_has_no_jitter(void) {
+    screen_jitter_t stats;
+
+    for (int i = 0; i < 100; i++) {
+        FakeTimerFire(0);
+    }
+    TEST_ASSERT_TRUE(ScreenGetJitter(screen, &stats));
+    TEST_ASSERT_EQUAL_UINT32(REFRESH_PERIOD, stats.period);
+    TEST_ASSERT_EQUAL_UINT32(99, stats.count);
+    TEST_ASSERT_EQUAL_INT32(0, stats.min);
+    TEST_ASSERT_EQUAL_INT32(0, stats.max);
+    TEST_ASSERT_EQUAL_UINT32(0, (uint32_t)stats.sum_abs);
+}
+
+/**
+ * @test Verifica que las demoras en la atencion de la interrupcion se registran como jitter y no acumulan deriva.
+ */
+void test_timed_refresh_records_latency_as_jitter(void) {
+    screen_jitter_t stats;
+
+    FakeTimerFire(0);
+    FakeTimerFire(30);
+    FakeTimerFire(0);
+    FakeTimerFire(5);
+    FakeTimerFire(5);
+    TEST_ASSERT_TRUE(ScreenGetJitter(screen, &stats));
+    TEST_ASSERT_EQUAL_UINT32(4, stats.count);
+    TEST_ASSERT_EQUAL_INT32(-30, stats.min);
+    TEST_ASSERT_EQUAL_INT32(30, stats.max);
+    TEST_ASSERT_EQUAL_INT32(0, stats.last);
+    TEST_ASSERT_EQUAL_UINT32(65, (uint32_t)stats.sum_abs);
+}
+
+/**
+ * @test Verifica que cambiar el periodo reinicia las estadisticas y que no se aceptan parametros nulos.
+ */
+void test_set_refresh_period_resets_jitter(void) {
+    screen_jitter_t stats;
+
+    FakeTimerFire(0);
+    FakeTimerFire(10);
+    ScreenSetRefreshPeriod(screen, 2 * REFRESH_PERIOD);
+    TEST_ASSERT_TRUE(ScreenGetJitter(screen, &stats));
+    TEST_ASSERT_EQUAL_UINT32(2 * REFRESH_PERIOD, stats.period);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.count);
+    TEST_ASSERT_FALSE(ScreenGetJitter(screen, NULL));
+    TEST_ASSERT_FALSE(ScreenGetJitter(NULL, &stats));
+}
+
+/**
+ * @test Verifica que un digito parpadea conservando su punto y que el parpadeo de puntos no afecta al digito.
+ */
+void test_blink_attributes_precompose_both_phases(void) {
+    uint8_t value[SCREEN_DIGITS] = {1, 2, 3, 4};
+    uint8_t shown[SCREEN_DIGITS];
+
+    ScreenWriteBCD(screen, value, SCREEN_DIGITS);
+    ScreenEnablePoint(screen, 0);
+    ScreenEnablePoint(screen, 3);
+    TEST_ASSERT_EQUAL(0, DisplayFlashDigit(screen, 0, 0, 1));
+    TEST_ASSERT_EQUAL(0, DisplayFlashPoints(screen, 3, 3, 1));
+
+    ScreenPublish(screen);
+    ScanOnce(shown);
+    TEST_ASSERT_EQUAL_HEX8(SEGMENT_P, shown[0]);
+    TEST_ASSERT_EQUAL_HEX8(SEGMENT_A | SEGMENT_B | SEGMENT_D | SEGMENT_E | SEGMENT_G, shown[1]);
+    TEST_ASSERT_EQUAL_HEX8(SEGMENT_B | SEGMENT_C | SEGMENT_F | SEGMENT_G, shown[3]);
+
+    ScanOnce(shown);
+    TEST_ASSERT_EQUAL_HEX8(SEGMENT_B | SEGMENT_C | SEGMENT_P, shown[0]);
+    TEST_ASSERT_EQUAL_HEX8(SEGMENT_B | SEGMENT_C | SEGMENT_F | SEGMENT_G | SEGMENT_P, shown[3]);
+}
+
+/**
+ * @test Verifica que varias regiones independientes pueden parpadear al mismo tiempo.
+ */
+void test_several_blink_regions_work_together(void) {
+    uint8_t value[SCREEN_DIGITS] = {8, 8, 8, 8};
+    uint8_t shown[SCREEN_DIGITS];
+
+    ScreenWriteBCD(screen, value, SCREEN_DIGITS);
+    TEST_ASSERT_EQUAL(0, DisplayFlashDigit(screen, 0, 0, 1));
+    TEST_ASSERT_EQUAL(0, ScreenSetAttributes(screen, 2, 3, SCREEN_ATTR_BLINK));
+    TEST_ASSERT_EQUAL_HEX8(SCREEN_ATTR_BLINK, ScreenGetAttributes(screen, 3));
+    TEST_ASSERT_EQUAL_HEX8(0, ScreenGetAttributes(screen, 1));
+
+    ScreenPublish(screen);
+    ScanOnce(shown);
+    TEST_ASSERT_EQUAL_HEX8(0, shown[0]);
+    TEST_ASSERT_EQUAL_HEX8(0x7F, shown[1]);
+    TEST_ASSERT_EQUAL_HEX8(0, shown[2]);
+    TEST_ASSERT_EQUAL_HEX8(0, shown[3]);
+
+    TEST_ASSERT_EQUAL(0, ScreenClearAttributes(screen, 3, 3, SCREEN_ATTR_BLINK));
+    ScanOnce(shown);
+    ScreenPublish(screen);
+    ScanOnce(shown);
+    TEST_ASSERT_EQUAL_HEX8(0, shown[2]);
+    TEST_ASSERT_EQUAL_HEX8(0x7F, shown[3]);
+}
+
+/**
+ * @test Verifica que un digito en blanco conserva su valor y vuelve a mostrarse al quitar el atributo.
+ */
+void test_blank_attribute_keeps_value(void) {
+    uint8_t value[SCREEN_DIGITS] = {8, 8, 8, 8};
+    uint8_t shown[SCREEN_DIGITS];
+
+    ScreenWriteBCD(screen, value, SCREEN_DIGITS);
+    ScreenSetAttributes(screen, 1, 1, SCREEN_ATTR_BLANK | SCREEN_ATTR_POINT);
+    ScreenPublish(screen);
+    ScanOnce(shown);
+    TEST_ASSERT_EQUAL_HEX8(SEGMENT_P, shown[1]);
+
+    ScreenClearAttributes(screen, 1, 1, SCREEN_ATTR_BLANK);
+    ScreenPublish(screen);
+    ScanOnce(shown);
+    TEST_ASSERT_EQUAL_HEX8(0xFF, shown[1]);
+    TEST_ASSERT_EQUAL(-1, ScreenSetAttributes(screen, 2, 1, SCREEN_ATTR_BLANK));
+    TEST_ASSERT_EQUAL(-1, ScreenClearAttributes(NULL, 0, 1, SCREEN_ATTR_BLANK));
+}
+
+/**
+ * @test Verifica que repetir la misma configuracion de parpadeo no reinicia la fase.
+ */
+void test_repeated_flash_configuration_keeps_phase(void) {
+    uint8_t value[SCREEN_DIGITS] = {8, 8, 8, 8};
+    uint8_t shown[SCREEN_DIGITS];
+
+    ScreenWriteBCD(screen, value, SCREEN_DIGITS);
+    DisplayFlashDigit(screen, 0, 3, 1);
+    ScreenPublish(screen);
+    ScanOnce(shown);
+    TEST_ASSERT_EQUAL_HEX8(0, shown[1]);
+    DisplayFlashDigit(screen, 0, 3, 1);
+    ScreenPublish(screen);
+    ScanOnce(shown);
+    TEST_ASSERT_EQUAL_HEX8(0x7F, shown[1]);
+    DisplayFlashDigit(screen, 0, 3, 0);
+    ScreenPublish(screen);
+    ScanOnce(shown);
+    TEST_ASSERT_EQUAL_HEX8(0x7F, shown[1]);
+}
+
+/**
+ * @test Verifica que las escrituras no se muestran hasta publicar el cuadro.
+ */
+void test_writes_are_shown_only_after_publish(void) {
+    uint8_t value[SCREEN_DIGITS] = {1, 1, 1, 1};
+    uint8_t shown[SCREEN_DIGITS];
+
+    ScreenWriteBCD(screen, value, SCREEN_DIGITS);
+    ScanOnce(shown);
+    TEST_ASSERT_EACH_EQUAL_HEX8(0, shown, SCREEN_DIGITS);
+
+    ScreenPublish(screen);
+    ScreenEnablePoint(screen, 2);
+    ScanOnce(shown);
+    TEST_ASSERT_EACH_EQUAL_HEX8(SEGMENT_B | SEGMENT_C, shown, SCREEN_DIGITS);
+
+    ScreenPublish(screen);
+    ScanOnce(shown);
+    TEST_ASSERT_EQUAL_HEX8(SEGMENT_B | SEGMENT_C | SEGMENT_P, shown[2]);
+    TEST_ASSERT_EQUAL_HEX8(SEGMENT_B | SEGMENT_C, shown[3]);
+}
+
+/**
+ * @test Verifica que con un escritor concurrente ningun barrido muestra un cuadro mezclado o a medio componer.
+ */
+void test_concurrent_publish_never_shows_torn_frame(void) {
+    pthread_t writer;
+    uint8_t shown[SCREEN_DIGITS];
+    uint32_t scans = 0;
+
+    __atomic_store_n(&writer_done, 0, __ATOMIC_RELEASE);
+    TEST_ASSERT_EQUAL(0, pthread_create(&writer, NULL, WriterThread, NULL));
+    while (!__atomic_load_n(&writer_done, __ATOMIC_ACQUIRE) || scans == 0) {
+        ScanOnce(shown);
+        if (shown[0] != 0) {
+            for (int i = 1; i < SCREEN_DIGITS; i++) {
+                TEST_ASSERT_EQUAL_HEX8(shown[0], shown[i]);
+            }
+        }
+        scans++;
+    }
+    pthread_join(writer, NULL);
+}
+
+/**
+ * @test Verifica que con brillo intermedio cada digito se divide en subcuadros binarios que suman el periodo.
+ */
+void test_brightness_uses_binary_code_modulation(void) {
+    uint8_t value[SCREEN_DIGITS] = {8, 8, 8, 8};
+    uint32_t total = 0;
+    uint32_t lit = 0;
+
+    ScreenWriteBCD(screen, value, SCREEN_DIGITS);
+    TEST_ASSERT_EQUAL(0, ScreenSetBrightness(screen, 5));
+    ScreenPublish(screen);
+
+    for (int plane = 0; plane < SCREEN_BRIGHTNESS_BITS; plane++) {
+        uint32_t interval;
+
+        events_count = 0;
+        interval = FakeTimerFire(0);
+        total += interval;
+        if (plane < SCREEN_BRIGHTNESS_BITS - 1) {
+            TEST_ASSERT_EQUAL_UINT32((REFRESH_PERIOD / 15) << plane, interval);
+        }
+        if (5 & (1 << plane)) {
+            lit += interval;
+            TEST_ASSERT_EQUAL(3, events_count);
+            TEST_ASSERT_EQUAL_HEX8(0x7F, events[1].value);
+            TEST_ASSERT_EQUAL_UINT8(0, events[2].value);
+        } else {
+            TEST_ASSERT_EQUAL(1, events_count);
+            TEST_ASSERT_EQUAL_CHAR('O', events[0].action);
+        }
+    }
+    TEST_ASSERT_EQUAL_UINT32(REFRESH_PERIOD, total);
+    TEST_ASSERT_EQUAL_UINT32(5 * (REFRESH_PERIOD / 15), lit);
+
+    events_count = 0;
+    FakeTimerFire(0);
+    TEST_ASSERT_EQUAL_UINT8(1, events[2].value);
+}
+
+/**
+ * @test Verifica que un periodo menor que el minimo se lleva al minimo y ningun subcuadro queda con duracion nula.
+ */
+void test_refresh_period_below_minimum_is_clamped(void) {
+    uint8_t value[SCREEN_DIGITS] = {8, 8, 8, 8};
+    screen_jitter_t stats;
+
+    ScreenSetRefreshPeriod(screen, SCREEN_MIN_REFRESH_PERIOD / 2);
+    TEST_ASSERT_TRUE(ScreenGetJitter(screen, &stats));
+    TEST_ASSERT_EQUAL_UINT32(SCREEN_MIN_REFRESH_PERIOD, stats.period);
+
+    ScreenWriteBCD(screen, value, SCREEN_DIGITS);
+    TEST_ASSERT_EQUAL(0, ScreenSetBrightness(screen, 5));
+    ScreenPublish(screen);
+    for (int plane = 0; plane < SCREEN_BRIGHTNESS_BITS; plane++) {
+        TEST_ASSERT_EQUAL_UINT32(1u << plane, FakeTimerFire(0));
+    }
+}
+
+/**
+ * @test Verifica que el brillo nulo deja la pantalla a oscuras y que no se aceptan niveles invalidos.
+ */
+void test_brightness_zero_blanks_and_invalid_levels_fail(void) {
+    uint8_t value[SCREEN_DIGITS] = {8, 8, 8, 8};
+
+    TEST_ASSERT_EQUAL(-1, ScreenSetBrightness(screen, SCREEN_BRIGHTNESS_LEVELS));
+    TEST_ASSERT_EQUAL(-1, ScreenSetBrightness(NULL, 1));
+    ScreenWriteBCD(screen, value, SCREEN_DIGITS);
+    ScreenSetBrightness(screen, 0);
+    ScreenPublish(screen);
+
+    for (int i = 0; i < SCREEN_DIGITS * SCREEN_BRIGHTNESS_BITS; i++) {
+        FakeTimerFire(0);
+    }
+    for (int i = 0; i < events_count; i++) {
+        TEST_ASSERT_EQUAL_CHAR('O', events[i].action);
+    }
+}
+
+/**
+ * @test Verifica que el jitter se mide contra el intervalo de cada subcuadro y no contra el periodo por digito.
+ */
+void test_jitter_follows_subframe_intervals(void) {
+    screen_jitter_t stats;
+
+    ScreenSetBrightness(screen, 9);
+    ScreenPublish(screen);
+    for (int i = 0; i < 64; i++) {
+        FakeTimerFire(0);
+    }
+    FakeTimerFire(7);
+    TEST_ASSERT_TRUE(ScreenGetJitter(screen, &stats));
+    TEST_ASSERT_EQUAL_INT32(0, stats.min);
+    TEST_ASSERT_EQUAL_INT32(7, stats.max);
+}
+
+/**
+ * @test Verifica que los valores BCD hexadecimales tienen glifo y los fuera de rango muestran el glifo invalido.
+ */
+void test_write_bcd_shows_hex_and_invalid_values(void) {
+    uint8_t value[SCREEN_DIGITS] = {0x0A, 0x0F, 0x10, 0xFF};
+    uint8_t shown[SCREEN_DIGITS];
+
+    ScreenWriteBCD(screen, value, SCREEN_DIGITS);
+    ScreenPublish(screen);
+    ScanOnce(shown);
+    TEST_ASSERT_EQUAL_HEX8(ScreenCharToSegments('A'), shown[0]);
+    TEST_ASSERT_EQUAL_HEX8(ScreenCharToSegments('F'), shown[1]);
+    TEST_ASSERT_EQUAL_HEX8(SCREEN_GLYPH_INVALID, shown[2]);
+    TEST_ASSERT_EQUAL_HEX8(SCREEN_GLYPH_INVALID, shown[3]);
+}
+
+/**
+ * @test Verifica que los segmentos crudos se muestran sin conversion y los digitos sobrantes quedan apagados.
+ */
+void test_write_segments_shows_raw_codes(void) {
+    const uint8_t segments[] = {SEGMENT_A, SEGMENT_G | SEGMENT_P};
+    uint8_t shown[SCREEN_DIGITS];
+
+    ScreenWriteSegments(screen, segments, sizeof(segments));
+    ScreenPublish(screen);
+    ScanOnce(shown);
+    TEST_ASSERT_EQUAL_HEX8(SEGMENT_A, shown[0]);
+    TEST_ASSERT_EQUAL_HEX8(SEGMENT_G | SEGMENT_P, shown[1]);
+    TEST_ASSERT_EQUAL_HEX8(0, shown[2]);
+    TEST_ASSERT_EQUAL_HEX8(0, shown[3]);
+}
+
+/**
+ * @test Verifica que el texto se convierte caracter a caracter y el punto se agrega al digito anterior.
+ */
+void test_write_text_merges_points_into_previous_digit(void) {
+    uint8_t shown[SCREEN_DIGITS];
+
+    TEST_ASSERT_EQUAL_UINT8(3, ScreenWriteText(screen, "Err"));
+    ScreenPublish(screen);
+    ScanOnce(shown);
+    TEST_ASSERT_EQUAL_HEX8(SEGMENT_A | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G, shown[0]);
+    TEST_ASSERT_EQUAL_HEX8(SEGMENT_E | SEGMENT_G, shown[1]);
+    TEST_ASSERT_EQUAL_HEX8(SEGMENT_E | SEGMENT_G, shown[2]);
+    TEST_ASSERT_EQUAL_HEX8(0, shown[3]);
+
+    TEST_ASSERT_EQUAL_UINT8(4, ScreenWriteText(screen, "12.3..45"));
+    ScreenPublish(screen);
+    ScanOnce(shown);
+    TEST_ASSERT_EQUAL_HEX8(SEGMENT_B | SEGMENT_C, shown[0]);
+    TEST_ASSERT_EQUAL_HEX8(ScreenCharToSegments('2') | SEGMENT_P, shown[1]);
+    TEST_ASSERT_EQUAL_HEX8(ScreenCharToSegments('3') | SEGMENT_P, shown[2]);
+    TEST_ASSERT_EQUAL_HEX8(SEGMENT_P, shown[3]);
+}
+
+/**
+ * @test Verifica que los caracteres sin representacion, incluso fuera de ASCII, usan el glifo invalido.
+ */
+void test_unsupported_characters_use_invalid_glyph(void) {
+    TEST_ASSERT_EQUAL_HEX8(SCREEN_GLYPH_INVALID, ScreenCharToSegments('M'));
+    TEST_ASSERT_EQUAL_HEX8(SCREEN_GLYPH_INVALID, ScreenCharToSegments('\n'));
+    TEST_ASSERT_EQUAL_HEX8(SCREEN_GLYPH_INVALID, ScreenCharToSegments((char)0xE9));
+    TEST_ASSERT_EQUAL_HEX8(0, ScreenCharToSegments(' '));
+    TEST_ASSERT_EQUAL_HEX8(SEGMENT_G, ScreenCharToSegments('-'));
+}
+
+/**
+ * @test Verifica que la marquesina entra por la derecha, avanza una posicion cada divisor barridos y avisa al salir.
+ */
+void test_marquee_scrolls_text_and_reports_completion(void) {
+    uint8_t shown[SCREEN_DIGITS];
+    const uint8_t expected[SCREEN_DIGITS] = {GLYPH_OF('1'), GLYPH_OF('2'), GLYPH_OF('3'), GLYPH_OF('4')};
+
+    TEST_ASSERT_EQUAL(0, ScreenWriteMarquee(screen, "123456", 2));
+    ScreenPublish(screen);
+    ScanOnce(shown);
+    TEST_ASSERT_EACH_EQUAL_HEX8(0, shown, SCREEN_DIGITS);
+    ScanOnce(shown);
+    ScanOnce(shown);
+    TEST_ASSERT_EQUAL_HEX8(0, shown[2]);
+    TEST_ASSERT_EQUAL_HEX8(GLYPH_OF('1'), shown[3]);
+
+    for (int i = 0; i < 6; i++) {
+        ScreenPublish(screen);
+        ScanOnce(shown);
+    }
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, shown, SCREEN_DIGITS);
+    TEST_ASSERT_FALSE(ScreenMarqueeFinished(screen));
+
+    for (int i = 0; i < 12; i++) {
+        ScanOnce(shown);
+    }
+    TEST_ASSERT_EACH_EQUAL_HEX8(0, shown, SCREEN_DIGITS);
+    TEST_ASSERT_TRUE(ScreenMarqueeFinished(screen));
+}
+
+/**
+ * @test Verifica que una marquesina nueva no se informa terminada aunque se escriban muchas despues de la ultima
+ * que termino el refresco.
+ */
+void test_marquee_finished_survives_many_new_marquees(void) {
+    uint8_t shown[SCREEN_DIGITS];
+
+    TEST_ASSERT_EQUAL(0, ScreenWriteMarquee(screen, "1", 1));
+    ScreenPublish(screen);
+    for (int i = 0; i < 10; i++) {
+        ScanOnce(shown);
+    }
+    TEST_ASSERT_TRUE(ScreenMarqueeFinished(screen));
+
+    for (int i = 0; i < 1000; i++) {
+        TEST_ASSERT_EQUAL(0, ScreenWriteMarquee(screen, "1", 1));
+        TEST_ASSERT_FALSE(ScreenMarqueeFinished(screen));
+    }
+}
+
+/**
+ * @test Verifica que cualquier otra escritura cancela la marquesina y que se rechazan secuencias invalidas.
+ */
+void test_marquee_is_cancelled_by_writes_and_checks_arguments(void) {
+    uint8_t value[SCREEN_DIGITS] = {1, 2, 3, 4};
+    uint8_t segments[SCREEN_MARQUEE_LENGTH] = {0};
+    uint8_t shown[SCREEN_DIGITS];
+
+    TEST_ASSERT_EQUAL(0, ScreenWriteMarqueeSegments(screen, segments, SCREEN_MARQUEE_LENGTH - 2 * SCREEN_DIGITS, 1));
+    TEST_ASSERT_EQUAL(-1, ScreenWriteMarqueeSegments(screen, segments, SCREEN_MARQUEE_LENGTH, 1));
+    TEST_ASSERT_EQUAL(-1, ScreenWriteMarquee(screen, "HOLA", 0));
+    ScreenPublish(screen);
+    ScanOnce(shown);
+    TEST_ASSERT_EACH_EQUAL_HEX8(0, shown, SCREEN_DIGITS);
+
+    ScreenWriteBCD(screen, value, SCREEN_DIGITS);
+    ScreenPublish(screen);
+    ScanOnce(shown);
+    TEST_ASSERT_EQUAL_HEX8(GLYPH_OF('1'), shown[0]);
+    TEST_ASSERT_EQUAL_HEX8(GLYPH_OF('4'), shown[3]);
+    TEST_ASSERT_FALSE(ScreenMarqueeFinished(screen));
+}
+
+/**
+ * @test Verifica que la hora se muestra igual que con ScreenWriteBCD y los valores fuera de rango son invalidos.
+ */
+void test_write_time_matches_bcd_and_marks_invalid_values(void) {
+    const uint8_t hours[2] = {3, 2};
+    const uint8_t minutes[2] = {9, 5};
+    const uint8_t bad_hours[2] = {4, 2};
+    uint8_t value[SCREEN_DIGITS] = {2, 3, 5, 9};
+    uint8_t expected[SCREEN_DIGITS];
+    uint8_t shown[SCREEN_DIGITS];
+
+    ScreenWriteBCD(screen, value, SCREEN_DIGITS);
+    ScreenPublish(screen);
+    ScanOnce(expected);
+
+    ScreenWriteText(screen, "----");
+    TEST_ASSERT_EQUAL(0, ScreenWriteTime(screen, hours, minutes));
+    ScreenPublish(screen);
+    ScanOnce(shown);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, shown, SCREEN_DIGITS);
+
+    TEST_ASSERT_EQUAL(0, ScreenWriteTime(screen, bad_hours, minutes));
+    ScreenPublish(screen);
+    ScanOnce(shown);
+    TEST_ASSERT_EQUAL_HEX8(SCREEN_GLYPH_INVALID, shown[0]);
+    TEST_ASSERT_EQUAL_HEX8(SCREEN_GLYPH_INVALID, shown[1]);
+    TEST_ASSERT_EQUAL_HEX8(expected[3], shown[3]);
+}
+
+/**
+ * @test Verifica que repetir la misma hora despues de otra escritura vuelve a mostrarla.
+ */
+void test_write_time_cache_is_invalidated_by_other_writes(void) {
+    const uint8_t hours[2] = {2, 1};
+    const uint8_t minutes[2] = {0, 3};
+    uint8_t shown[SCREEN_DIGITS];
+
+    ScreenWriteTime(screen, hours, minutes);
+    ScreenPublish(screen);
+    ScreenWriteText(screen, "AL");
+    ScreenWriteTime(screen, hours, minutes);
+    ScreenPublish(screen);
+    ScanOnce(shown);
+    TEST_ASSERT_EQUAL_HEX8(GLYPH_OF('1'), shown[0]);
+    TEST_ASSERT_EQUAL_HEX8(GLYPH_OF('2'), shown[1]);
+    TEST_ASSERT_EQUAL_HEX8(GLYPH_OF('3'), shown[2]);
+    TEST_ASSERT_EQUAL_HEX8(GLYPH_OF('0'), shown[3]);
+    TEST_ASSERT_EQUAL(-1, ScreenWriteTime(NULL, hours, minutes));
+}
+
+/**
+ * @test Verifica que con un driver que ofrece DigitCommit cada paso del barrido es una sola llamada al driver.
+ */
+void test_driver_with_digit_commit_uses_single_call(void) {
+    uint8_t value[SCREEN_DIGITS] = {1, 2, 3, 4};
+
+    screen = ScreenCreate(SCREEN_DIGITS, &commit_driver);
+    ScreenWriteBCD(screen, value, SCREEN_DIGITS);
+    ScreenEnablePoint(screen, 2);
+    ScreenPublish(screen);
+    events_count = 0;
+    for (int i = 0; i < 2 * SCREEN_DIGITS; i++) {
+        ScreenRefresh(screen);
+    }
+    TEST_ASSERT_EQUAL(2 * SCREEN_DIGITS, events_count);
+    for (int i = 0; i < 2 * SCREEN_DIGITS; i++) {
+        TEST_ASSERT_EQUAL_CHAR('C', events[i].action);
+        TEST_ASSERT_EQUAL_UINT8((i + 1) % SCREEN_DIGITS, events[i].value);
+    }
+    TEST_ASSERT_EQUAL_HEX8(GLYPH_OF('1'), events[3].extra);
+    TEST_ASSERT_EQUAL_HEX8(GLYPH_OF('3') | SEGMENT_P, events[5].extra);
+}
+
+/**
+ * @test Verifica que la transicion de rodillo muestra los cuadros intermedios precalculados y luego el valor nuevo.
+ */
+void test_roll_transition_steps_through_precomputed_frames(void) {
+    uint8_t value[SCREEN_DIGITS] = {8, 8, 8, 8};
+    const uint8_t blank[SCREEN_DIGITS] = {0};
+    uint8_t shown[SCREEN_DIGITS];
+
+    ScreenWriteBCD(screen, value, SCREEN_DIGITS);
+    ScreenPublish(screen);
+    TEST_ASSERT_EQUAL(0, ScreenSetTransition(screen, SCREEN_TRANSITION_ROLL, 1));
+
+    ScreenWriteSegments(screen, blank, SCREEN_DIGITS);
+    ScreenEnablePoint(screen, 0);
+    ScreenPublish(screen);
+    ScanOnce(shown);
+    TEST_ASSERT_EQUAL_HEX8(SEGMENT_A | SEGMENT_B | SEGMENT_F | SEGMENT_G | SEGMENT_P, shown[0]);
+    TEST_ASSERT_EQUAL_HEX8(SEGMENT_A | SEGMENT_B | SEGMENT_F | SEGMENT_G, shown[3]);
+    ScanOnce(shown);
+    TEST_ASSERT_EQUAL_HEX8(SEGMENT_A, shown[3]);
+    ScanOnce(shown);
+    TEST_ASSERT_EQUAL_HEX8(SEGMENT_P, shown[0]);
+    TEST_ASSERT_EQUAL_HEX8(0, shown[3]);
+}
+
+/**
+ * @test Verifica que la transicion de barrido reemplaza los digitos de izquierda a derecha.
+ */
+void test_wipe_transition_replaces_digits_left_to_right(void) {
+    uint8_t first[SCREEN_DIGITS] = {1, 1, 1, 1};
+    uint8_t second[SCREEN_DIGITS] = {2, 2, 2, 2};
+    uint8_t shown[SCREEN_DIGITS];
+
+    ScreenWriteBCD(screen, first, SCREEN_DIGITS);
+    ScreenPublish(screen);
+    ScreenSetTransition(screen, SCREEN_TRANSITION_WIPE, 2);
+    ScreenWriteBCD(screen, second, SCREEN_DIGITS);
+    ScreenPublish(screen);
+
+    for (int step = 0; step < SCREEN_DIGITS; step++) {
+        ScanOnce(shown);
+        for (int i = 0; i < SCREEN_DIGITS; i++) {
+            TEST_ASSERT_EQUAL_HEX8(GLYPH_OF(i <= step ? '2' : '1'), shown[i]);
+        }
+        ScanOnce(shown);
+    }
+}
+
+/**
+ * @test Verifica que el fundido alterna entre ambos valores con cada vez mas cuadros del valor nuevo.
+ */
+void test_fade_transition_dithers_towards_new_value(void) {
+    uint8_t first[SCREEN_DIGITS] = {1, 1, 1, 1};
+    uint8_t second[SCREEN_DIGITS] = {7, 7, 7, 7};
+    uint8_t shown[SCREEN_DIGITS];
+    int early = 0, late = 0;
+
+    ScreenWriteBCD(screen, first, SCREEN_DIGITS);
+    ScreenPublish(screen);
+    ScreenSetTransition(screen, SCREEN_TRANSITION_FADE, 1);
+    ScreenWriteBCD(screen, second, SCREEN_DIGITS);
+    ScreenPublish(screen);
+
+    for (int frame = 0; frame < 16; frame++) {
+        ScanOnce(shown);
+        if (shown[0] == GLYPH_OF('7')) {
+            if (frame < 8) {
+                early++;
+            } else {
+                late++;
+            }
+        } else {
+            TEST_ASSERT_EQUAL_HEX8(GLYPH_OF('1'), shown[0]);
+        }
+    }
+    TEST_ASSERT_TRUE(early > 0);
+    TEST_ASSERT_TRUE(late > early);
+    ScanOnce(shown);
+    TEST_ASSERT_EACH_EQUAL_HEX8(GLYPH_OF('7'), shown, SCREEN_DIGITS);
+}
+
+/**
+ * @test Verifica que un valor nuevo cancela la transicion en curso y que los cambios de puntos no generan otra.
+ */
+void test_new_value_cancels_running_transition(void) {
+    uint8_t first[SCREEN_DIGITS] = {1, 1, 1, 1};
+    uint8_t second[SCREEN_DIGITS] = {2, 2, 2, 2};
+    uint8_t third[SCREEN_DIGITS] = {3, 3, 3, 3};
+    uint8_t shown[SCREEN_DIGITS];
+
+    ScreenWriteBCD(screen, first, SCREEN_DIGITS);
+    ScreenPublish(screen);
+    ScreenSetTransition(screen, SCREEN_TRANSITION_WIPE, 1);
+    ScreenWriteBCD(screen, second, SCREEN_DIGITS);
+    ScreenPublish(screen);
+    ScanOnce(shown);
+    TEST_ASSERT_EQUAL_HEX8(GLYPH_OF('1'), shown[1]);
+
+    ScreenWriteBCD(screen, third, SCREEN_DIGITS);
+    ScreenPublish(screen);
+    ScanOnce(shown);
+    TEST_ASSERT_EQUAL_HEX8(GLYPH_OF('3'), shown[0]);
+    TEST_ASSERT_EQUAL_HEX8(GLYPH_OF('2'), shown[1]);
+    ScanOnce(shown);
+    ScanOnce(shown);
+    ScanOnce(shown);
+    TEST_ASSERT_EACH_EQUAL_HEX8(GLYPH_OF('3'), shown, SCREEN_DIGITS);
+
+    ScreenEnablePoint(screen, 2);
+    ScreenPublish(screen);
+    ScanOnce(shown);
+    TEST_ASSERT_EQUAL_HEX8(GLYPH_OF('3') | SEGMENT_P, shown[2]);
+    TEST_ASSERT_EQUAL_HEX8(GLYPH_OF('3'), shown[0]);
+    TEST_ASSERT_EQUAL(-1, ScreenSetTransition(screen, SCREEN_TRANSITION_ROLL, 0));
+}
+
+/**
+ * @test Verifica que al dormir se apagan los digitos y que al volver se empieza por el primer digito con el ultimo
+ * cuadro publicado.
+ */
+void test_sleep_blanks_and_resumes_from_first_digit(void) {
+    uint8_t first[SCREEN_DIGITS] = {1, 2, 3, 4};
+    uint8_t second[SCREEN_DIGITS] = {5, 6, 7, 8};
+
+    ScreenWriteBCD(screen, first, SCREEN_DIGITS);
+    ScreenPublish(screen);
+    ScreenRefresh(screen);
+    ScreenRefresh(screen);
+    events_count = 0;
+
+    ScreenSleep(screen);
+    TEST_ASSERT_EQUAL(1, events_count);
+    TEST_ASSERT_EQUAL_CHAR('O', events[0].action);
+
+    ScreenWriteBCD(screen, second, SCREEN_DIGITS);
+    ScreenPublish(screen);
+    events_count = 0;
+    ScreenRefresh(screen);
+    TEST_ASSERT_EQUAL_UINT8(0, events[2].value);
+    TEST_ASSERT_EQUAL_HEX8(GLYPH_OF('5'), events[1].value);
+}
+
+/**
+ * @test Verifica que el tiempo que la pantalla estuvo dormida no se registra como jitter.
+ */
+void test_sleep_does_not_count_as_jitter(void) {
+    screen_jitter_t stats;
+
+    FakeTimerFire(0);
+    FakeTimerFire(0);
+    FakeTimerFire(0);
+    ScreenSleep(screen);
+    timer_match += 1000 * REFRESH_PERIOD;
+    events_count = 0;
+    FakeTimerFire(0);
+    FakeTimerFire(0);
+    TEST_ASSERT_EQUAL_UINT8(0, events[2].value);
+    TEST_ASSERT_TRUE(ScreenGetJitter(screen, &stats));
+    TEST_ASSERT_EQUAL_UINT32(3, stats.count);
+    TEST_ASSERT_EQUAL_INT32(0, stats.max);
+}
+
+/* === Private function definitions ================================================================================ */
+
+static void FakeDigitsTurnOff(void) {
+    if (events_count < EVENTS_MAX) {
+        events[events_count++] = (driver_event_t){.action = 'O', .value = 0};
+    }
+}
+
+static void FakeSegmentsUpdate(uint8_t segments) {
+    if (events_count < EVENTS_MAX) {
+        events[events_count++] = (driver_event_t){.action = 'S', .value = segments};
+    }
+}
+
+static void FakeDigitTurnOn(uint8_t digit) {
+    if (events_count < EVENTS_MAX) {
+        events[events_count++] = (driver_event_t){.action = 'D', .value = digit};
+    }
+}
+
+static void FakeDigitCommit(uint8_t digit, uint8_t segments) {
+    if (events_count < EVENTS_MAX) {
+        events[events_count++] = (driver_event_t){.action = 'C', .value = digit, .extra = segments};
+    }
+}
+
+static uint32_t FakeTimerFire(uint32_t latency) {
+    timer_match += timer_interval;
+    timer_interval = ScreenRefreshTimed(screen, timer_match + latency);
+    return timer_interval;
+}
+
+static void ScanOnce(uint8_t shown[SCREEN_DIGITS]) {
+    for (int i = 0; i < SCREEN_DIGITS; i++) {
+        events_count = 0;
+        ScreenRefresh(screen);
+        shown[events[2].value] = events[1].value;
+    }
+}
+
+static void * WriterThread(void * arguments) {
+    uint8_t value[SCREEN_DIGITS];
+
+    (void)arguments;
+    for (int frame = 0; frame < PUBLISH_COUNT; frame++) {
+        memset(value, 1 + frame % 9, sizeof(value));
+        ScreenWriteBCD(screen, value, SCREEN_DIGITS);
+        for (int i = 0; i < SCREEN_DIGITS; i++) {
+            if (frame & 1) {
+                ScreenEnablePoint(screen, i);
+            } else {
+                ScreenDisablePoint(screen, i);
+            }
+        }
+        ScreenPublish(screen);
+    }
+    __atomic_store_n(&writer_done, 1, __ATOMIC_RELEASE);
+    return NULL;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,148 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Martin Nicolas Soria <soria.m.nicolas@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, disponiblestribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file test_sleep.c
+ ** @brief Pruebas unitarias de la politica de apagado de la pantalla.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "unity.h"
+#include "sleep.h"
+
+/* === Macros definitions ========================================================================================== */
+
+#define TIMEOUT      60000          // Apagado por inactividad de la politica de prueba, un minuto
+#define LONG_TIMEOUT (10 * TIMEOUT) // Apagado por inactividad mas largo que SLEEP_NIGHT_HOLD, como el de la aplicacion
+#define NIGHT_FROM   (23 * 60)      // Comienzo de la ventana nocturna, 23:00
+#define NIGHT_TO     (7 * 60)       // Fin de la ventana nocturna, 07:00
+#define NOON         (12 * 60)      // Minuto del dia fuera de la ventana nocturna
+#define MIDNIGHT     0              // Minuto del dia dentro de la ventana nocturna
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+
+static sleep_t policy;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Public function definitions ============================================================================== */
+
+void setUp(void) {
+    policy = SleepCreate(TIMEOUT, NIGHT_FROM, NIGHT_TO);
+    TEST_ASSERT_TRUE(SleepIsAwake(policy, 0, NOON, false));
+}
+
+/**
+ * @test Verifica que la pantalla se apaga al cumplirse el tiempo sin actividad y que una tecla la enciende.
+ */
+void test_inactivity_turns_off_and_activity_wakes(void) {
+    TEST_ASSERT_TRUE(SleepIsAwake(policy, TIMEOUT - 1, NOON, false));
+    TEST_ASSERT_FALSE(SleepIsAwake(policy, TIMEOUT, NOON, false));
+
+    SleepActivity(policy);
+    TEST_ASSERT_TRUE(SleepIsAwake(policy, 5 * TIMEOUT, NOON, false));
+    TEST_ASSERT_TRUE(SleepIsAwake(policy, 6 * TIMEOUT - 1, NOON, false));
+    TEST_ASSERT_FALSE(SleepIsAwake(policy, 6 * TIMEOUT, NOON, false));
+}
+
+/**
+ * @test Verifica que la alarma enciende la pantalla mientras suena, aun de noche y sin actividad.
+ */
+void test_alarm_keeps_display_awake(void) {
+    TEST_ASSERT_TRUE(SleepIsAwake(policy, 2 * TIMEOUT, MIDNIGHT, true));
+    TEST_ASSERT_FALSE(SleepIsAwake(policy, 2 * TIMEOUT, MIDNIGHT, false));
+}
+
+/**
+ * @test Verifica que sin apagado por inactividad la pantalla solo se apaga en la ventana nocturna, que cruza la
+ * medianoche, y que una tecla la enciende por un tiempo fijo.
+ */
+void test_night_window_without_inactivity_timeout(void) {
+    policy = SleepCreate(0, NIGHT_FROM, NIGHT_TO);
+    TEST_ASSERT_TRUE(SleepIsAwake(policy, 0, MIDNIGHT, false));
+
+    TEST_ASSERT_TRUE(SleepIsAwake(policy, SLEEP_NIGHT_HOLD, NOON, false));
+    TEST_ASSERT_TRUE(SleepIsAwake(policy, SLEEP_NIGHT_HOLD, NIGHT_FROM - 1, false));
+    TEST_ASSERT_FALSE(SleepIsAwake(policy, SLEEP_NIGHT_HOLD, NIGHT_FROM, false));
+    TEST_ASSERT_FALSE(SleepIsAwake(policy, SLEEP_NIGHT_HOLD, MIDNIGHT, false));
+    TEST_ASSERT_FALSE(SleepIsAwake(policy, SLEEP_NIGHT_HOLD, NIGHT_TO - 1, false));
+    TEST_ASSERT_TRUE(SleepIsAwake(policy, SLEEP_NIGHT_HOLD, NIGHT_TO, false));
+    TEST_ASSERT_TRUE(SleepIsAwake(policy, SLEEP_NIGHT_HOLD, SLEEP_MINUTE_UNKNOWN, false));
+
+    SleepActivity(policy);
+    TEST_ASSERT_TRUE(SleepIsAwake(policy, 2 * SLEEP_NIGHT_HOLD, MIDNIGHT, false));
+    TEST_ASSERT_FALSE(SleepIsAwake(policy, 3 * SLEEP_NIGHT_HOLD, MIDNIGHT, false));
+}
+
+/**
+ * @test Verifica que con apagado por inactividad la ventana nocturna apaga la pantalla antes de que se cumpla ese
+ * tiempo, y que de noche una tecla la enciende solo por SLEEP_NIGHT_HOLD.
+ */
+void test_night_window_with_inactivity_timeout(void) {
+    policy = SleepCreate(LONG_TIMEOUT, NIGHT_FROM, NIGHT_TO);
+    TEST_ASSERT_TRUE(SleepIsAwake(policy, 0, NIGHT_FROM - 1, false));
+
+    TEST_ASSERT_TRUE(SleepIsAwake(policy, SLEEP_NIGHT_HOLD - 1, NIGHT_FROM - 1, false));
+    TEST_ASSERT_FALSE(SleepIsAwake(policy, SLEEP_NIGHT_HOLD, NIGHT_FROM, false));
+    TEST_ASSERT_TRUE(SleepIsAwake(policy, SLEEP_NIGHT_HOLD, NIGHT_FROM, true));
+
+    SleepActivity(policy);
+    TEST_ASSERT_TRUE(SleepIsAwake(policy, 2 * SLEEP_NIGHT_HOLD, MIDNIGHT, false));
+    TEST_ASSERT_TRUE(SleepIsAwake(policy, 3 * SLEEP_NIGHT_HOLD - 1, MIDNIGHT, false));
+    TEST_ASSERT_FALSE(SleepIsAwake(policy, 3 * SLEEP_NIGHT_HOLD, MIDNIGHT, false));
+    TEST_ASSERT_FALSE(SleepIsAwake(policy, 3 * SLEEP_NIGHT_HOLD, NIGHT_TO, false));
+
+    SleepActivity(policy);
+    TEST_ASSERT_TRUE(SleepIsAwake(policy, 4 * SLEEP_NIGHT_HOLD, NOON, false));
+    TEST_ASSERT_TRUE(SleepIsAwake(policy, 4 * SLEEP_NIGHT_HOLD + LONG_TIMEOUT - 1, NOON, false));
+    TEST_ASSERT_FALSE(SleepIsAwake(policy, 4 * SLEEP_NIGHT_HOLD + LONG_TIMEOUT, NOON, false));
+}
+
+/**
+ * @test Verifica que el desborde del contador de tiempo no vuelve a encender la pantalla ya apagada.
+ */
+void test_time_counter_overflow_does_not_wake(void) {
+    TEST_ASSERT_FALSE(SleepIsAwake(policy, TIMEOUT, NOON, false));
+    TEST_ASSERT_FALSE(SleepIsAwake(policy, UINT32_MAX, NOON, false));
+    TEST_ASSERT_FALSE(SleepIsAwake(policy, 10, NOON, false));
+
+    SleepActivity(policy);
+    TEST_ASSERT_TRUE(SleepIsAwake(policy, UINT32_MAX - 10, NOON, false));
+    TEST_ASSERT_TRUE(SleepIsAwake(policy, TIMEOUT - 20, NOON, false));
+    TEST_ASSERT_FALSE(SleepIsAwake(policy, TIMEOUT, NOON, false));
+}
+
+/**
+ * @test Verifica los parametros invalidos.
+ */
+void test_invalid_arguments(void) {
+    TEST_ASSERT_NULL(SleepCreate(TIMEOUT, 1440, NIGHT_TO));
+    TEST_ASSERT_NULL(SleepCreate(TIMEOUT, NIGHT_FROM, 1440));
+    TEST_ASSERT_TRUE(SleepIsAwake(NULL, 0, MIDNIGHT, false));
+    SleepActivity(NULL);
+}
+
+/* === Private function definitions ================================================================================ */
+
+/* === End of documentation ======================================================================================== */